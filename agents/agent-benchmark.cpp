@@ -6,73 +6,29 @@
  */
 
 #include "agent-benchmark.hpp"
-#include <algorithm>
-#include <array>
-#include <iostream>
 #include <random>
 #include <string>
-#include <vector>
 
-AgentBenchmark::AgentBenchmark() : AgentBenchmark(4, false) {}
-
-AgentBenchmark::AgentBenchmark(size_t depth, bool random)
-    : AgentMinimax(depth),
-      random_{random},
-      generator_(std::random_device()()) {}
-
-void AgentBenchmark::getMove(
-    const Board &board, size_t &move,
-    const std::chrono::system_clock::time_point &endTime) {
-  size_t turn = board.getTurn();
-  std::vector<size_t> moves = board.getSuccessors();
-  float bestSucMinimax = 0;
-
-  size_t bestMove = 3;
-  float alpha = -256;
-  float beta = 256;
-  bestSucMinimax = -256 + (turn * 512.0);
-
-  // Find the best move
-  for (size_t move : moves) {
-    // Calculate the minimax of the successor state
-    Board sucBoard = board;
-    sucBoard.handleMove(move);
-    float sucMinimax =
-        DISCOUNT * minimax(sucBoard, firstDepth_ - 1, alpha, beta);
-
-    // If this successor is the best so far, update values
-    if (!turn && sucMinimax > bestSucMinimax) {
-      bestMove = move;
-      bestSucMinimax = sucMinimax;
-      alpha = std::max(alpha, bestSucMinimax);
-    } else if (turn && sucMinimax < bestSucMinimax) {
-      bestMove = move;
-      bestSucMinimax = sucMinimax;
-      beta = std::min(beta, bestSucMinimax);
-    }
+BenchmarkHeuristic::BenchmarkHeuristic(bool random) : random{random} {}
 
-    // If alpha > beta, do not explore any further
-    if (alpha >= beta) {
-      break;
-    }
-
-    // If we have surpassed the endTime given by the caller, yield to caller
-    if (std::chrono::system_clock::now() >= endTime) {
-      return;
-    }
+int BenchmarkHeuristic::evaluate(const Board &board) const {
+  if (random) {
+    thread_local std::default_random_engine generator(std::random_device{}());
+    std::uniform_int_distribution<int> dist(-RANDOM_RANGE, RANDOM_RANGE);
+    return dist(generator);
   }
 
-  move = bestMove;
+  return 0;
 }
 
-float AgentBenchmark::heuristic(const Board &board) {
-  std::uniform_real_distribution dist(-0.5, 0.5);
+template class AgentNegamax<BenchmarkHeuristic>;
 
-  if (random_) {
-    return dist(generator_);
-  }
+AgentBenchmark::AgentBenchmark() : AgentBenchmark(4, false) {}
 
-  return 0;
-}
+AgentBenchmark::AgentBenchmark(size_t depth, bool random, size_t numThreads,
+                               ParallelMode parallelMode)
+    : AgentNegamax(BenchmarkHeuristic(random), depth,
+                   random ? 0 : DEFAULT_TABLE_BYTES, false, numThreads,
+                   parallelMode) {}
 
 std::string AgentBenchmark::getAgentName() const { return "Benchmark"; }
@@ -10,37 +10,62 @@
 
 #include <random>
 #include <string>
-#include <unordered_map>
-#include "agent-minimax.hpp"
+#include "agent-negamax.hpp"
+
+/**
+ * \struct BenchmarkHeuristic
+ * \brief Values every board as a draw, or at random
+ */
+struct BenchmarkHeuristic {
+  /**
+   * \brief Creates a null or random heuristic eval
+   * \param random  True for random heuristic eval, false for null heuristic
+   */
+  explicit BenchmarkHeuristic(bool random);
+
+  /**
+   * \brief Estimates the value of a board for the player to move
+   * \param board   The board state to evaluate
+   * \return A uniform random value in [-RANDOM_RANGE, RANDOM_RANGE] if random
+   * is set, else 0
+   * \note Each thread draws from its own random number generator, so the
+   * threads of a parallel search can evaluate boards at once
+   */
+  int evaluate(const Board &board) const;
+
+  /** \brief The largest magnitude of a random heuristic value */
+  static const int RANDOM_RANGE = 500;
+
+  /** \brief True if the agent should use random heuristic eval */
+  bool random;
+};
 
 /**
  * \class AgentBenchmark
  * \brief A minimax agent to be used as a benchmark to test other agents
  */
-class AgentBenchmark : public AgentMinimax {
+class AgentBenchmark : public AgentNegamax<BenchmarkHeuristic> {
  public:
   AgentBenchmark();
 
   /**
    * \brief Creates a benchmark agent with a specified depth and heuristic eval
-   * \param depth   The depth to which minimax search should occur
-   * \param random  True for random heuristic eval, false for null heuristic
+   * \param depth         The depth to which minimax search should occur
+   * \param random        True for random heuristic eval, false for null
+   * heuristic
+   * \param numThreads    The number of threads searching in parallel
+   * \param parallelMode  How the threads share the search (see AgentMinimax)
+   * \note The transposition table is disabled with a random heuristic eval,
+   * since a stored value would fix the value of a board for later searches.
+   * LAZY_SMP threads only share work through the table, so use YBWC to
+   * search with several threads and a random heuristic eval.
    */
-  AgentBenchmark(size_t depth, bool random);
-
-  void getMove(const Board &board, size_t &move,
-               const std::chrono::system_clock::time_point &endTime) override;
+  AgentBenchmark(size_t depth, bool random, size_t numThreads = 1,
+                 ParallelMode parallelMode = LAZY_SMP);
 
   std::string getAgentName() const override;
-
- private:
-  /** \brief True if the agent should use random heuristic eval */
-  bool random_;
-
-  /** \brief The random number generator used for random heuristic eval */
-  std::default_random_engine generator_;
-
-  float heuristic(const Board &board) override;
 };
 
+extern template class AgentNegamax<BenchmarkHeuristic>;
+
 #endif  // AGENTS_AGENT_BENCHMARK_HPP_
@@ -13,7 +13,7 @@ void AgentHuman::getMove(const Board &board, size_t &move,
                          const std::chrono::system_clock::time_point &endTime) {
   std::cout << board << std::endl;
   std::cout << "Enter the index of the column in which you would like to "
-            << "play (a number from 0 to 6): ";
+            << "play (a number from 0 to " << Board::WIDTH - 1 << "): ";
 
   size_t userMove;
   std::cin >> userMove;
@@ -0,0 +1,286 @@
+/**
+ * \file agent-mcts-graph.cpp
+ * \copyright Matthew Calligaro
+ * \date December 2019
+ * \brief Implements the AgentMCTSGraph class
+ */
+
+#include "agent-mcts-graph.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <string>
+
+/*******************************************************************************
+ * AgentMCTSGraph Implementation
+ ******************************************************************************/
+
+// Nodes are keyed by Board::getKey
+static_assert(sizeof(Board::Mask) == sizeof(uint64_t),
+              "AgentMCTSGraph needs boards with 64-bit keys");
+
+const float AgentMCTSGraph::C = 1;
+
+AgentMCTSGraph::AgentMCTSGraph() : AgentMCTSGraph(DEFAULT_MAX_NODES) {}
+
+AgentMCTSGraph::AgentMCTSGraph(size_t maxNodes, RolloutPolicy::Type rollout)
+    : numNodes_{0},
+      rootKey_{0},
+      rootMoves_{0},
+      numPlayouts_{0},
+      symmetric_{false},
+      generator_(std::chrono::system_clock::now().time_since_epoch().count()) {
+  // Round the number of buckets down to a power of 2 so that a bucket can be
+  // chosen with a mask
+  size_t numBuckets = 1;
+  while (numBuckets * 2 * BUCKET_SIZE <= maxNodes) {
+    numBuckets *= 2;
+  }
+  bucketMask_ = numBuckets - 1;
+  nodes_.reset(new Node[numBuckets * BUCKET_SIZE]());
+  rolloutPolicy_ = RolloutPolicy::create(rollout, generator_());
+}
+
+void AgentMCTSGraph::getMove(
+    const Board& board, size_t& move,
+    const std::chrono::system_clock::time_point& endTime) {
+  // Nodes from earlier in the game stay in the table, and any which are still
+  // reachable from this board keep their statistics
+  bool mirrored;
+  rootKey_ = getNodeKey(board, mirrored);
+  rootMoves_ = board.getNumMoves();
+  insert(board);
+  numPlayouts_ = 0;
+  move = mostVisitedMove(board);
+  while (std::chrono::system_clock::now() < endTime) {
+    iterate(board);
+    numPlayouts_ += rolloutPolicy_->getBatchSize();
+    move = mostVisitedMove(board);
+  }
+
+  printStats(std::cout, board);
+}
+
+std::string AgentMCTSGraph::getAgentName() const { return "MCTS Graph"; }
+
+size_t AgentMCTSGraph::getPlayoutCount() const { return numPlayouts_; }
+
+size_t AgentMCTSGraph::getNodeCount() const { return numNodes_; }
+
+size_t AgentMCTSGraph::getMemoryBytes() const {
+  return numNodes_ * sizeof(Node);
+}
+
+void AgentMCTSGraph::setSymmetric(bool symmetric) { symmetric_ = symmetric; }
+
+uint64_t AgentMCTSGraph::getNodeKey(const Board& board, bool& mirrored) const {
+  uint64_t key = board.getKey();
+  mirrored = false;
+  if (symmetric_) {
+    uint64_t mirroredKey = board.getMirroredKey();
+    mirrored = mirroredKey < key;
+    key = std::min(key, mirroredKey);
+  }
+  return key;
+}
+
+AgentMCTSGraph::Node* AgentMCTSGraph::probe(uint64_t key) {
+  // Fibonacci hashing spreads the structured board keys over the buckets
+  uint64_t hash = key * 0x9E3779B97F4A7C15UL;
+  Node* bucket = nodes_.get() + ((hash >> 32) & bucketMask_) * BUCKET_SIZE;
+  for (size_t i = 0; i < BUCKET_SIZE; ++i) {
+    if (bucket[i].key == key) {
+      return bucket + i;
+    }
+  }
+  return nullptr;
+}
+
+AgentMCTSGraph::Node* AgentMCTSGraph::insert(const Board& board) {
+  bool mirrored;
+  uint64_t key = getNodeKey(board, mirrored);
+  uint64_t hash = key * 0x9E3779B97F4A7C15UL;
+  Node* bucket = nodes_.get() + ((hash >> 32) & bucketMask_) * BUCKET_SIZE;
+
+  // Prefer an empty slot, then a node which can never be reached from the
+  // root again (one with no more pieces than the root, other than the root
+  // itself), then the least visited node.  The root is never replaced.
+  Node* victim = nullptr;
+  uint64_t victimCost = std::numeric_limits<uint64_t>::max();
+  for (size_t i = 0; i < BUCKET_SIZE; ++i) {
+    Node& node = bucket[i];
+    if (node.key == key) {
+      return &node;
+    }
+
+    uint64_t cost;
+    if (!node.key) {
+      cost = 0;
+    } else if (node.key == rootKey_) {
+      continue;
+    } else if (node.numMoves <= rootMoves_) {
+      cost = 1;
+    } else {
+      cost = 2 + static_cast<uint64_t>(node.n);
+    }
+    if (cost < victimCost) {
+      victim = &node;
+      victimCost = cost;
+    }
+  }
+
+  if (!victim->key) {
+    ++numNodes_;
+  }
+  *victim = Node();
+  victim->key = key;
+  victim->numMoves = board.getNumMoves();
+  return victim;
+}
+
+void AgentMCTSGraph::iterate(const Board& board) {
+  // Record the key of each node on the path and the edge which left it, so
+  // that the nodes can be found again even if one was replaced meanwhile
+  uint64_t keys[Board::SIZE + 1];
+  size_t moves[Board::SIZE + 1];
+  size_t depth = 0;
+  Board cur = board;
+  float reward;
+  bool mirrored;
+  while (true) {
+    keys[depth] = getNodeKey(cur, mirrored);
+    moves[depth] = NO_MOVE;
+    Node* node = probe(keys[depth]);
+    ++depth;
+    if (cur.isWon() || cur.isDraw() || !node) {
+      reward = rolloutPolicy_->playout(cur);
+      break;
+    }
+
+    // Find the child of each legal move, which may have been added through a
+    // different parent
+    Board::Mask legal = cur.getLegalMask();
+    Node* children[Board::WIDTH] = {};
+    uint16_t unexpanded = 0;
+    for (size_t col = 0; col < Board::WIDTH; ++col) {
+      if (legal & (Board::COLUMN_MASK << (col * Board::COLUMN_BITS))) {
+        Board child = cur;
+        child.handleMove(col);
+        bool childMirrored;
+        children[col] = probe(getNodeKey(child, childMirrored));
+        if (!children[col]) {
+          unexpanded |= 1 << col;
+        }
+      }
+    }
+
+    // Expand a random missing child and roll out from it
+    if (unexpanded) {
+      uint16_t choice = unexpanded;
+      for (size_t skip = generator_() % __builtin_popcount(unexpanded); skip;
+           --skip) {
+        choice &= choice - 1;
+      }
+      size_t col = __builtin_ctz(choice);
+      moves[depth - 1] = mirrored ? Board::WIDTH - 1 - col : col;
+      cur.handleMove(col);
+      insert(cur);
+      keys[depth] = getNodeKey(cur, mirrored);
+      moves[depth] = NO_MOVE;
+      ++depth;
+      reward = rolloutPolicy_->playout(cur);
+      break;
+    }
+
+    // Otherwise follow the child with the best UCT value.  The value of a
+    // child comes from its node, which every path shares, but its
+    // exploration term counts only the visits through this edge.
+    float sign = cur.getTurn() ? -1 : 1;
+    float logN = std::log(std::max<uint32_t>(node->n, 1));
+    size_t bestCol = NO_MOVE;
+    float bestUCT = -std::numeric_limits<float>::infinity();
+    for (size_t col : Board::MOVE_ORDER) {
+      if (!children[col]) {
+        continue;
+      }
+
+      float curUCT = std::numeric_limits<float>::infinity();
+      uint32_t edgeN = node->edgeN[mirrored ? Board::WIDTH - 1 - col : col];
+      if (edgeN) {
+        float n = std::max<uint32_t>(children[col]->n, 1);
+        curUCT = sign * children[col]->q / n + C * std::sqrt(logN / edgeN);
+      }
+      if (curUCT > bestUCT) {
+        bestCol = col;
+        bestUCT = curUCT;
+      }
+    }
+    moves[depth - 1] = mirrored ? Board::WIDTH - 1 - bestCol : bestCol;
+    cur.handleMove(bestCol);
+  }
+
+  // Update every node on the path, including nodes shared with other paths.
+  // A batch rollout sums the rewards of several games, so it counts as that
+  // many visits.
+  uint32_t batchSize = rolloutPolicy_->getBatchSize();
+  for (size_t i = 0; i < depth; ++i) {
+    Node* node = probe(keys[i]);
+    if (node) {
+      node->n += batchSize;
+      node->q += static_cast<int32_t>(reward);
+      if (moves[i] != NO_MOVE) {
+        node->edgeN[moves[i]] += batchSize;
+      }
+    }
+  }
+}
+
+size_t AgentMCTSGraph::mostVisitedMove(const Board& board) {
+  size_t bestCol = NO_MOVE;
+  uint32_t bestN = 0;
+  for (size_t col : Board::MOVE_ORDER) {
+    if (!board.isValidMove(col)) {
+      continue;
+    }
+
+    Board child = board;
+    child.handleMove(col);
+    bool mirrored;
+    Node* node = probe(getNodeKey(child, mirrored));
+    uint32_t n = node ? node->n : 0;
+    if (bestCol == NO_MOVE || n > bestN) {
+      bestCol = col;
+      bestN = n;
+    }
+  }
+  return bestCol;
+}
+
+std::ostream& AgentMCTSGraph::printStats(std::ostream& os,
+                                         const Board& board) {
+  bool rootMirrored;
+  Node* root = probe(getNodeKey(board, rootMirrored));
+  float sign = board.getTurn() ? -1 : 1;
+  for (size_t col = 0; col < Board::WIDTH; ++col) {
+    if (!board.isValidMove(col)) {
+      continue;
+    }
+
+    Board child = board;
+    child.handleMove(col);
+    bool mirrored;
+    Node* node = probe(getNodeKey(child, mirrored));
+    if (node && node->n) {
+      size_t rootCol = rootMirrored ? Board::WIDTH - 1 - col : col;
+      os << "Child (move " << col << "): n_=" << node->n << " q_=" << node->q
+         << " edge_n=" << (root ? root->edgeN[rootCol] : 0)
+         << " value=" << sign * node->q / node->n << std::endl;
+    }
+  }
+  os << ">> Best Child: move " << mostVisitedMove(board) << std::endl;
+  os << ">> Total Explorations: " << numPlayouts_ << " (" << numNodes_
+     << " nodes)" << std::endl
+     << std::endl;
+  return os;
+}
@@ -0,0 +1,185 @@
+/**
+ * \file agent-mcts-graph.hpp
+ * \copyright Matthew Calligaro
+ * \date December 2019
+ * \brief Declares the AgentMCTSGraph class
+ */
+
+#ifndef AGENTS_AGENT_MCTS_GRAPH_HPP_
+#define AGENTS_AGENT_MCTS_GRAPH_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <random>
+#include <string>
+#include "agent.hpp"
+#include "rollout-policy.hpp"
+
+/**
+ * \class AgentMCTSGraph
+ * \brief An agent which uses Monte Carlo Tree Search over a graph of positions
+ * \note Unlike AgentMCTS, a position reached by different move orders has a
+ * single node, so its statistics are shared by every path to it.  Nodes are
+ * stored in a fixed-size hash table keyed by Board::getKey.  Each node counts
+ * the visits through each of its moves (edges) separately from its own
+ * visits: a child's value comes from the child's node, while its exploration
+ * term comes from the edge.
+ * \note When the table is full, a new node replaces a node which can no
+ * longer be reached from the root, or else the least visited node in its
+ * bucket.  The table is kept between moves, so the nodes below the new root
+ * keep their statistics.
+ */
+class AgentMCTSGraph : public Agent {
+ public:
+  /** \brief The default number of nodes which the table can hold */
+  static const size_t DEFAULT_MAX_NODES = 1 << 20;
+
+  AgentMCTSGraph();
+
+  /**
+   * \brief Creates a graph MCTS agent with a node budget
+   * \param maxNodes    The maximum number of nodes in the table
+   * \param rollout     The policy used to play out games from new nodes
+   */
+  explicit AgentMCTSGraph(size_t maxNodes,
+                          RolloutPolicy::Type rollout = RolloutPolicy::RANDOM);
+
+  void getMove(const Board& board, size_t& move,
+               const std::chrono::system_clock::time_point& endTime) override;
+  std::string getAgentName() const override;
+
+  /**
+   * \brief Returns the number of rollouts performed by the last call to getMove
+   * \returns The number of rollout games (a batch rollout counts each game)
+   */
+  size_t getPlayoutCount() const;
+
+  /**
+   * \brief Returns the number of nodes currently stored in the table
+   * \returns The number of nodes
+   */
+  size_t getNodeCount() const;
+
+  /**
+   * \brief Returns the memory used by the nodes currently in the table
+   * \returns The size of the nodes in bytes
+   * \note The whole table is allocated when the agent is created
+   */
+  size_t getMemoryBytes() const;
+
+  /**
+   * \brief Sets whether a position and its mirror image share a node
+   * \param symmetric   True to key the nodes by Board::getCanonicalKey
+   * \note A shared node counts the visits through each edge in the
+   * orientation of the board with the smaller key
+   */
+  void setSymmetric(bool symmetric);
+
+ private:
+  /**
+   * \struct Node
+   * \brief The statistics of a position in the graph
+   */
+  struct Node {
+    /** \brief The key of the position (0 marks an empty slot) */
+    uint64_t key;
+
+    /**
+     * \brief The total number of rollout games which touched this node
+     * (RolloutPolicy::getBatchSize per rollout)
+     */
+    uint32_t n;
+
+    /** \brief The total sum of rewards from rollouts which touched this node */
+    int32_t q;
+
+    /** \brief The rollout games which left this node by each column */
+    uint32_t edgeN[Board::WIDTH];
+
+    /** \brief The number of pieces on the board of the position */
+    uint8_t numMoves;
+  };
+
+  /** \brief The number of nodes in each bucket of the table */
+  static const size_t BUCKET_SIZE = 4;
+
+  /** \brief Marks a step of a path which did not leave its node */
+  static const size_t NO_MOVE = Board::WIDTH;
+
+  /** \brief The value of the turning parameter C used in the UCT equation */
+  static const float C;
+
+  /** \brief The nodes of the table, stored as contiguous buckets */
+  std::unique_ptr<Node[]> nodes_;
+
+  /** \brief The number of buckets minus one (the buckets are a power of 2) */
+  size_t bucketMask_;
+
+  /** \brief The number of nodes currently stored in the table */
+  size_t numNodes_;
+
+  /** \brief The key of the current root */
+  uint64_t rootKey_;
+
+  /** \brief The number of pieces on the board of the current root */
+  size_t rootMoves_;
+
+  /** \brief The number of rollouts performed by the last call to getMove */
+  size_t numPlayouts_;
+
+  /** \brief True if a position and its mirror image share a node */
+  bool symmetric_;
+
+  /** \brief Chooses among the unexpanded moves of a node */
+  std::default_random_engine generator_;
+
+  /** \brief Plays out games from new nodes */
+  std::unique_ptr<RolloutPolicy> rolloutPolicy_;
+
+  /**
+   * \brief Computes the key of the node of a position
+   * \param board     The board state of the position
+   * \param mirrored  True if the node is stored for the mirror image of
+   * board, so its edges are mirrored (output)
+   * \returns The key of the node
+   */
+  uint64_t getNodeKey(const Board& board, bool& mirrored) const;
+
+  /**
+   * \brief Finds the node of a position
+   * \param key   The key of the position
+   * \returns A pointer to the node, or null if the position is not stored
+   */
+  Node* probe(uint64_t key);
+
+  /**
+   * \brief Finds or adds the node of a position
+   * \param board   The board state of the position
+   * \returns A pointer to the node, which has no statistics if it is new
+   */
+  Node* insert(const Board& board);
+
+  /**
+   * \brief Performs a traversal from the root and updates all statistics
+   * \param board   The board state which the root represents
+   */
+  void iterate(const Board& board);
+
+  /**
+   * \brief Determines the move of the root whose node has been visited most
+   * \param board   The board state which the root represents
+   * \returns The column of the chosen move
+   */
+  size_t mostVisitedMove(const Board& board);
+
+  /**
+   * \brief Prints a summary of the MCTS statistics for this turn
+   * \param os      The output stream to which to print the statistics
+   * \param board   The board state which the root represents
+   * \returns The output stream which was passed in
+   */
+  std::ostream& printStats(std::ostream& os, const Board& board);
+};
+
+#endif  // AGENTS_AGENT_MCTS_GRAPH_HPP_
@@ -7,158 +7,651 @@
 
 #include "agent-mcts.hpp"
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <random>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 /*******************************************************************************
  * AgentMCTS Implementation
  ******************************************************************************/
 
-AgentBenchmark AgentMCTS::ROLLOUT_AGENT(3, true);
+// Node::unvisited holds one bit per column
+static_assert(Board::WIDTH <= 8, "AgentMCTS needs at most 8 columns");
+
+const float AgentMCTS::C = 1;
+
+AgentMCTS::AgentMCTS() : AgentMCTS(DEFAULT_MAX_NODES) {}
+
+AgentMCTS::AgentMCTS(size_t maxNodes, RolloutPolicy::Type rollout,
+                     size_t numThreads, ParallelMode parallelMode)
+    : rollout_{rollout},
+      numThreads_{std::max<size_t>(numThreads, 1)},
+      parallelMode_{parallelMode},
+      maxPlayouts_{0},
+      reuseTree_{true},
+      raveEquivalence_{0},
+      hasTree_{false},
+      reusedPlayouts_{0},
+      seeder_(std::chrono::system_clock::now().time_since_epoch().count()),
+      bestChild_{0} {
+  // Divide the nodes between one tree per thread, or give them all to a
+  // single shared tree.  The spare arena is where a reused subtree is copied.
+  size_t numTrees = parallelMode_ == ROOT_PARALLEL ? numThreads_ : 1;
+  size_t capacity = std::max<size_t>(maxNodes / numTrees, 8);
+  for (size_t i = 0; i < numTrees; ++i) {
+    arenas_.emplace_back(new Arena(capacity));
+  }
+  spare_.reset(new Arena(capacity));
+}
+
+AgentMCTS::SearchThread::SearchThread(Arena* arena, uint64_t seed,
+                                      RolloutPolicy::Type rollout)
+    : arena{arena},
+      generator(seed),
+      policy{RolloutPolicy::create(rollout, seed)},
+      batchSize{static_cast<uint32_t>(policy->getBatchSize())},
+      games(batchSize) {}
 
 void AgentMCTS::getMove(const Board& board, size_t& move,
                         const std::chrono::system_clock::time_point& endTime) {
-  Root root(board);
-  while (std::chrono::system_clock::now() < endTime) {
-    move = root.iterate();
+  std::vector<SearchThread> threads;
+  for (size_t i = 0; i < numThreads_; ++i) {
+    threads.emplace_back(arenas_[i % arenas_.size()].get(), seeder_(),
+                         rollout_);
+  }
+
+  // Keep what the trees of the previous move learned about this board, and
+  // discard the rest
+  reusedPlayouts_ = 0;
+  for (size_t i = 0; i < arenas_.size(); ++i) {
+    initializeTree(i, threads[i], board);
+  }
+  for (size_t i = 0; i < numThreads_; ++i) {
+    threads[i].arena = arenas_[i % arenas_.size()].get();
+  }
+  bestChild_ = mostVisitedChild(mergeRootStats(), board.getTurn());
+  move = bestChild_;
+
+  // Search with every thread until time is up, splitting the playout limit
+  // between the trees
+  size_t maxPlayouts = maxPlayouts_ / arenas_.size();
+  if (maxPlayouts_ && !maxPlayouts) {
+    maxPlayouts = 1;
+  }
+  std::vector<std::thread> helpers;
+  for (size_t i = 1; i < numThreads_; ++i) {
+    helpers.emplace_back(&AgentMCTS::search, this, std::ref(threads[i]),
+                         std::cref(board), std::cref(endTime), maxPlayouts,
+                         nullptr);
+  }
+  search(threads[0], board, endTime, maxPlayouts, &move);
+  for (std::thread& helper : helpers) {
+    helper.join();
   }
 
-  root.printStats(std::cout);
+  // Choose the move by the visits of every tree
+  bestChild_ = mostVisitedChild(mergeRootStats(), board.getTurn());
+  move = bestChild_;
+  lastBoard_ = board;
+  hasTree_ = true;
+  printStats(std::cout, board);
 }
 
 std::string AgentMCTS::getAgentName() const { return "MCTS"; }
 
-/*******************************************************************************
- * AgentMCTS::Node Implementation
- ******************************************************************************/
+size_t AgentMCTS::getPlayoutCount() const { return mergeRootStats().rootN; }
+
+size_t AgentMCTS::getReusedPlayoutCount() const { return reusedPlayouts_; }
 
-const float AgentMCTS::Node::C = 1;
+size_t AgentMCTS::getMemoryBytes() const {
+  size_t amafBytes = Board::WIDTH * sizeof(AmafCounter);
+  size_t nodeBytes = sizeof(Node) + (raveEquivalence_ ? amafBytes : 0);
+  return mergeRootStats().numNodes * nodeBytes;
+}
+
+void AgentMCTS::setPlayoutLimit(size_t maxPlayouts) {
+  maxPlayouts_ = maxPlayouts;
+}
 
-AgentMCTS::Node::Node(const Board& board, bool randomizeVisitOrder)
-    : board_{board}, numChildren_{0}, q_{0}, n_{0} {
-  std::vector<size_t> sucs = board_.getSuccessors();
+void AgentMCTS::setTreeReuse(bool reuseTree) { reuseTree_ = reuseTree; }
 
-  if (randomizeVisitOrder) {
-    std::shuffle(
-        sucs.begin(), sucs.end(),
-        std::default_random_engine(
-            std::chrono::system_clock::now().time_since_epoch().count()));
+void AgentMCTS::setRave(size_t equivalence) {
+  raveEquivalence_ = equivalence;
+  if (raveEquivalence_) {
+    for (std::unique_ptr<Arena>& arena : arenas_) {
+      arena->enableAmaf();
+    }
+    spare_->enableAmaf();
   }
+}
 
-  for (size_t move : sucs) {
-    unvisited_.push(move);
+uint32_t AgentMCTS::newNode(Arena& arena, const Board& board) {
+  // A finished game has no children
+  uint8_t unvisited = 0;
+  if (!(board.isWon() || board.isDraw())) {
+    Board::Mask legal = board.getLegalMask();
+    for (size_t col = 0; col < Board::WIDTH; ++col) {
+      if (legal & (Board::COLUMN_MASK << (col * Board::COLUMN_BITS))) {
+        unvisited |= 1 << col;
+      }
+    }
   }
+  return arena.allocate(unvisited, proveBoard(board));
 }
 
-AgentMCTS::Node::~Node() {
-  for (size_t i = 0; i < numChildren_; ++i) {
-    delete children_[i];
+uint8_t AgentMCTS::proveBoard(const Board& board) {
+  if (board.isWon()) {
+    return board.getTurn() ? X_WINS : O_WINS;
+  }
+  if (board.isDraw()) {
+    return DRAW;
+  }
+
+  // The player to move wins if they have a threat they can play
+  size_t turn = board.getTurn();
+  if (board.getThreatMask(turn) & board.getLegalMask()) {
+    return turn ? O_WINS : X_WINS;
   }
+  return UNPROVEN;
 }
 
-float AgentMCTS::Node::uct(size_t parentN) const {
-  return q_ * (-1.0 + 2.0 * board_.getTurn()) / n_ +
-         C * sqrt(std::log(parentN) / n_);
+float AgentMCTS::proofValue(uint8_t proof) {
+  return proof == X_WINS ? 1 : proof == O_WINS ? -1 : 0;
 }
 
-bool AgentMCTS::Node::isFullyExplored() const { return unvisited_.size() == 0; }
+void AgentMCTS::updateProof(Arena& arena, uint32_t node, const Board& board) {
+  Node& cur = arena[node];
+  size_t turn = board.getTurn();
+  uint8_t win = turn ? O_WINS : X_WINS;
+  uint8_t best = turn ? X_WINS : O_WINS;
+  bool allProven = true;
+  Board::Mask legal = board.getLegalMask();
+  for (size_t col = 0; col < Board::WIDTH; ++col) {
+    if (!(legal & (Board::COLUMN_MASK << (col * Board::COLUMN_BITS)))) {
+      continue;
+    }
+
+    // A child which has not been added yet is not proven
+    uint32_t child = cur.children[col].load(std::memory_order_acquire);
+    uint8_t proof = UNPROVEN;
+    if (child) {
+      proof = arena[child].proof.load(std::memory_order_relaxed);
+    }
+    if (proof == win) {
+      cur.proof.store(win, std::memory_order_relaxed);
+      return;
+    } else if (proof == UNPROVEN) {
+      allProven = false;
+    } else if (proof == DRAW) {
+      best = DRAW;
+    }
+  }
 
-size_t AgentMCTS::Node::bestUCTChild() const {
-  size_t bestChild;
+  if (allProven) {
+    cur.proof.store(best, std::memory_order_relaxed);
+  }
+}
+
+float AgentMCTS::uct(float q, float n, size_t turn, size_t parentN) {
+  return q * (-1.0 + 2.0 * turn) / n + C * sqrt(std::log(parentN) / n);
+}
+
+size_t AgentMCTS::bestUCTChild(const Arena& arena, uint32_t node,
+                               const Board& board) const {
+  const Node& parent = arena[node];
+  const AmafCounter* amaf = raveEquivalence_ ? arena.amaf(node) : nullptr;
+  size_t parentN = parent.n.load(std::memory_order_relaxed);
+  size_t childTurn = 1 - board.getTurn();
+  float sign = -1.0 + 2.0 * childTurn;
+  size_t bestChild = NO_CHILD;
   float bestUCT = -2;
-  for (size_t i = 0; i < numChildren_; ++i) {
-    float curUCT = children_[i]->uct(n_);
-    if (curUCT > bestUCT) {
-      bestChild = i;
-      bestUCT = curUCT;
+  for (size_t col : Board::MOVE_ORDER) {
+    // Skip children which another thread has not finished adding
+    uint32_t child = parent.children[col].load(std::memory_order_acquire);
+    uint32_t n = child ? arena[child].n.load(std::memory_order_relaxed) : 0;
+    if (n && !arena[child].proof.load(std::memory_order_relaxed)) {
+      float q = arena[child].q.load(std::memory_order_relaxed);
+      float curUCT = uct(q, n, childTurn, parentN);
+
+      // Move a fraction beta of the child's mean reward towards its AMAF value
+      uint64_t counter = amaf ? amaf[col].load(std::memory_order_relaxed) : 0;
+      if (uint32_t amafN = counter >> 32) {
+        float amafMean =
+            static_cast<uint32_t>(counter) / static_cast<float>(amafN) - 1;
+        float beta =
+            std::sqrt(raveEquivalence_ / (3.0 * n + raveEquivalence_));
+        curUCT += beta * sign * (amafMean - q / n);
+      }
+      if (curUCT > bestUCT) {
+        bestChild = col;
+        bestUCT = curUCT;
+      }
     }
   }
 
   return bestChild;
 }
 
-float AgentMCTS::Node::traverse() {
-  float reward = 0;
+float AgentMCTS::playout(SearchThread& thread, Board& board) const {
+  // A batch leaves the board unchanged, so AMAF needs each game's own moves
+  if (raveEquivalence_) {
+    return thread.policy->playoutGames(board, thread.games.data());
+  }
+  return thread.policy->playout(board);
+}
+
+float AgentMCTS::provenReward(SearchThread& thread, const Board& board,
+                              uint8_t proof) const {
+  float reward = proofValue(proof);
+  if (raveEquivalence_) {
+    for (RolloutPolicy::Game& game : thread.games) {
+      game.masks[0] = board.getMask(0);
+      game.masks[1] = board.getMask(1);
+      game.reward = static_cast<int32_t>(reward);
+    }
+  }
+  return reward * thread.batchSize;
+}
+
+void AgentMCTS::updateAmaf(Arena& arena, uint32_t node, const Board& start,
+                           const RolloutPolicy::Game* games,
+                           uint32_t count) const {
+  AmafCounter* amaf = raveEquivalence_ ? arena.amaf(node) : nullptr;
+  if (!amaf) {
+    return;
+  }
+
+  // Count every move of the node which the player to move at the node played
+  // later in each game, whether in the tree or in the playout.  Only the
+  // position which the move would fill counts, not the rest of its column.
+  size_t turn = start.getTurn();
+  Board::Mask legal = start.getLegalMask();
+  uint64_t increments[Board::WIDTH] = {};
+  for (uint32_t i = 0; i < count; ++i) {
+    Board::Mask played = games[i].masks[turn] & legal;
+    for (size_t col = 0; col < Board::WIDTH; ++col) {
+      if (played & (Board::COLUMN_MASK << (col * Board::COLUMN_BITS))) {
+        increments[col] += (uint64_t{1} << 32) + games[i].reward + 1;
+      }
+    }
+  }
+  for (size_t col = 0; col < Board::WIDTH; ++col) {
+    if (increments[col]) {
+      amaf[col].fetch_add(increments[col], std::memory_order_relaxed);
+    }
+  }
+}
+
+AgentMCTS::RootStats AgentMCTS::mergeRootStats() const {
+  RootStats stats = {};
+  for (const std::unique_ptr<Arena>& arena : arenas_) {
+    if (!arena->size()) {
+      continue;
+    }
+
+    const Node& root = (*arena)[ROOT];
+    for (size_t col = 0; col < Board::WIDTH; ++col) {
+      uint32_t child = root.children[col].load(std::memory_order_acquire);
+      if (child) {
+        stats.n[col] += (*arena)[child].n.load(std::memory_order_relaxed);
+        stats.q[col] += (*arena)[child].q.load(std::memory_order_relaxed);
+        uint8_t proof = (*arena)[child].proof.load(std::memory_order_relaxed);
+        if (proof) {
+          stats.proof[col] = proof;
+        }
+      }
+    }
+    stats.rootN += root.n.load(std::memory_order_relaxed);
+    stats.numNodes += arena->size();
+  }
+  return stats;
+}
+
+size_t AgentMCTS::mostVisitedChild(const RootStats& stats, size_t turn) {
+  // Rank a proven win first, then unproven and drawn children, and a proven
+  // loss last, breaking ties by n
+  uint8_t win = turn ? O_WINS : X_WINS;
+  uint8_t loss = turn ? X_WINS : O_WINS;
+  size_t bestChild = NO_CHILD;
+  int bestRank = 0;
+  for (size_t col : Board::MOVE_ORDER) {
+    if (!stats.n[col]) {
+      continue;
+    }
+
+    int rank = stats.proof[col] == win ? 2 : stats.proof[col] == loss ? 0 : 1;
+    if (bestChild == NO_CHILD || rank > bestRank ||
+        (rank == bestRank && stats.n[col] > stats.n[bestChild])) {
+      bestChild = col;
+      bestRank = rank;
+    }
+  }
+
+  return bestChild;
+}
+
+bool AgentMCTS::findNode(const Arena& arena, const Board& board,
+                         uint32_t& node) const {
+  // The board is usually two moves (ours and the reply) below the last root
+  if (!hasTree_ || !arena.size()) {
+    return false;
+  }
+  if (board == lastBoard_) {
+    node = ROOT;
+    return true;
+  }
+
+  for (size_t col = 0; col < Board::WIDTH; ++col) {
+    uint32_t child = arena[ROOT].children[col].load(std::memory_order_relaxed);
+    if (!child) {
+      continue;
+    }
+
+    Board childBoard = lastBoard_;
+    childBoard.handleMove(col);
+    if (board == childBoard) {
+      node = child;
+      return true;
+    }
+
+    for (size_t reply = 0; reply < Board::WIDTH; ++reply) {
+      uint32_t grandchild =
+          arena[child].children[reply].load(std::memory_order_relaxed);
+      if (grandchild) {
+        Board grandchildBoard = childBoard;
+        grandchildBoard.handleMove(reply);
+        if (board == grandchildBoard) {
+          node = grandchild;
+          return true;
+        }
+      }
+    }
+  }
+  return false;
+}
+
+void AgentMCTS::promoteSubtree(size_t tree, uint32_t node) {
+  // Copy the subtree into the spare arena with node as its root, then swap
+  // the arenas so that the old tree becomes the spare
+  Arena& from = *arenas_[tree];
+  Arena& to = *spare_;
+  to.reset();
+  std::vector<std::pair<uint32_t, uint32_t>> stack;
+  stack.emplace_back(node,
+                     to.allocate(from[node].unvisited, from[node].proof));
+  while (!stack.empty()) {
+    uint32_t srcIndex = stack.back().first;
+    uint32_t dstIndex = stack.back().second;
+    const Node& src = from[srcIndex];
+    Node& dst = to[dstIndex];
+    stack.pop_back();
+
+    dst.q.store(src.q.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+    dst.n.store(src.n.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+    const AmafCounter* srcAmaf = from.amaf(srcIndex);
+    AmafCounter* dstAmaf = to.amaf(dstIndex);
+    if (srcAmaf && dstAmaf) {
+      for (size_t col = 0; col < Board::WIDTH; ++col) {
+        dstAmaf[col].store(srcAmaf[col].load(std::memory_order_relaxed),
+                           std::memory_order_relaxed);
+      }
+    }
+    for (size_t col = 0; col < Board::WIDTH; ++col) {
+      uint32_t child = src.children[col].load(std::memory_order_relaxed);
+      if (child) {
+        uint32_t copy =
+            to.allocate(from[child].unvisited, from[child].proof);
+        dst.children[col].store(copy, std::memory_order_relaxed);
+        stack.emplace_back(child, copy);
+      }
+    }
+  }
+  std::swap(arenas_[tree], spare_);
+}
+
+void AgentMCTS::initializeTree(size_t tree, SearchThread& thread,
+                               const Board& board) {
+  // Promote the node of the board in the previous tree to the root, or else
+  // start a new tree
+  uint32_t node;
+  if (reuseTree_ && findNode(*arenas_[tree], board, node)) {
+    if (node != ROOT) {
+      promoteSubtree(tree, node);
+    }
+  } else {
+    arenas_[tree]->reset();
+    newNode(*arenas_[tree], board);
+  }
+
+  // Perform an initial rollout on each child of the root which has none
+  thread.arena = arenas_[tree].get();
+  Node& root = (*thread.arena)[ROOT];
+  reusedPlayouts_ += root.n.load(std::memory_order_relaxed);
+  while (root.unvisited.load(std::memory_order_relaxed)) {
+    Board curBoard = board;
+    float reward = rollout(thread, ROOT, curBoard);
+    root.q += static_cast<int32_t>(reward);
+    root.n += thread.batchSize;
+    updateAmaf(*thread.arena, ROOT, board, thread.games.data(),
+               thread.batchSize);
+  }
+  updateProof(*thread.arena, ROOT, board);
+}
 
-  if (isFullyExplored()) {
-    if (numChildren_ == 0) {
-      // If node is terminal, use its reward
-      reward = board_.getReward();
+float AgentMCTS::traverse(SearchThread& thread, uint32_t node, Board& board) {
+  // Count a loss of every game of the rollout for the player who moved into
+  // this node until the rollout finishes, so that other threads prefer
+  // different nodes meanwhile
+  Arena& arena = *thread.arena;
+  Node& cur = arena[node];
+  Board start = board;
+  int32_t batchSize = thread.batchSize;
+  int32_t virtualLoss = board.getTurn() ? batchSize : -batchSize;
+  cur.n.fetch_add(batchSize, std::memory_order_relaxed);
+  cur.q.fetch_sub(virtualLoss, std::memory_order_relaxed);
+
+  float reward = 0;
+  uint8_t proof = cur.proof.load(std::memory_order_relaxed);
+  if (proof) {
+    // If the outcome of the node is proven, use it instead of a rollout
+    reward = provenReward(thread, board, proof);
+  } else if (cur.unvisited.load(std::memory_order_relaxed) == 0) {
+    size_t col = bestUCTChild(arena, node, board);
+    if (col != NO_CHILD) {
+      Board parent = board;
+      board.handleMove(col);
+      uint32_t child = cur.children[col].load(std::memory_order_relaxed);
+      reward = traverse(thread, child, board);
+      if (arena[child].proof.load(std::memory_order_relaxed)) {
+        updateProof(arena, node, parent);
+      }
     } else {
-      reward = children_[bestUCTChild()]->traverse();
+      // Every child may have been proven, and otherwise no child is ready
+      // yet, so roll out from this node instead
+      updateProof(arena, node, board);
+      proof = cur.proof.load(std::memory_order_relaxed);
+      reward = proof ? provenReward(thread, board, proof)
+                     : playout(thread, board);
     }
   } else {
     // If node is not fully explored, begin rollout here
-    reward = rollout();
+    reward = rollout(thread, node, board);
   }
 
-  // Update q_ and n_
-  q_ += reward;
-  ++n_;
+  // Replace the virtual loss with the reward
+  cur.q.fetch_add(static_cast<int32_t>(reward) + virtualLoss,
+                  std::memory_order_relaxed);
+  updateAmaf(arena, node, start, thread.games.data(), batchSize);
   return reward;
 }
 
-float AgentMCTS::Node::rollout() {
-  // Choose an unvisited child from which to rollout
-  Board curBoard = board_;
-  curBoard.handleMove(unvisited_.front());
-  unvisited_.pop();
+float AgentMCTS::rollout(SearchThread& thread, uint32_t node, Board& board) {
+  // Claim a random unvisited child from which to rollout
+  Arena& arena = *thread.arena;
+  Node& cur = arena[node];
+  uint8_t unvisited = cur.unvisited.load(std::memory_order_relaxed);
+  size_t col = NO_CHILD;
+  while (unvisited) {
+    uint8_t choice = unvisited;
+    for (size_t skip = thread.generator() % __builtin_popcount(unvisited);
+         skip; --skip) {
+      choice &= choice - 1;
+    }
+    col = __builtin_ctz(choice);
+    if (cur.unvisited.compare_exchange_weak(unvisited, unvisited & ~(1 << col),
+                                            std::memory_order_relaxed)) {
+      break;
+    }
+    col = NO_CHILD;
+  }
 
-  children_[numChildren_] = new Node(curBoard, true);
-  ++numChildren_;
+  // If another thread claimed the last child, roll out from this node
+  if (col == NO_CHILD) {
+    return playout(thread, board);
+  }
+  Board parent = board;
+  board.handleMove(col);
 
-  // Play with a random uniform strategy to completion
-  std::default_random_engine generator(
-      std::chrono::system_clock::now().time_since_epoch().count());
+  // Once the arena is full, the tree stops growing and the rollout simply
+  // begins at this node, leaving the child unvisited
+  uint32_t child = newNode(arena, board);
+  if (child) {
+    cur.children[col].store(child, std::memory_order_release);
+    if (arena[child].proof.load(std::memory_order_relaxed)) {
+      updateProof(arena, node, parent);
+    }
+  } else {
+    cur.unvisited.fetch_or(1 << col, std::memory_order_relaxed);
+  }
+
+  // Play with the rollout policy to completion
+  Board start = board;
+  float reward = playout(thread, board);
+  if (child) {
+    arena[child].q.fetch_add(static_cast<int32_t>(reward),
+                             std::memory_order_relaxed);
+    arena[child].n.fetch_add(thread.batchSize, std::memory_order_relaxed);
+    updateAmaf(arena, child, start, thread.games.data(), thread.batchSize);
+  }
+  return reward;
+}
+
+void AgentMCTS::search(SearchThread& thread, const Board& board,
+                       const std::chrono::system_clock::time_point& endTime,
+                       size_t maxPlayouts, size_t* move) {
+  Arena& arena = *thread.arena;
+  Node& root = arena[ROOT];
+  // Stop early once the outcome of the root is proven
+  while (std::chrono::system_clock::now() < endTime &&
+         (!maxPlayouts ||
+          root.n.load(std::memory_order_relaxed) < maxPlayouts) &&
+         !root.proof.load(std::memory_order_relaxed)) {
+    Board curBoard = board;
+    traverse(thread, ROOT, curBoard);
 
-  size_t move;
-  while (!(curBoard.isWon() || curBoard.isDraw())) {
-    ROLLOUT_AGENT.getMove(curBoard, move,
-                          std::chrono::system_clock::time_point::max());
-    curBoard.handleMove(move);
+    // Publish the move which would be chosen if time ran out now
+    if (move) {
+      bestChild_ = mostVisitedChild(mergeRootStats(), board.getTurn());
+      *move = bestChild_;
+    }
   }
+}
 
-  children_[numChildren_ - 1]->q_ += curBoard.getReward();
-  ++(children_[numChildren_ - 1]->n_);
-  return curBoard.getReward();
+std::ostream& AgentMCTS::printStats(std::ostream& os,
+                                    const Board& board) const {
+  RootStats stats = mergeRootStats();
+  size_t childTurn = 1 - board.getTurn();
+  for (size_t col = 0; col < Board::WIDTH; ++col) {
+    if (stats.n[col]) {
+      os << "Child (move " << col << "): n_=" << stats.n[col]
+         << " q_=" << stats.q[col] << " uct="
+         << uct(stats.q[col], stats.n[col], childTurn, stats.rootN);
+      if (stats.proof[col]) {
+        os << " proven="
+           << (stats.proof[col] == DRAW
+                   ? "draw"
+                   : proofValue(stats.proof[col]) == childTurn * 2.0 - 1.0
+                         ? "win"
+                         : "loss");
+      }
+      os << std::endl;
+    }
+  }
+  os << ">> Best Child: move " << bestChild_ << std::endl;
+  os << ">> Total Explorations: " << stats.rootN << " (" << stats.numNodes
+     << " nodes";
+  if (arenas_.size() > 1) {
+    os << " in " << arenas_.size() << " trees";
+  }
+  os << ")" << std::endl;
+  os << ">> Reused Explorations: " << reusedPlayouts_ << std::endl << std::endl;
+  return os;
 }
 
 /*******************************************************************************
- * AgentMCTS::Root Implementation
+ * AgentMCTS::Arena Implementation
  ******************************************************************************/
 
-AgentMCTS::Root::Root(const Board& board)
-    : Node(board, false), moves_{board.getSuccessors()}, bestChild_{0} {
-  // Perform initial rollout on each child
-  for (size_t i = 0; i < moves_.size(); ++i) {
-    q_ += rollout();
-    ++n_;
+AgentMCTS::Arena::Arena(size_t capacity)
+    : nodes_{new Node[capacity]}, capacity_{capacity}, size_{0} {}
+
+uint32_t AgentMCTS::Arena::allocate(uint8_t unvisited, uint8_t proof) {
+  size_t index = size_.fetch_add(1, std::memory_order_relaxed);
+  if (index >= capacity_) {
+    return 0;
   }
-}
 
-size_t AgentMCTS::Root::iterate() {
-  size_t child = bestUCTChild();
-  q_ += children_[child]->traverse();
-  ++n_;
+  if (amaf_) {
+    for (size_t col = 0; col < Board::WIDTH; ++col) {
+      amaf_[index * Board::WIDTH + col].store(0, std::memory_order_relaxed);
+    }
+  }
 
-  // bestChild_ is the child with the highest N
-  if (children_[child]->n_ > children_[bestChild_]->n_) {
-    bestChild_ = child;
+  Node& node = nodes_[index];
+  for (std::atomic<uint32_t>& child : node.children) {
+    child.store(0, std::memory_order_relaxed);
   }
+  node.q.store(0, std::memory_order_relaxed);
+  node.n.store(0, std::memory_order_relaxed);
+  node.unvisited.store(unvisited, std::memory_order_relaxed);
+  node.proof.store(proof, std::memory_order_relaxed);
+  return index;
+}
+
+void AgentMCTS::Arena::reset() { size_.store(0, std::memory_order_relaxed); }
+
+bool AgentMCTS::Arena::isFull() const {
+  return size_.load(std::memory_order_relaxed) >= capacity_;
+}
+
+size_t AgentMCTS::Arena::size() const {
+  return std::min(size_.load(std::memory_order_relaxed), capacity_);
+}
 
-  return moves_[bestChild_];
+AgentMCTS::Node& AgentMCTS::Arena::operator[](uint32_t index) {
+  return nodes_[index];
 }
 
-std::ostream& AgentMCTS::Root::printStats(std::ostream& os) {
-  for (size_t i = 0; i < numChildren_; ++i) {
-    os << "Child " << i << " (move " << moves_[i]
-       << "): n_=" << children_[i]->n_ << " q_=" << children_[i]->q_
-       << " uct=" << children_[i]->uct(n_) << std::endl;
+const AgentMCTS::Node& AgentMCTS::Arena::operator[](uint32_t index) const {
+  return nodes_[index];
+}
+
+void AgentMCTS::Arena::enableAmaf() {
+  if (!amaf_) {
+    amaf_.reset(new AmafCounter[capacity_ * Board::WIDTH]());
   }
-  os << ">> Best Child: " << bestChild_ << " (move " << moves_[bestChild_]
-     << ")" << std::endl;
-  os << ">> Total Explorations: " << n_ << std::endl << std::endl;
-  return os;
+}
+
+AgentMCTS::AmafCounter* AgentMCTS::Arena::amaf(uint32_t index) {
+  return amaf_ ? amaf_.get() + index * Board::WIDTH : nullptr;
+}
+
+const AgentMCTS::AmafCounter* AgentMCTS::Arena::amaf(uint32_t index) const {
+  return amaf_ ? amaf_.get() + index * Board::WIDTH : nullptr;
 }
@@ -8,134 +8,518 @@
 #ifndef AGENTS_AGENT_MCTS_HPP_
 #define AGENTS_AGENT_MCTS_HPP_
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <ostream>
-#include <queue>
 #include <random>
 #include <string>
 #include <vector>
-#include "agent-benchmark.hpp"
 #include "agent.hpp"
+#include "rollout-policy.hpp"
 
 /**
  * \class AgentMCTS
  * \brief An agent which uses Monte Carlo Tree Search
+ * \note The nodes of the tree live in an arena which is allocated once when
+ * the agent is created.  Nodes do not store their board: the board of a node
+ * is rebuilt by playing the moves from the root as the tree is traversed.
+ * \note The tree is kept between moves.  When the new board is in the tree
+ * (usually after our move and the opponent's reply), its subtree is promoted
+ * to the root and the rest of the tree is freed.
+ * \note The search also acts as a solver: a node whose outcome is certain
+ * (a finished game, an immediate win, or a node whose children prove it) is
+ * marked proven and is no longer sampled, and the search stops once the
+ * outcome of the root is proven.
+ * \note With several threads, the agent runs a tree-parallel or a
+ * root-parallel search (see ParallelMode).
+ * \note A rollout policy may play a batch of games from a leaf at once (see
+ * BatchRolloutPolicy).  Each game counts as one rollout in n and q, so the
+ * node's mean reward is the average of the batch.
  */
 class AgentMCTS : public Agent {
- private:
-  class Node;
-  class Root;
-
  public:
+  /** \brief The ways in which several threads can share a search */
+  enum ParallelMode {
+    /**
+     * \brief Every thread descends the same tree, adding a virtual loss to
+     * each node it passes through until its rollout finishes
+     */
+    TREE_PARALLEL,
+    /**
+     * \brief Every thread grows its own tree, and the statistics of the
+     * root's children are summed over the trees to choose the move
+     */
+    ROOT_PARALLEL
+  };
+
+  /** \brief The default number of nodes which the tree can hold */
+  static const size_t DEFAULT_MAX_NODES = 1 << 20;
+
+  /** \brief A RAVE equivalence which works well at short turn times */
+  static const size_t DEFAULT_RAVE_EQUIVALENCE = 10000;
+
+  AgentMCTS();
+
+  /**
+   * \brief Creates an MCTS agent whose tree holds a fixed number of nodes
+   * \param maxNodes    The number of nodes in the arena
+   * \param rollout     The policy used to play out games from new nodes
+   * \param numThreads  The number of threads searching
+   * \param parallelMode How the threads share the search
+   * \note Once the arena is full, the tree stops growing and rollouts begin
+   * at its leaves.  With ROOT_PARALLEL, the nodes are divided evenly between
+   * the trees.
+   */
+  explicit AgentMCTS(size_t maxNodes,
+                     RolloutPolicy::Type rollout = RolloutPolicy::RANDOM,
+                     size_t numThreads = 1,
+                     ParallelMode parallelMode = TREE_PARALLEL);
+
   void getMove(const Board& board, size_t& move,
                const std::chrono::system_clock::time_point& endTime) override;
   std::string getAgentName() const override;
 
- private:
   /**
-   * \class Node
-   * \brief Represents a node in the MCTS tree
+   * \brief Returns the number of rollouts performed by the last call to getMove
+   * \returns The number of rollouts, summed over all threads
    */
-  class Node {
-    friend class Root;
+  size_t getPlayoutCount() const;
 
-   public:
-    /** \brief The value of the turning parameter C used in the UCT equation */
-    static const float C;
+  /**
+   * \brief Returns the number of rollouts kept from the previous move
+   * \returns The number of rollouts through the root which were reused by the
+   * last call to getMove, summed over all trees
+   */
+  size_t getReusedPlayoutCount() const;
 
-    Node() = delete;
-    Node(const Node& other) = delete;
-    Node(const Board& board, bool randomizeVisitOrder);
-    ~Node();
-    Node& operator=(const Node& other) = delete;
+  /**
+   * \brief Returns the memory used by the nodes currently in the trees
+   * \returns The size of the nodes in bytes
+   */
+  size_t getMemoryBytes() const;
 
-   protected:
-    /** \brief The board state which the node represents */
-    Board board_;
+  /**
+   * \brief Limits the number of rollouts performed by each call to getMove
+   * \param maxPlayouts   The number of rollouts after which getMove returns
+   * even if time remains (0 for no limit)
+   * \note With ROOT_PARALLEL, the rollouts are divided evenly between the trees
+   */
+  void setPlayoutLimit(size_t maxPlayouts);
 
-    /** \brief The children of the node which have not yet been visited */
-    std::queue<size_t> unvisited_;
+  /**
+   * \brief Sets whether the tree is kept between calls to getMove
+   * \param reuseTree   True to reuse the subtree of the new board (default),
+   * or false to start a new tree for every move
+   */
+  void setTreeReuse(bool reuseTree);
 
-    /** \brief Pointers to the children of the node */
-    Node* children_[7];
+  /**
+   * \brief Blends all-moves-as-first (AMAF) statistics into selection (RAVE)
+   * \param equivalence   The number of rollouts k of a child at which its
+   * AMAF value and its own value are weighted so that beta = 1/2 (0 disables
+   * RAVE, which is the default)
+   * \note The AMAF value of a child is the mean reward of every rollout
+   * through its parent in which the player to move at the parent played in
+   * the child's column at any later point.  It replaces a fraction
+   * beta = sqrt(k / (3n + k)) of the child's own mean reward, so it dominates
+   * while the child has few rollouts and fades as n grows.
+   * \note Enabling RAVE adds one 8-byte counter per column to every node
+   */
+  void setRave(size_t equivalence);
 
-    /** \brief The number of children of the node */
-    size_t numChildren_;
+ private:
+  /** \brief The proven outcome of a node */
+  enum Proof : uint8_t {
+    /** \brief The outcome is not yet known */
+    UNPROVEN = 0,
+    /** \brief X wins with perfect play */
+    X_WINS = 1,
+    /** \brief O wins with perfect play */
+    O_WINS = 2,
+    /** \brief The game is a draw with perfect play */
+    DRAW = 3
+  };
+
+  /**
+   * \struct Node
+   * \brief Represents a node in the MCTS tree
+   */
+  struct Node {
+    /** \brief The arena index of the child for each column (0 if none) */
+    std::atomic<uint32_t> children[Board::WIDTH];
 
     /** \brief The total sum of rewards from rollouts which touched this node */
-    float q_;
+    std::atomic<int32_t> q;
 
     /** \brief The total number of rollouts which touched this node */
-    size_t n_;
+    std::atomic<uint32_t> n;
+
+    /** \brief A bitmask of the columns whose children have not been visited */
+    std::atomic<uint8_t> unvisited;
+
+    /** \brief The proven outcome of the node (a Proof) */
+    std::atomic<uint8_t> proof;
+  };
+
+  /**
+   * \brief The AMAF statistics of one column of a node, packed so that a
+   * rollout updates both with a single atomic add
+   * \note The upper 32 bits count the rollouts and the lower 32 bits sum the
+   * rewards plus 1 (so that each adds 0, 1 or 2)
+   */
+  typedef std::atomic<uint64_t> AmafCounter;
+
+  /**
+   * \class Arena
+   * \brief A fixed-capacity block of nodes which are allocated in order
+   * \note Since the root is always allocated first, index 0 is never a child
+   * and marks a missing child.  Nodes can be allocated by several threads at
+   * once.
+   */
+  class Arena {
+   public:
+    Arena() = delete;
+    Arena(const Arena& other) = delete;
 
     /**
-     * \brief Calculates the UCT value of the node
-     * \param parentN   The n value of the parent of this node
-     * \returns The UCT value for the node
-     * \note The UCT value is adjusted based on player so that more positive is
-     * always better, even though the min player prefers negative reward
+     * \brief Creates an empty arena
+     * \param capacity    The number of nodes the arena can hold
      */
-    float uct(size_t parentN) const;
+    explicit Arena(size_t capacity);
+
+    ~Arena() = default;
+    Arena& operator=(const Arena& other) = delete;
 
     /**
-     * \brief Determines whether all the children of the node have been visited
-     * \returns True if all of the children of this node have been visited
+     * \brief Allocates a node with no children or statistics
+     * \param unvisited   The columns of the node's legal moves
+     * \param proof       The proven outcome of the node
+     * \returns The index of the new node, or 0 if the arena is full
      */
-    bool isFullyExplored() const;
+    uint32_t allocate(uint8_t unvisited, uint8_t proof);
 
     /**
-     * \brief Determines the child with the highest UCT value
-     * \returns The index of the child with the highest UCT value
+     * \brief Frees every node in the arena at once
      */
-    size_t bestUCTChild() const;
+    void reset();
 
     /**
-     * \brief Traverses to the best UCT child and updates all statistics
-     * \returns The reward of the subsequent rollout
+     * \brief Determines whether every node of the arena has been allocated
+     * \returns True if no more nodes can be allocated
      */
-    float traverse();
+    bool isFull() const;
 
     /**
-     * \brief Performs a rollout starting at this node
-     * \returns The value (reward) of the state at which the rollout terminates
+     * \brief Returns the number of nodes which have been allocated
+     * \returns The number of nodes in the arena
      */
-    float rollout();
-  };
+    size_t size() const;
 
-  /**
-   * \class Root
-   * \brief Represents the root of the MCTS tree
-   */
-  class Root : public Node {
-   public:
-    Root() = delete;
-    Root(const Root& other) = delete;
-    explicit Root(const Board& board);
-    ~Root() = default;
-    Root& operator=(const Root& other) = delete;
+    /**
+     * \brief Accesses an allocated node
+     * \param index   The index of the node
+     * \returns A reference to the node
+     */
+    Node& operator[](uint32_t index);
+    const Node& operator[](uint32_t index) const;
 
     /**
-     * \brief Performs a traversal from the root and updates all statistics
-     * \returns The current best move after the rollout has completed
+     * \brief Allocates the AMAF counters of every node (if not yet allocated)
      */
-    size_t iterate();
+    void enableAmaf();
 
     /**
-     * \brief Prints a summary of the MCTS statistics for this turn
-     * \param os    The output stream to which to print the statistics
-     * \returns The output stream which was passed in
+     * \brief Accesses the AMAF counters of an allocated node
+     * \param index   The index of the node
+     * \returns The node's counters (one per column), or null if AMAF
+     * counters have not been enabled
      */
-    std::ostream& printStats(std::ostream& os);
+    AmafCounter* amaf(uint32_t index);
+    const AmafCounter* amaf(uint32_t index) const;
 
    private:
-    /** \brief The valid moves which can be taken from this board state */
-    std::vector<size_t> moves_;
+    /** \brief The nodes of the arena, stored contiguously */
+    std::unique_ptr<Node[]> nodes_;
+
+    /** \brief The AMAF counters, Board::WIDTH per node (or null) */
+    std::unique_ptr<AmafCounter[]> amaf_;
+
+    /** \brief The number of nodes the arena can hold */
+    size_t capacity_;
+
+    /** \brief The number of nodes which have been allocated */
+    std::atomic<size_t> size_;
+  };
+
+  /**
+   * \struct SearchThread
+   * \brief The state private to one thread searching a tree
+   */
+  struct SearchThread {
+    /**
+     * \brief Creates the state of a searching thread
+     * \param arena     The tree searched by the thread
+     * \param seed      The seed of the thread's random number generators
+     * \param rollout   The rollout policy used by the thread
+     */
+    SearchThread(Arena* arena, uint64_t seed, RolloutPolicy::Type rollout);
+
+    /** \brief The tree searched by the thread */
+    Arena* arena;
+
+    /** \brief Chooses the order in which unvisited children are visited */
+    std::default_random_engine generator;
+
+    /** \brief Plays out games from new nodes */
+    std::unique_ptr<RolloutPolicy> policy;
+
+    /** \brief The number of games played by each rollout of the policy */
+    uint32_t batchSize;
+
+    /** \brief Where the games of the latest rollout stopped, kept for RAVE */
+    std::vector<RolloutPolicy::Game> games;
+  };
+
+  /** \brief The value of the turning parameter C used in the UCT equation */
+  static const float C;
+
+  /** \brief The index of the root node in the arena */
+  static const uint32_t ROOT = 0;
+
+  /**
+   * \struct RootStats
+   * \brief The statistics of the root's children, summed over every tree
+   */
+  struct RootStats {
+    /** \brief The total number of rollouts which touched each child */
+    uint64_t n[Board::WIDTH];
 
-    /** \brief The child with the highest n value (the move to return) */
-    size_t bestChild_;
+    /** \brief The total sum of rewards of each child */
+    int64_t q[Board::WIDTH];
+
+    /** \brief The proven outcome of each child (proven in any tree) */
+    uint8_t proof[Board::WIDTH];
+
+    /** \brief The total number of rollouts which touched the root */
+    uint64_t rootN;
+
+    /** \brief The total number of nodes in every tree */
+    size_t numNodes;
   };
 
-  /** \brief The agent used to choose moves during rollouts */
-  static AgentBenchmark ROLLOUT_AGENT;
+  /** \brief Returned by bestUCTChild when a node has no children yet */
+  static const size_t NO_CHILD = Board::WIDTH;
+
+  /** \brief The nodes of each tree (one per thread with ROOT_PARALLEL) */
+  std::vector<std::unique_ptr<Arena>> arenas_;
+
+  /** \brief The rollout policy used by every thread */
+  RolloutPolicy::Type rollout_;
+
+  /** \brief The number of threads searching */
+  size_t numThreads_;
+
+  /** \brief How the threads share the search */
+  ParallelMode parallelMode_;
+
+  /** \brief The number of rollouts after which to stop (0 for no limit) */
+  size_t maxPlayouts_;
+
+  /** \brief True if the tree is kept between calls to getMove */
+  bool reuseTree_;
+
+  /** \brief The RAVE equivalence k (0 if RAVE is disabled) */
+  size_t raveEquivalence_;
+
+  /** \brief The arena into which a reused subtree is copied */
+  std::unique_ptr<Arena> spare_;
+
+  /** \brief The board at the root of the trees of the last move */
+  Board lastBoard_;
+
+  /** \brief True if the trees hold the search of lastBoard_ */
+  bool hasTree_;
+
+  /** \brief The number of rollouts kept from the previous move */
+  size_t reusedPlayouts_;
+
+  /** \brief Seeds the random number generators of the searching threads */
+  std::default_random_engine seeder_;
+
+  /** \brief The column of the root's child with the highest n */
+  size_t bestChild_;
+
+  /**
+   * \brief Allocates a node for a board state
+   * \param arena   The arena from which to allocate the node
+   * \param board   The board state which the node represents
+   * \returns The index of the new node, or 0 if the arena is full
+   */
+  static uint32_t newNode(Arena& arena, const Board& board);
+
+  /**
+   * \brief Determines the outcome of a board which is certain without search
+   * \param board   The board state to prove
+   * \returns The proven outcome if the game is over or the player to move
+   * can win immediately, and UNPROVEN otherwise
+   */
+  static uint8_t proveBoard(const Board& board);
+
+  /**
+   * \brief Converts a proven outcome into a reward
+   * \param proof   The proven outcome
+   * \returns 1 if X wins, -1 if O wins, and 0 otherwise
+   */
+  static float proofValue(uint8_t proof);
+
+  /**
+   * \brief Marks a node proven if its children prove its outcome
+   * \param arena   The tree containing the node
+   * \param node    The index of the node
+   * \param board   The board state which the node represents
+   * \note A node is a win for the player to move if any child is, and is
+   * otherwise proven once every child is proven
+   */
+  static void updateProof(Arena& arena, uint32_t node, const Board& board);
+
+  /**
+   * \brief Calculates the UCT value of a node
+   * \param q         The total reward of the node
+   * \param n         The number of rollouts which touched the node
+   * \param turn      The player whose turn it is at the node
+   * \param parentN   The n value of the parent of the node
+   * \returns The UCT value for the node
+   * \note The UCT value is adjusted based on player so that more positive is
+   * always better, even though the min player prefers negative reward
+   */
+  static float uct(float q, float n, size_t turn, size_t parentN);
+
+  /**
+   * \brief Determines the child with the highest UCT value
+   * \param arena   The tree containing the node
+   * \param node    The index of the node whose children are considered
+   * \param board   The board state which the node represents
+   * \returns The column of the child with the highest UCT value, or NO_CHILD
+   * if no unproven child has finished its first rollout
+   * \note With RAVE, the mean reward in the UCT value of each child is
+   * blended with its AMAF value
+   */
+  size_t bestUCTChild(const Arena& arena, uint32_t node,
+                      const Board& board) const;
+
+  /**
+   * \brief Plays out the games of a rollout with a thread's policy
+   * \param thread  The searching thread
+   * \param board   The board state at which to begin (modified)
+   * \returns The summed reward of the rollout's games
+   * \note With RAVE, records every game in thread.games
+   */
+  float playout(SearchThread& thread, Board& board) const;
+
+  /**
+   * \brief Uses the proven outcome of a node as the reward of a rollout
+   * \param thread  The searching thread
+   * \param board   The board state which the node represents
+   * \param proof   The proven outcome of the node
+   * \returns The summed reward of the rollout's games
+   * \note With RAVE, records every game as stopping at board in thread.games
+   */
+  float provenReward(SearchThread& thread, const Board& board,
+                     uint8_t proof) const;
+
+  /**
+   * \brief Adds a rollout to the AMAF statistics of a node
+   * \param arena   The tree containing the node
+   * \param node    The index of the node
+   * \param start   The board state which the node represents
+   * \param games   Where each of the rollout's games stopped
+   * \param count   The number of games in the rollout
+   * \note Does nothing unless RAVE is enabled
+   */
+  void updateAmaf(Arena& arena, uint32_t node, const Board& start,
+                  const RolloutPolicy::Game* games, uint32_t count) const;
+
+  /**
+   * \brief Sums the statistics of the root's children over every tree
+   * \returns The merged statistics
+   */
+  RootStats mergeRootStats() const;
+
+  /**
+   * \brief Determines the child of the root to play
+   * \param stats   The merged statistics of the root's children
+   * \param turn    The player whose turn it is at the root
+   * \returns The column of a proven win if there is one, and otherwise of
+   * the child with the highest n which is not a proven loss
+   */
+  static size_t mostVisitedChild(const RootStats& stats, size_t turn);
+
+  /**
+   * \brief Finds the node of a board in the tree of the previous move
+   * \param arena   The tree of the previous move
+   * \param board   The board to find
+   * \param node    The index of the board's node (output)
+   * \returns True if the board is the root, a child or a grandchild
+   */
+  bool findNode(const Arena& arena, const Board& board, uint32_t& node) const;
+
+  /**
+   * \brief Makes a node the root of its tree and frees the rest of the tree
+   * \param tree    The index of the tree in arenas_
+   * \param node    The index of the node to promote
+   */
+  void promoteSubtree(size_t tree, uint32_t node);
+
+  /**
+   * \brief Prepares the root of a tree and performs a rollout from each child
+   * which has not been visited
+   * \param tree    The index of the tree in arenas_
+   * \param thread  The state of a thread searching the tree (its arena is set
+   * to the tree)
+   * \param board   The board state which the root represents
+   */
+  void initializeTree(size_t tree, SearchThread& thread, const Board& board);
+
+  /**
+   * \brief Traverses to the best UCT child and updates all statistics
+   * \param thread  The state of the searching thread
+   * \param node    The index of the node at which to begin
+   * \param board   The board state which the node represents (modified)
+   * \returns The reward of the subsequent rollout
+   */
+  float traverse(SearchThread& thread, uint32_t node, Board& board);
+
+  /**
+   * \brief Adds an unvisited child to a node and performs a rollout from it
+   * \param thread  The state of the searching thread
+   * \param node    The index of the node to expand
+   * \param board   The board state which the node represents (modified)
+   * \returns The value (reward) of the state at which the rollout terminates
+   */
+  float rollout(SearchThread& thread, uint32_t node, Board& board);
+
+  /**
+   * \brief Performs traversals from the root until time is up
+   * \param thread    The state of the searching thread
+   * \param board     The board state which the root represents
+   * \param endTime   The time at which to stop
+   * \param maxPlayouts   The number of rollouts from the root after which to
+   * stop (0 for no limit)
+   * \param move      Where to publish the current best move (or null)
+   */
+  void search(SearchThread& thread, const Board& board,
+              const std::chrono::system_clock::time_point& endTime,
+              size_t maxPlayouts, size_t* move);
+
+  /**
+   * \brief Prints a summary of the MCTS statistics for this turn
+   * \param os      The output stream to which to print the statistics
+   * \param board   The board state which the root represents
+   * \returns The output stream which was passed in
+   * \note With ROOT_PARALLEL, the statistics are summed over every tree
+   */
+  std::ostream& printStats(std::ostream& os, const Board& board) const;
 };
 
 #endif  // AGENTS_AGENT_MCTS_HPP_
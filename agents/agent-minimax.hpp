@@ -2,74 +2,134 @@
  * \file agent-minimax.hpp
  * \copyright Matthew Calligaro
  * \date December 2019
- * \brief Declares the AgentMinimax class
+ * \brief Declares and implements the BasicAgentMinimax class template
  */
 
 #ifndef AGENTS_AGENT_MINIMAX_HPP_
 #define AGENTS_AGENT_MINIMAX_HPP_
 
+#include <array>
 #include <string>
-#include <unordered_map>
-#include "agent.hpp"
+#include "agent-negamax.hpp"
 
 /**
- * \class AgentMinimax
+ * \struct ThreatHeuristic
+ * \brief Values a board by the threats of each player
+ */
+struct ThreatHeuristic {
+  /**
+   * \brief Estimates the value of a board for the player to move
+   * \param board   The board state to evaluate
+   * \return The square of the threats of the player to move less the square
+   * of the threats of the opponent
+   */
+  template <typename B>
+  int evaluate(const B &board) const;
+};
+
+/**
+ * \class BasicAgentMinimax
  * \brief An agent using depth-limited heuristic eval minimax search
- * \note The agent has 3 flags which enable different optimizations:
- * AB_PRUNING: Use alpha-beta pruning
- * MEMOIZE: Use memoization
- * ITERATIVE_DEEPENING: Use iterative deepening search
+ * \tparam B  The board type searched
+ * \note The search is AgentNegamax with ThreatHeuristic
  */
-class AgentMinimax : public Agent {
+template <typename B>
+class BasicAgentMinimax : public AgentNegamax<ThreatHeuristic, B> {
  public:
-  AgentMinimax();
+  /** \brief The ways in which several threads can share a search */
+  typedef typename AgentNegamax<ThreatHeuristic, B>::ParallelMode
+      ParallelMode;
+
+  BasicAgentMinimax();
 
   /**
    * \brief Creates a minimax agent with a specified first max depth
    * \param firstDepth    The first maximum depth used by the agent
-   * \note If the IDS flag is true, the agent will repeat search with depth
-   * greater than firstDepth until time is up.  If the IDS flag is false, the
-   * agent will return after completing search with max depth of firstDepth.
+   * \note The agent will return after completing search with max depth of
+   * firstDepth
+   */
+  explicit BasicAgentMinimax(size_t firstDepth);
+
+  /**
+   * \brief Creates a minimax agent with a specified transposition table size
+   * \param firstDepth    The first maximum depth used by the agent
+   * \param tableBytes    The memory budget of the transposition table (0 to
+   * disable the table)
    */
-  explicit AgentMinimax(size_t firstDepth);
+  BasicAgentMinimax(size_t firstDepth, size_t tableBytes);
 
-  void getMove(const Board &board, size_t &move,
-               const std::chrono::system_clock::time_point &endTime) override;
+  /**
+   * \brief Creates a minimax agent which may use iterative deepening
+   * \param firstDepth          The first maximum depth used by the agent
+   * \param tableBytes          The memory budget of the transposition table
+   * \param iterativeDeepening  True to use iterative deepening search
+   * \param numThreads          The number of threads searching in parallel
+   * \param parallelMode        How the threads share the search
+   * \note With iterative deepening, the agent will repeat search with depth
+   * greater than firstDepth until time is up or the game is decided, and
+   * publishes the move of each search as soon as it completes
+   * \note With LAZY_SMP, helper threads run the same search with varied
+   * depths and move orders, sharing results through the transposition table.
+   * With YBWC (Young Brothers Wait Concept), every node at least
+   * MIN_SPLIT_DEPTH from the leaves searches its first child alone and then
+   * hands its other children to a work-stealing pool.  Either way, the
+   * heuristic must be safe to call concurrently when numThreads > 1.
+   */
+  BasicAgentMinimax(
+      size_t firstDepth, size_t tableBytes, bool iterativeDeepening,
+      size_t numThreads = 1,
+      ParallelMode parallelMode = AgentNegamax<ThreatHeuristic, B>::LAZY_SMP);
 
   std::string getAgentName() const override;
+};
 
- protected:
-  /** \brief The amount to reduce the reward of subsequent states */
-  static const float constexpr DISCOUNT = 0.999;
+/** \brief A minimax agent for the standard board */
+typedef BasicAgentMinimax<Board> AgentMinimax;
 
-  /** \brief The maximum discount that a state can receive */
-  static const float constexpr MAX_DISCOUNT = 0.95;  // less than DISCOUNT^42
+////////////////////////////////////////////////////////////////////////////////
+// Implementation
+////////////////////////////////////////////////////////////////////////////////
 
-  /** \brief The weight of a single threat in the heuristic eval function */
-  static const float constexpr THREAT_WEIGHT = 0.001;
+template <typename B>
+int ThreatHeuristic::evaluate(const B &board) const {
+  std::array<size_t, 2> threatCount = board.getThreatCount();
+  size_t mine = threatCount[board.getTurn()];
+  size_t theirs = threatCount[!board.getTurn()];
+  return static_cast<int>(mine * mine) - static_cast<int>(theirs * theirs);
+}
 
-  /** \brief The first maximum depth at which to begin searching */
-  size_t firstDepth_;
+template <typename B>
+BasicAgentMinimax<B>::BasicAgentMinimax() : BasicAgentMinimax(12) {}
 
-  /** \brief A memoization table storing minimax values of previous boards */
-  std::unordered_map<Board, float, BoardHasher> memo_;
+template <typename B>
+BasicAgentMinimax<B>::BasicAgentMinimax(size_t firstDepth)
+    : BasicAgentMinimax(firstDepth,
+                        AgentNegamax<ThreatHeuristic, B>::DEFAULT_TABLE_BYTES) {
+}
 
-  /**
-   * \brief Calculates the minimax value of a board state
-   * \param board   The board state to evaluate
-   * \param depth   The additional depth to search past this state
-   * \param alpha   The largest max value seen so far (for ab-pruning)
-   * \param beta    The smallest min value seen so far (for ab-pruning)
-   * \return The minimax (or estimated minimax) value of the state
-   */
-  float minimax(Board board, size_t depth, float alpha, float beta);
+template <typename B>
+BasicAgentMinimax<B>::BasicAgentMinimax(size_t firstDepth, size_t tableBytes)
+    : BasicAgentMinimax(firstDepth, tableBytes, false) {}
 
-  /**
-   * \brief The heuristic evaluation function used to evaluate a board state
-   * \param board   The board state to evaluate
-   * \return The estimated minimax value of board
-   */
-  virtual float heuristic(const Board &board);
-};
+template <typename B>
+BasicAgentMinimax<B>::BasicAgentMinimax(size_t firstDepth, size_t tableBytes,
+                                        bool iterativeDeepening,
+                                        size_t numThreads,
+                                        ParallelMode parallelMode)
+    : AgentNegamax<ThreatHeuristic, B>(ThreatHeuristic(), firstDepth,
+                                       tableBytes, iterativeDeepening,
+                                       numThreads, parallelMode) {}
+
+template <typename B>
+std::string BasicAgentMinimax<B>::getAgentName() const {
+  return "Minimax";
+}
+
+extern template class AgentNegamax<ThreatHeuristic, Board>;
+extern template class BasicAgentMinimax<Board>;
+extern template class AgentNegamax<ThreatHeuristic, BasicBoard<8, 7, 4>>;
+extern template class BasicAgentMinimax<BasicBoard<8, 7, 4>>;
+extern template class AgentNegamax<ThreatHeuristic, BasicBoard<9, 7, 5>>;
+extern template class BasicAgentMinimax<BasicBoard<9, 7, 5>>;
 
 #endif  // AGENTS_AGENT_MINIMAX_HPP_
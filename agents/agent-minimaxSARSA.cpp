@@ -8,107 +8,42 @@
 
 #include "agent-minimaxSARSA.hpp"
 #include <algorithm>
-#include <array>
+#include <cmath>
 #include <string>
 #include <vector>
 #include "../mc-train.hpp"
-#include "../sarsa-train.hpp"
 
-using std::array;
 using std::vector;
 
-AgentMinimaxSARSA::AgentMinimaxSARSA(size_t depth, vector<double> theta)
-    : AgentMinimaxSARSA(depth, 0.99, theta) {}
-
-AgentMinimaxSARSA::AgentMinimaxSARSA(size_t firstDepth, float discount,
-                                     vector<double> theta)
-    : firstDepth_{firstDepth},
-      discount_{discount},
-      theta{theta} {}
-
-void AgentMinimaxSARSA::getMove(
-    const Board &board, size_t &move,
-    const std::chrono::system_clock::time_point &endTime) {
-  size_t turn = board.getTurn();
-  size_t depth = firstDepth_;
-  vector<size_t> moves = board.getSuccessors();
-  size_t bestMove = 3;
-  float bestSucMinimax = -256 + (turn * 512.0);
-  float alpha = -256;
-  float beta = 256;
-
-  // Find the best move
-  for (size_t move : moves) {
-    // Calculate the minimax of the successor state
-    Board sucBoard = board;
-    sucBoard.handleMove(move);
-    float sucMinimax = minimax(sucBoard, depth - 1, alpha, beta);
-
-    // If this successor is the best so far, update values
-    if (!turn && sucMinimax > bestSucMinimax) {
-      bestMove = move;
-      bestSucMinimax = sucMinimax;
-      alpha = std::max(alpha, bestSucMinimax);
-    } else if (turn && sucMinimax < bestSucMinimax) {
-      bestMove = move;
-      bestSucMinimax = sucMinimax;
-      beta = std::min(beta, bestSucMinimax);
-    }
-
-    // If alpha > beta, do not explore any further
-    if (alpha >= beta) {
-      break;
-    }
+QValueHeuristic::QValueHeuristic(const vector<double> &theta, float discount)
+    : theta{theta}, scale(Board::SIZE + 1) {
+  scale[0] = Q_SCALE;
+  for (size_t i = 1; i < scale.size(); ++i) {
+    scale[i] = scale[i - 1] * discount;
   }
-
-  move = bestMove;
 }
 
-std::string AgentMinimaxSARSA::getAgentName() const { return "MinimaxSARSA"; }
-
-float AgentMinimaxSARSA::minimax(Board board, size_t depth, float alpha,
-                                 float beta) {
-  size_t turn = board.getTurn();
-  // Return 1 if X won, -1 if O won, or O if it is a draw
-  if (board.isWon()) {
-    return static_cast<float>(turn << 1) - 1;
-  }
-  if (board.isDraw()) {
-    return 0;
-  }
-
-  // If we reached max depth, use our heuristic to estimate the minimax
-  if (depth == 0) {
-    return heuristic(board);
-  }
+int QValueHeuristic::evaluate(const Board &board) const {
+  // The Q value is the value for X
+  double q =
+      MonteCarloTrain::getQValue(board, theta) * scale[board.getNumMoves()];
+  q = std::max<double>(std::min<double>(q, negamax::MAX_EVAL),
+                       -negamax::MAX_EVAL);
+  return static_cast<int>(std::lround(board.getTurn() ? -q : q));
+}
 
-  // Find the best successor
-  vector<size_t> moves = board.getSuccessors();
-  float bestSucMinimax = -256 + (turn * 512.0);
-  for (size_t move : moves) {
-    // Calculate the minimax of the successor state
-    Board sucBoard = board;
-    sucBoard.handleMove(move);
-    float sucMinimax = discount_ * minimax(sucBoard, depth - 1, alpha, beta);
+template class AgentNegamax<QValueHeuristic>;
 
-    // If this successor is the best so far, update values
-    if (!turn && sucMinimax > bestSucMinimax) {
-      bestSucMinimax = sucMinimax;
-      alpha = std::max(alpha, bestSucMinimax);
-    } else if (turn && sucMinimax < bestSucMinimax) {
-      bestSucMinimax = sucMinimax;
-      beta = std::min(beta, bestSucMinimax);
-    }
+AgentMinimaxSARSA::AgentMinimaxSARSA(size_t depth, vector<double> theta,
+                                     size_t numThreads,
+                                     ParallelMode parallelMode)
+    : AgentMinimaxSARSA(depth, DEFAULT_DISCOUNT, theta, numThreads,
+                        parallelMode) {}
 
-    // If alpha > beta, do not explore any further
-    if (alpha >= beta) {
-      break;
-    }
-  }
+AgentMinimaxSARSA::AgentMinimaxSARSA(size_t depth, float discount,
+                                     vector<double> theta, size_t numThreads,
+                                     ParallelMode parallelMode)
+    : AgentNegamax(QValueHeuristic(theta, discount), depth,
+                   DEFAULT_TABLE_BYTES, false, numThreads, parallelMode) {}
 
-  return bestSucMinimax;
-}
-
-float AgentMinimaxSARSA::heuristic(const Board &board) const {
-  return MonteCarloTrain::getQValue(board, theta);
-}
+std::string AgentMinimaxSARSA::getAgentName() const { return "MinimaxSARSA"; }
@@ -11,66 +11,87 @@
 
 #include <string>
 #include <vector>
-#include "agent.hpp"
+#include "agent-negamax.hpp"
 
 using std::vector;
 
 /**
- * \class AgentMinimaxSARSA
- * \brief An agent that can be used to perform Linear Q Learning 
- * and Linear Monte Carlo with Minimax
- */ 
-class AgentMinimaxSARSA : public Agent {
- public:
+ * \struct QValueHeuristic
+ * \brief Values a board by its Q value under learned feature weights
+ */
+struct QValueHeuristic {
   /**
-   * \brief Creates a minimax SARSA Agent with the learned depths
-   * \param depth the Depth the agent should go to. 
-   * \param theta  The learned weights for the feature grid.
+   * \brief Creates a heuristic from learned weights
+   * \param theta     The learned weights for the feature grid.
+   * \param discount  The discount factor applied to the Q value once for
+   * every piece on the board
    */
-  AgentMinimaxSARSA(size_t depth, vector<double> theta);
-  /**
-   * \brief Creates a minimax + Q or MC Agent with the learned depths
-   * \param firstDepth  The first maximum depth used by the agent
-   * \param discount  The discount factor
-   * \param theta  The learned weights for the feature grid.
-   */ 
-  AgentMinimaxSARSA(size_t firstDepth, float discount,
-                    vector<double> theta);
+  explicit QValueHeuristic(const vector<double> &theta, float discount = 1);
+
   /**
-   * \brief gets Agent's next move by extracting features and learning weights. 
-   */                   
-  void getMove(const Board &board, size_t &move,
-               const std::chrono::system_clock::time_point &endTime) override;
-  std::string getAgentName() const override;
+   * \brief Estimates the value of a board for the player to move
+   * \param board   The board state to evaluate
+   * \return The Q value of the board (see MonteCarloTrain::getQValue),
+   * discounted by its number of pieces, in units of 1 / Q_SCALE
+   * \note Discounting by the number of pieces orders the leaves of one
+   * search like discounting each ply below the root, since the two differ by
+   * the same positive factor for every leaf
+   */
+  int evaluate(const Board &board) const;
+
+  /** \brief The heuristic value of a Q value of 1, the reward of a win */
+  static const int Q_SCALE = 1000;
 
- private:
-  /** 
-   * \brief Depth of minimax
-  */
-  size_t firstDepth_;
-  /** 
-   * \brief Discount Factor
-  */
-  float discount_;
-  /** 
+  /**
    * \brief Learned weights for the features
-  */
+   */
   vector<double> theta;
+
   /**
-   * \brief Calculates the minimax value of a board state
-   * \param board   The board state to evaluate
-   * \param depth   The additional depth to search past this state
-   * \param alpha   The largest max value seen so far (for ab-pruning)
-   * \param beta    The smallest min value seen so far (for ab-pruning)
-   * \return The minimax (or estimated minimax) value of the state
+   * \brief Q_SCALE times the discount factor to the power of the number of
+   * pieces, indexed by the number of pieces
    */
-  float minimax(Board board, size_t depth, float alpha, float beta);
+  vector<double> scale;
+};
+
+/**
+ * \class AgentMinimaxSARSA
+ * \brief An agent that can be used to perform Linear Q Learning
+ * and Linear Monte Carlo with Minimax
+ * \note The search is AgentNegamax with QValueHeuristic
+ */
+class AgentMinimaxSARSA : public AgentNegamax<QValueHeuristic> {
+ public:
+  /** \brief The discount factor used when none is given */
+  static constexpr float DEFAULT_DISCOUNT = 0.99f;
+
   /**
-   * \brief The heuristic evaluation function used to evaluate a board state
-   * \param board   The board state to evaluate
-   * \return The estimated Q value of the board
+   * \brief Creates a minimax SARSA Agent with the learned depths
+   * \param depth the Depth the agent should go to.
+   * \param theta  The learned weights for the feature grid.
+   * \param numThreads    The number of threads searching in parallel
+   * \param parallelMode  How the threads share the search (see AgentMinimax)
+   * \note Uses DEFAULT_DISCOUNT
    */
-  float heuristic(const Board &board) const;
+  AgentMinimaxSARSA(size_t depth, vector<double> theta, size_t numThreads = 1,
+                    ParallelMode parallelMode = LAZY_SMP);
+
+  /**
+   * \brief Creates a minimax + Q or MC Agent with the learned depths
+   * \param depth     The Depth the agent should go to.
+   * \param discount  The discount factor applied to the Q value for each ply
+   * (see QValueHeuristic)
+   * \param theta     The learned weights for the feature grid.
+   * \param numThreads    The number of threads searching in parallel
+   * \param parallelMode  How the threads share the search (see AgentMinimax)
+   */
+  AgentMinimaxSARSA(size_t depth, float discount, vector<double> theta,
+                    size_t numThreads = 1,
+                    ParallelMode parallelMode = LAZY_SMP);
+
+  std::string getAgentName() const override;
 };
 
+extern template class AgentNegamax<QValueHeuristic>;
+
 #endif  // AGENTS_AGENT_MINIMAXSARSA_HPP_
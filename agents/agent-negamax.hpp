@@ -0,0 +1,1110 @@
+/**
+ * \file agent-negamax.hpp
+ * \copyright Matthew Calligaro
+ * \date December 2019
+ * \brief Declares and implements the AgentNegamax class template
+ */
+
+#ifndef AGENTS_AGENT_NEGAMAX_HPP_
+#define AGENTS_AGENT_NEGAMAX_HPP_
+
+#ifndef AB_PRUNING
+#define AB_PRUNING 1
+#endif
+
+#ifndef MEMOIZE
+#define MEMOIZE 1
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "../board.hpp"
+#include "../opening-book.hpp"
+#include "../transposition-table.hpp"
+#include "../work-stealing-pool.hpp"
+#include "agent.hpp"
+
+/**
+ * \brief The scale of the values found by AgentNegamax
+ */
+namespace negamax {
+/** \brief The value of a win at the root, which falls by one per ply */
+const int WIN_SCORE = 1 << 20;
+
+/** \brief The largest magnitude of a heuristic value (far from any win) */
+const int MAX_EVAL = WIN_SCORE / 2;
+
+/** \brief A bound beyond the value of any board */
+const int INFINITE_SCORE = WIN_SCORE + 1;
+}  // namespace negamax
+
+/**
+ * \class AgentNegamax
+ * \brief The depth-limited heuristic eval search shared by the minimax agents
+ * \tparam Heuristic  The heuristic eval policy, which provides
+ * int evaluate(const B &board) estimating the value of a board for the
+ * player to move, between -negamax::MAX_EVAL and negamax::MAX_EVAL.  The
+ * policy is called directly, so it is inlined into the search.
+ * \tparam B          The board type searched (Board unless another
+ * geometry is played)
+ * \note Every value is an integer from the perspective of the player to move
+ * (negamax).  A win is worth negamax::WIN_SCORE less the plies from the root
+ * of the search until the win, so quicker wins and slower losses are preferred.
+ * \note The search is a principal variation search: the first move of a node
+ * is searched with the full window, and every other move with a null window
+ * which only proves that the move is no better.  A move which proves better
+ * is searched again with the full window.
+ * \note The search has 2 flags which enable different optimizations:
+ * AB_PRUNING: Use alpha-beta pruning (and null windows)
+ * MEMOIZE: Use a transposition table
+ * \note If an opening book is set, the agent plays the best move of the book
+ * without searching when every move from the root is in the book, and
+ * otherwise uses the exact value of any board in the book which its search
+ * reaches instead of searching below it.
+ */
+template <typename Heuristic, typename B = Board>
+class AgentNegamax : public BasicAgent<B> {
+ public:
+  /** \brief The ways in which several threads can share a search */
+  enum ParallelMode {
+    /** \brief Helper threads repeat the search, sharing the table */
+    LAZY_SMP,
+    /** \brief Siblings are searched in parallel once the eldest is done */
+    YBWC
+  };
+
+  /**
+   * \brief Creates an agent which may use iterative deepening
+   * \param heuristic           The heuristic eval policy
+   * \param firstDepth          The first maximum depth used by the agent
+   * \param tableBytes          The memory budget of the transposition table
+   * (0 to disable the table)
+   * \param iterativeDeepening  True to use iterative deepening search
+   * \param numThreads          The number of threads searching in parallel
+   * \param parallelMode        How the threads share the search
+   * \note See AgentMinimax for the behavior of each option
+   */
+  AgentNegamax(const Heuristic &heuristic, size_t firstDepth,
+               size_t tableBytes, bool iterativeDeepening = false,
+               size_t numThreads = 1, ParallelMode parallelMode = LAZY_SMP);
+
+  void getMove(const B &board, size_t &move,
+               const std::chrono::system_clock::time_point &endTime) override;
+
+  /**
+   * \brief Returns the depth of the last search completed by getMove
+   * \returns The depth of the deepest completed search, or 0 if none
+   */
+  size_t getCompletedDepth() const;
+
+  /**
+   * \brief Returns the value of the root found by the last completed search
+   * \returns The value for the player to move at the root (see negamax)
+   */
+  int getValue() const;
+
+  /**
+   * \brief Returns the principal variation of the last completed search
+   * \returns The moves expected from both players, starting with the move
+   * returned by getMove
+   */
+  const std::vector<size_t> &getPrincipalVariation() const;
+
+  /**
+   * \brief Returns the number of nodes visited by the last call to getMove
+   * \returns The number of nodes visited, summed over all threads
+   */
+  size_t getNodeCount() const;
+
+  /**
+   * \brief Sets the opening book used by the agent
+   * \param book    The opening book, which must outlive the agent (null to
+   * stop using a book)
+   * \note The book is only read, so one book can be shared by many agents
+   */
+  void setOpeningBook(const OpeningBook *book);
+
+  /**
+   * \brief Sets whether a board and its mirror image share table entries
+   * \param symmetric   True to key the table by BasicBoard::getCanonicalKey
+   * \note Entries stored either way remain valid after switching
+   */
+  void setSymmetric(bool symmetric);
+
+  /**
+   * \brief Sets whether the search skips moves which are forced or lose
+   * \param prune   True to win at once when possible, and otherwise to
+   * search only BasicBoard::possibleNonLosingMoves (enabled by default)
+   * \note A board on which every move lets the opponent win is valued as a
+   * loss without searching its children
+   */
+  void setForcedMovePruning(bool prune);
+
+  /**
+   * \brief Sets whether moves after the first are searched with null windows
+   * \param pvs   True for principal variation search, false to search every
+   * move with the full window (enabled by default)
+   * \note Both find the same value for the root when the table is disabled
+   */
+  void setPrincipalVariationSearch(bool pvs);
+
+ protected:
+  /**
+   * \struct SplitPoint
+   * \brief A node whose children are being searched in parallel (YBWC)
+   */
+  struct SplitPoint {
+    SplitPoint(const SplitPoint *parent, int alpha, int beta, int best,
+               size_t bestMove);
+
+    /**
+     * \brief Determines whether this or an enclosing split point was cut off
+     * \returns True if the results of the search below are no longer needed
+     */
+    bool isCutoff() const;
+
+    /** \brief The split point enclosing this one, or null */
+    const SplitPoint *parent;
+
+    /** \brief Protects alpha, best and bestMove */
+    std::mutex mutex;
+
+    /** \brief The current search window of the node (beta never changes) */
+    int alpha;
+    int beta;
+
+    /** \brief The best value found among the children so far */
+    int best;
+
+    /** \brief The move leading to best */
+    size_t bestMove;
+
+    /** \brief Set when a child causes a cutoff */
+    std::atomic<bool> cutoff;
+
+    /** \brief The number of nodes visited by the children */
+    std::atomic<size_t> nodes;
+  };
+
+  /**
+   * \struct SearchThread
+   * \brief The state of the search run by a single thread
+   */
+  struct SearchThread {
+    explicit SearchThread(const B &board, size_t id,
+                          const SplitPoint *split = nullptr);
+
+    /** \brief The board being searched, which is modified in place */
+    B board;
+
+    /** \brief The index of the thread (0 for the main thread) */
+    size_t id;
+
+    /** \brief The number of nodes visited by the thread */
+    size_t nodes;
+
+    /** \brief True if the thread's current search was stopped early */
+    bool aborted;
+
+    /** \brief The max depth of the thread's current search */
+    size_t searchDepth;
+
+    /** \brief True if the node being entered lies on the principal variation */
+    bool followPV;
+
+    /** \brief The principal variation of the thread's last completed search */
+    std::vector<size_t> pv;
+
+    /** \brief The innermost split point this search is part of, or null */
+    const SplitPoint *split;
+  };
+
+  /** \brief The default memory budget of the transposition table (16 MB) */
+  static const size_t DEFAULT_TABLE_BYTES = 1 << 24;
+
+  /** \brief The number of nodes searched between checks of the clock */
+  static const size_t NODES_PER_TIME_CHECK = 1024;
+
+  /** \brief The minimum depth of a node whose children are split (YBWC) */
+  static const size_t MIN_SPLIT_DEPTH = 4;
+
+  /** \brief The heuristic eval policy */
+  Heuristic heuristic_;
+
+  /** \brief The first maximum depth at which to begin searching */
+  size_t firstDepth_;
+
+  /** \brief True if the agent uses iterative deepening search */
+  bool iterativeDeepening_;
+
+  /** \brief The number of threads searching in parallel */
+  size_t numThreads_;
+
+  /** \brief How the threads share the search */
+  ParallelMode parallelMode_;
+
+  /** \brief The pool running split children during a YBWC search, or null */
+  WorkStealingPool *pool_;
+
+  /** \brief A transposition table storing the results of previous searches */
+  TranspositionTable table_;
+
+  /** \brief The opening book of solved boards, or null */
+  const OpeningBook *book_;
+
+  /** \brief True if a board and its mirror image share table entries */
+  bool symmetric_;
+
+  /** \brief True if the search skips moves which are forced or lose */
+  bool pruneForcedMoves_;
+
+  /** \brief True if moves after the first are searched with null windows */
+  bool pvs_;
+
+  /** \brief The time at which the current search must stop */
+  std::chrono::system_clock::time_point endTime_;
+
+  /** \brief Set to stop every thread of the current search */
+  std::atomic<bool> stop_;
+
+  /** \brief The number of nodes visited by the last call to getMove */
+  size_t nodes_;
+
+  /** \brief The principal variation of the last completed search */
+  std::vector<size_t> pv_;
+
+  /** \brief The depth of the last completed search */
+  size_t completedDepth_;
+
+  /** \brief The value of the root found by the last completed search */
+  int value_;
+
+  /**
+   * \brief Runs the search of one thread until it completes or is stopped
+   * \param thread    The state of the thread
+   * \param maxDepth  The deepest search which can be useful
+   * \param move      Where to publish the best move (main thread only)
+   */
+  void iterate(SearchThread &thread, size_t maxDepth, size_t *move);
+
+  /**
+   * \brief Searches every move from the root to a fixed depth
+   * \param thread  The state of the searching thread
+   * \param depth   The depth to which to search
+   * \param value   The value of the root (output)
+   * \returns The best move, which is only valid if the search was not aborted
+   */
+  size_t searchRoot(SearchThread &thread, size_t depth, int &value);
+
+  /**
+   * \brief Calculates the value of a board state
+   * \param thread  The state of the searching thread, whose board is the state
+   * to evaluate (restored before returning)
+   * \param depth   The additional depth to search past this state
+   * \param alpha   The value the player to move is already assured of
+   * \param beta    The value the opponent is already assured of, negated
+   * \return The value (or estimated value) of the state, which is only a
+   * bound if it is outside of (alpha, beta)
+   */
+  int search(SearchThread &thread, size_t depth, int alpha, int beta);
+
+  /**
+   * \brief Calculates the value of a move
+   * \param thread      The state of the searching thread, whose board is the
+   * state before the move (restored before returning)
+   * \param move        The move to search
+   * \param depth       The depth remaining before the move
+   * \param alpha       The window of the board before the move
+   * \param beta        The window of the board before the move
+   * \param fullWindow  True to search the move with the full window at once
+   * \return The value of the move for the player making it
+   * \note Unless fullWindow is set, the move is first searched with a null
+   * window when principal variation search is enabled
+   */
+  int searchMove(SearchThread &thread, size_t move, size_t depth, int alpha,
+                 int beta, bool fullWindow);
+
+  /**
+   * \brief Searches the remaining children of a node in parallel (YBWC)
+   * \param thread    The state of the searching thread, whose board is at the
+   * node being split
+   * \param moves     The moves to search
+   * \param numMoves  The number of moves to search
+   * \param depth     The depth remaining at the node
+   * \param alpha     The lower end of the window (updated)
+   * \param beta      The upper end of the window
+   * \param best      The best value of a child so far (updated)
+   * \param bestMove  The move leading to best (updated)
+   */
+  void splitSearch(SearchThread &thread, const size_t *moves, size_t numMoves,
+                   size_t depth, int &alpha, int beta, int &best,
+                   size_t &bestMove);
+
+  /**
+   * \brief Computes the key of a board in the transposition table
+   * \param board     The board
+   * \param mirrored  True if the entry is stored for the mirror image of
+   * board, so its move is mirrored (output)
+   * \returns The key of the board's entry
+   * \note A board whose key is wider than 64 bits has its key folded to 64
+   * bits, so two such boards may rarely share an entry
+   */
+  uint64_t getTableKey(const B &board, bool &mirrored) const;
+
+  /**
+   * \brief Converts a move between a board and its mirror image
+   * \param move      A column, or TranspositionTable::NO_MOVE
+   * \param mirrored  True to mirror the move
+   * \returns B::WIDTH - 1 - move if mirrored is true and move is a column,
+   * else move
+   */
+  static size_t mirrorMove(size_t move, bool mirrored);
+
+  /**
+   * \brief Converts a value between the root and a board for the table
+   * \param value   A value counted from the root (or from the board if
+   * toRoot is set)
+   * \param ply     The plies from the root to the board
+   * \param toRoot  True to convert a value counted from the board to the root
+   * \returns The converted value
+   * \note A stored win counts its plies from the board rather than from the
+   * root, so the entry stays valid when the board is reached by another path
+   */
+  static int convertWinValue(int value, size_t ply, bool toRoot);
+
+  /**
+   * \brief Chooses a move from the opening book without searching
+   * \param board   The board state of the root
+   * \param move    The move with the best value in the book (output)
+   * \param value   The value of the root (output)
+   * \returns True if every move from the root could be valued from the book
+   */
+  bool probeBookRoot(const B &board, size_t &move, int &value) const;
+
+  /**
+   * \brief Looks up the exact score of a board in the opening book
+   * \param board   The board to look up
+   * \param score   The score of board (output)
+   * \returns True if board is in the book
+   * \note The book only holds boards of the standard Board, so other boards
+   * are never found
+   */
+  bool probeBook(const B &board, int &score) const;
+
+  /**
+   * \brief Converts the score of a solved board to a value
+   * \param board   The solved board
+   * \param score   The exact score of board (see AgentSolver)
+   * \param ply     The plies from the root to board
+   * \returns The value which a search to the end of the game would find for
+   * board
+   */
+  static int bookValue(const B &board, int score, size_t ply);
+
+  /**
+   * \brief Finds the moves of a board which need to be searched
+   * \param board   The board whose moves are found
+   * \param depth   The remaining depth of the search of board
+   * \param ply     The plies from the root to board
+   * \param value   The value of the board if no move needs to be searched
+   * (output)
+   * \returns A bitmask with one position set for each move to search (0 if
+   * value is set)
+   * \note Without forced-move pruning, this is every legal move.  A move is
+   * only pruned when the search of depth would find it no better than
+   * another, so pruning never changes the value of a search.
+   */
+  typename B::Mask getCandidateMoves(const B &board, size_t depth, size_t ply,
+                                     int &value) const;
+
+  /**
+   * \brief Lists the moves of a board in the order they are searched
+   * \param board       The board whose moves are listed
+   * \param candidates  A bitmask of the moves to list (see
+   * getCandidateMoves)
+   * \param first       A move to search first (ignored if it is not in
+   * candidates)
+   * \param moves       The ordered moves (output)
+   * \returns The number of moves
+   * \note After first, the moves which create the most threats come first,
+   * breaking ties by MOVE_ORDER (see AgentSolver)
+   */
+  static size_t orderMoves(const B &board, typename B::Mask candidates,
+                           size_t first, size_t moves[B::WIDTH]);
+
+  /**
+   * \brief Reads the principal variation of a thread's search from the table
+   * \param thread  The state of the thread, whose board is at the root
+   * \param depth   The depth of the thread's last search
+   */
+  void extractPrincipalVariation(SearchThread &thread, size_t depth);
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Implementation
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename Heuristic, typename B>
+AgentNegamax<Heuristic, B>::AgentNegamax(const Heuristic &heuristic,
+                                         size_t firstDepth, size_t tableBytes,
+                                         bool iterativeDeepening,
+                                         size_t numThreads,
+                                         ParallelMode parallelMode)
+    : heuristic_(heuristic),
+      firstDepth_{firstDepth},
+      iterativeDeepening_{iterativeDeepening},
+      numThreads_{std::max<size_t>(numThreads, 1)},
+      parallelMode_{parallelMode},
+      pool_{nullptr},
+      table_(tableBytes),
+      book_{nullptr},
+      symmetric_{false},
+      pruneForcedMoves_{true},
+      pvs_{true},
+      stop_{false},
+      nodes_{0},
+      completedDepth_{0},
+      value_{0} {}
+
+template <typename Heuristic, typename B>
+AgentNegamax<Heuristic, B>::SplitPoint::SplitPoint(const SplitPoint *parent,
+                                                   int alpha, int beta,
+                                                   int best, size_t bestMove)
+    : parent{parent},
+      alpha{alpha},
+      beta{beta},
+      best{best},
+      bestMove{bestMove},
+      cutoff{false},
+      nodes{0} {}
+
+template <typename Heuristic, typename B>
+bool AgentNegamax<Heuristic, B>::SplitPoint::isCutoff() const {
+  for (const SplitPoint *split = this; split; split = split->parent) {
+    if (split->cutoff.load(std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename Heuristic, typename B>
+AgentNegamax<Heuristic, B>::SearchThread::SearchThread(const B &board,
+                                                       size_t id,
+                                                       const SplitPoint *split)
+    : board{board},
+      id{id},
+      nodes{0},
+      aborted{false},
+      searchDepth{0},
+      followPV{false},
+      split{split} {}
+
+template <typename Heuristic, typename B>
+void AgentNegamax<Heuristic, B>::getMove(
+    const B &board, size_t &move,
+    const std::chrono::system_clock::time_point &endTime) {
+  size_t maxDepth = B::SIZE - board.getNumMoves();
+  table_.newSearch();
+  endTime_ = endTime;
+  stop_ = false;
+  pv_.clear();
+  completedDepth_ = 0;
+
+  // The book already holds the exact value of every move
+  if (book_ && probeBookRoot(board, move, value_)) {
+    nodes_ = 0;
+    pv_.push_back(move);
+    return;
+  }
+
+  // With YBWC, the other threads only work through the pool
+  if (parallelMode_ == YBWC) {
+    WorkStealingPool pool(numThreads_ - 1);
+    SearchThread thread(board, 0);
+    pool_ = &pool;
+    iterate(thread, maxDepth, &move);
+    pool_ = nullptr;
+    nodes_ = thread.nodes;
+    return;
+  }
+
+  // Start the helper threads, then run the main search on this thread
+  std::vector<SearchThread> threads;
+  for (size_t i = 0; i < numThreads_; ++i) {
+    threads.emplace_back(board, i);
+  }
+  std::vector<std::thread> helpers;
+  for (size_t i = 1; i < numThreads_; ++i) {
+    helpers.emplace_back(&AgentNegamax::iterate, this, std::ref(threads[i]),
+                         maxDepth, nullptr);
+  }
+  iterate(threads[0], maxDepth, &move);
+
+  // The helpers only fill the table, so stop them once the main search ends
+  stop_ = true;
+  for (std::thread &helper : helpers) {
+    helper.join();
+  }
+
+  nodes_ = 0;
+  for (const SearchThread &thread : threads) {
+    nodes_ += thread.nodes;
+  }
+}
+
+template <typename Heuristic, typename B>
+size_t AgentNegamax<Heuristic, B>::getCompletedDepth() const {
+  return completedDepth_;
+}
+
+template <typename Heuristic, typename B>
+int AgentNegamax<Heuristic, B>::getValue() const {
+  return value_;
+}
+
+template <typename Heuristic, typename B>
+const std::vector<size_t> &AgentNegamax<Heuristic, B>::getPrincipalVariation()
+    const {
+  return pv_;
+}
+
+template <typename Heuristic, typename B>
+size_t AgentNegamax<Heuristic, B>::getNodeCount() const {
+  return nodes_;
+}
+
+template <typename Heuristic, typename B>
+void AgentNegamax<Heuristic, B>::setOpeningBook(const OpeningBook *book) {
+  book_ = book;
+}
+
+template <typename Heuristic, typename B>
+void AgentNegamax<Heuristic, B>::setSymmetric(bool symmetric) {
+  symmetric_ = symmetric;
+}
+
+template <typename Heuristic, typename B>
+void AgentNegamax<Heuristic, B>::setForcedMovePruning(bool prune) {
+  pruneForcedMoves_ = prune;
+}
+
+template <typename Heuristic, typename B>
+void AgentNegamax<Heuristic, B>::setPrincipalVariationSearch(bool pvs) {
+  pvs_ = pvs;
+}
+
+template <typename Heuristic, typename B>
+void AgentNegamax<Heuristic, B>::iterate(SearchThread &thread, size_t maxDepth,
+                                         size_t *move) {
+  // Every other helper searches one ply deeper so that the threads spread
+  // over two depths at once.  Near the end of the game, the first search is
+  // cut short at the end of the game.
+  size_t lastDepth = std::max<size_t>(maxDepth, 1);
+  size_t depth = std::min(std::max<size_t>(firstDepth_, 1), lastDepth) +
+                 (thread.id % 2);
+  for (; depth <= lastDepth; ++depth) {
+    int value;
+    size_t bestMove = searchRoot(thread, depth, value);
+
+    // Only publish the results of a search which completed
+    if (thread.aborted) {
+      return;
+    }
+    extractPrincipalVariation(thread, depth);
+    if (move) {
+      *move = bestMove;
+      completedDepth_ = depth;
+      value_ = value;
+      pv_ = thread.pv;
+    }
+
+    // Stop once the game is decided or the search reaches the end of the game
+    if (!iterativeDeepening_ || std::abs(value) > negamax::MAX_EVAL) {
+      return;
+    }
+  }
+}
+
+template <typename Heuristic, typename B>
+size_t AgentNegamax<Heuristic, B>::searchRoot(SearchThread &thread,
+                                              size_t depth, int &value) {
+  B &board = thread.board;
+  size_t bestMove = B::MOVE_ORDER[0];
+  int alpha = -negamax::INFINITE_SCORE;
+  int beta = negamax::INFINITE_SCORE;
+  value = -negamax::INFINITE_SCORE;
+  thread.searchDepth = depth;
+
+  // A move must still be chosen when the outcome is forced: a winning move,
+  // or any move if every move lets the opponent win
+  int forcedValue;
+  typename B::Mask candidates = getCandidateMoves(board, depth, 0, forcedValue);
+  if (!candidates) {
+    typename B::Mask wins = board.winningMoves();
+    candidates = wins ? wins & -wins : board.getLegalMask();
+  }
+
+  // Search the best move of the previous iteration first
+  size_t moves[B::WIDTH];
+  size_t numMoves = orderMoves(
+      board, candidates,
+      thread.pv.empty() ? TranspositionTable::NO_MOVE : thread.pv[0], moves);
+
+  // Helper threads rotate the order of the root moves to diverge from the
+  // main thread before the table has results to share
+  if (thread.id && numMoves) {
+    std::rotate(moves, moves + thread.id % numMoves, moves + numMoves);
+  }
+
+  // Find the best move
+  for (size_t i = 0; i < numMoves; ++i) {
+    // Once the first move has been searched, search the rest in parallel
+    if (i == 1 && pool_) {
+      splitSearch(thread, moves + 1, numMoves - 1, depth, alpha, beta, value,
+                  bestMove);
+      if (thread.aborted) {
+        return bestMove;
+      }
+      break;
+    }
+
+    // Calculate the value of the successor state
+    thread.followPV = !thread.pv.empty() && moves[i] == thread.pv[0];
+    int sucValue = searchMove(thread, moves[i], depth, alpha, beta, i == 0);
+
+    // If we have surpassed the endTime given by the caller, yield to caller
+    if (thread.aborted) {
+      return bestMove;
+    }
+
+    // If this successor is the best so far, update values
+    if (sucValue > value) {
+      bestMove = moves[i];
+      value = sucValue;
+      alpha = std::max(alpha, value);
+    }
+  }
+
+#if MEMOIZE
+  bool mirrored;
+  uint64_t key = getTableKey(board, mirrored);
+  table_.store(key, value, depth, TranspositionTable::EXACT,
+               mirrorMove(bestMove, mirrored));
+#endif
+
+  return bestMove;
+}
+
+template <typename Heuristic, typename B>
+int AgentNegamax<Heuristic, B>::search(SearchThread &thread, size_t depth,
+                                       int alpha, int beta) {
+  // Check the clock every NODES_PER_TIME_CHECK nodes, and unwind the search
+  // without using its results once time is up or another thread stops it
+  if (++thread.nodes % NODES_PER_TIME_CHECK == 0 &&
+      std::chrono::system_clock::now() >= endTime_) {
+    stop_.store(true, std::memory_order_relaxed);
+  }
+  if (stop_.load(std::memory_order_relaxed) ||
+      (thread.split && thread.split->isCutoff())) {
+    thread.aborted = true;
+    return 0;
+  }
+
+  // A won board was won by the previous move, so the player to move lost
+  B &board = thread.board;
+  size_t ply = thread.searchDepth - depth;
+  if (board.isWon()) {
+    return static_cast<int>(ply) - negamax::WIN_SCORE;
+  }
+  if (board.isDraw()) {
+    return 0;
+  }
+
+  // A board in the book has an exact value, so it need not be searched
+  int score;
+  if (book_ && probeBook(board, score)) {
+    return bookValue(board, score, ply);
+  }
+
+  // If we reached max depth, use our heuristic to estimate the value
+  if (depth == 0) {
+    return heuristic_.evaluate(board);
+  }
+
+  // A board with a forced outcome needs no search
+  int forcedValue;
+  typename B::Mask candidates =
+      getCandidateMoves(board, depth, ply, forcedValue);
+  if (!candidates) {
+    return forcedValue;
+  }
+
+  // Search the principal variation of the previous iteration first, and
+  // otherwise the best move found by a previous search of this board
+  bool pvNode = thread.followPV && ply < thread.pv.size();
+  size_t firstMove = pvNode ? thread.pv[ply] : TranspositionTable::NO_MOVE;
+  thread.followPV = false;
+
+#if MEMOIZE
+  // Use a previous search of this board if it was at least as deep and its
+  // value is exact or its bound causes a cutoff
+  bool mirrored;
+  uint64_t key = getTableKey(board, mirrored);
+  TranspositionTable::Entry entry;
+  if (table_.probe(key, entry)) {
+    if (entry.depth >= depth) {
+      int value = convertWinValue(entry.value, ply, true);
+      if (entry.bound == TranspositionTable::EXACT) {
+        return value;
+      } else if (entry.bound == TranspositionTable::LOWER) {
+        alpha = std::max(alpha, value);
+      } else {
+        beta = std::min(beta, value);
+      }
+
+      if (alpha >= beta) {
+        return value;
+      }
+    }
+
+    if (!pvNode) {
+      firstMove = mirrorMove(entry.move, mirrored);
+    }
+  }
+  int originalAlpha = alpha;
+#endif
+
+  // Find the best successor
+  size_t moves[B::WIDTH];
+  size_t numMoves = orderMoves(board, candidates, firstMove, moves);
+  size_t bestMove = TranspositionTable::NO_MOVE;
+  int best = -negamax::INFINITE_SCORE;
+  for (size_t i = 0; i < numMoves; ++i) {
+    // Once the first move has been searched, search the rest in parallel
+    if (i == 1 && pool_ && depth >= MIN_SPLIT_DEPTH) {
+      splitSearch(thread, moves + 1, numMoves - 1, depth, alpha, beta, best,
+                  bestMove);
+      if (thread.aborted) {
+        return 0;
+      }
+      break;
+    }
+
+    // Calculate the value of the successor state
+    thread.followPV = pvNode && i == 0 && moves[0] == thread.pv[ply];
+    int sucValue = searchMove(thread, moves[i], depth, alpha, beta, i == 0);
+
+    if (thread.aborted) {
+      return 0;
+    }
+
+    // If this successor is the best so far, update values
+    if (sucValue > best) {
+      bestMove = moves[i];
+      best = sucValue;
+      alpha = std::max(alpha, best);
+    }
+
+#if AB_PRUNING
+    // If alpha > beta, do not explore any further
+    if (alpha >= beta) {
+      break;
+    }
+#endif
+  }
+
+#if MEMOIZE
+  // Record whether the value is exact or only a bound from a cutoff
+  TranspositionTable::Bound bound = TranspositionTable::EXACT;
+  if (best <= originalAlpha) {
+    bound = TranspositionTable::UPPER;
+  } else if (best >= beta) {
+    bound = TranspositionTable::LOWER;
+  }
+  table_.store(key, convertWinValue(best, ply, false), depth, bound,
+               mirrorMove(bestMove, mirrored));
+#endif
+
+  return best;
+}
+
+template <typename Heuristic, typename B>
+int AgentNegamax<Heuristic, B>::searchMove(SearchThread &thread, size_t move,
+                                           size_t depth, int alpha, int beta,
+                                           bool fullWindow) {
+  B &board = thread.board;
+  board.handleMove(move);
+
+  // Prove that the move is no better than alpha with a null window, and only
+  // search it with the full window if it is better after all.  Near the
+  // horizon, a null window saves little and a re-search costs as much again,
+  // so children within a ply of the horizon get the full window.
+  bool nullWindow =
+      AB_PRUNING && pvs_ && !fullWindow && beta - alpha > 1 && depth > 2;
+  int value = 0;
+  if (nullWindow) {
+    value = -search(thread, depth - 1, -alpha - 1, -alpha);
+  }
+  if (!nullWindow || (value > alpha && value < beta && !thread.aborted)) {
+    value = -search(thread, depth - 1, -beta, -alpha);
+  }
+
+  board.undoMove(move);
+  return value;
+}
+
+template <typename Heuristic, typename B>
+void AgentNegamax<Heuristic, B>::splitSearch(SearchThread &thread,
+                                             const size_t *moves,
+                                             size_t numMoves, size_t depth,
+                                             int &alpha, int beta, int &best,
+                                             size_t &bestMove) {
+  SplitPoint split(thread.split, alpha, beta, best, bestMove);
+  WorkStealingPool::TaskGroup group;
+
+  // Submit the moves in reverse, since a thread runs its newest task first
+  for (size_t i = numMoves; i-- > 0;) {
+    size_t move = moves[i];
+    B board = thread.board;
+    pool_->submit(group, [this, &split, board, move, depth, &thread]() {
+      if (split.isCutoff() || stop_.load(std::memory_order_relaxed)) {
+        return;
+      }
+
+      // Search the child with the current window of the split point
+      SearchThread child(board, thread.id, &split);
+      child.searchDepth = thread.searchDepth;
+      int childAlpha;
+      {
+        std::lock_guard<std::mutex> lock(split.mutex);
+        childAlpha = split.alpha;
+      }
+      int sucValue =
+          searchMove(child, move, depth, childAlpha, split.beta, false);
+      split.nodes += child.nodes;
+      if (child.aborted) {
+        return;
+      }
+
+      // If this successor is the best so far, update values
+      std::lock_guard<std::mutex> lock(split.mutex);
+      if (sucValue > split.best) {
+        split.bestMove = move;
+        split.best = sucValue;
+        split.alpha = std::max(split.alpha, sucValue);
+      }
+
+#if AB_PRUNING
+      // If alpha > beta, the other children do not need to be explored
+      if (split.alpha >= split.beta) {
+        split.cutoff = true;
+      }
+#endif
+    });
+  }
+  pool_->wait(group);
+
+  thread.nodes += split.nodes;
+  if (stop_.load(std::memory_order_relaxed) ||
+      (thread.split && thread.split->isCutoff())) {
+    thread.aborted = true;
+    return;
+  }
+
+  alpha = split.alpha;
+  best = split.best;
+  bestMove = split.bestMove;
+}
+
+template <typename Heuristic, typename B>
+uint64_t AgentNegamax<Heuristic, B>::getTableKey(const B &board,
+                                                 bool &mirrored) const {
+  typename B::Mask key = board.getKey();
+  mirrored = false;
+  if (symmetric_) {
+    typename B::Mask mirroredKey = board.getMirroredKey();
+    mirrored = mirroredKey < key;
+    key = std::min(key, mirroredKey);
+  }
+
+  // Fold the high bits of a wide key into the low bits
+  if constexpr (sizeof(key) > sizeof(uint64_t)) {
+    return static_cast<uint64_t>(key) ^
+           static_cast<uint64_t>(key >> 64) * 0x9E3779B97F4A7C15;
+  } else {
+    return key;
+  }
+}
+
+template <typename Heuristic, typename B>
+size_t AgentNegamax<Heuristic, B>::mirrorMove(size_t move, bool mirrored) {
+  return mirrored && move < B::WIDTH ? B::WIDTH - 1 - move : move;
+}
+
+template <typename Heuristic, typename B>
+int AgentNegamax<Heuristic, B>::convertWinValue(int value, size_t ply,
+                                                bool toRoot) {
+  int plies = toRoot ? -static_cast<int>(ply) : static_cast<int>(ply);
+  if (value > negamax::MAX_EVAL) {
+    return value + plies;
+  } else if (value < -negamax::MAX_EVAL) {
+    return value - plies;
+  }
+  return value;
+}
+
+template <typename Heuristic, typename B>
+bool AgentNegamax<Heuristic, B>::probeBookRoot(const B &board, size_t &move,
+                                               int &value) const {
+  int bestValue = -negamax::INFINITE_SCORE;
+  for (size_t col : B::MOVE_ORDER) {
+    if (!board.isValidMove(col)) {
+      continue;
+    }
+
+    // Value each move as the search would, for the player to move
+    B child = board;
+    child.handleMove(col);
+    int sucValue;
+    int score;
+    if (child.isWon()) {
+      sucValue = negamax::WIN_SCORE - 1;
+    } else if (child.isDraw()) {
+      sucValue = 0;
+    } else if (probeBook(child, score)) {
+      sucValue = -bookValue(child, score, 1);
+    } else {
+      return false;
+    }
+
+    if (sucValue > bestValue) {
+      move = col;
+      bestValue = sucValue;
+    }
+  }
+  value = bestValue;
+  return true;
+}
+
+template <typename Heuristic, typename B>
+bool AgentNegamax<Heuristic, B>::probeBook(const B &board, int &score) const {
+  if constexpr (std::is_same<B, Board>::value) {
+    return book_->probe(board, score);
+  } else {
+    return false;
+  }
+}
+
+template <typename Heuristic, typename B>
+int AgentNegamax<Heuristic, B>::bookValue(const B &board, int score,
+                                          size_t ply) {
+  if (!score) {
+    return 0;
+  }
+
+  // A score of s means the winner wins with their ((SIZE + 3) / 2 - |s|)-th
+  // piece as the first player, or their ((SIZE + 2) / 2 - |s|)-th piece as the
+  // second (see AgentSolver).  Count the plies until that piece from the
+  // pieces the winner has already played.
+  size_t numMoves = board.getNumMoves();
+  bool firstWins = (score > 0) == (numMoves % 2 == 0);
+  size_t piece = (B::SIZE + (firstWins ? 3 : 2)) / 2 - std::abs(score);
+  size_t plies = score > 0 ? 2 * (piece - numMoves / 2) - 1
+                           : 2 * (piece - (numMoves + 1) / 2);
+
+  int value = negamax::WIN_SCORE - static_cast<int>(ply + plies);
+  return score > 0 ? value : -value;
+}
+
+template <typename Heuristic, typename B>
+typename B::Mask AgentNegamax<Heuristic, B>::getCandidateMoves(
+    const B &board, size_t depth, size_t ply, int &value) const {
+  if (!pruneForcedMoves_) {
+    return board.getLegalMask();
+  }
+
+  // Win at once if possible (the value a search of the winning child finds)
+  if (board.winningMoves()) {
+    value = negamax::WIN_SCORE - static_cast<int>(ply + 1);
+    return 0;
+  }
+
+  // Otherwise, a move which lets the opponent win at once is never better
+  // than one which does not, and if every move does, the opponent wins.  A
+  // search which stops before the opponent's reply cannot see this, so its
+  // moves are left alone.
+  if (depth < 2) {
+    return board.getLegalMask();
+  }
+  typename B::Mask nonLosing = board.possibleNonLosingMoves();
+  if (!nonLosing) {
+    value = static_cast<int>(ply + 2) - negamax::WIN_SCORE;
+  }
+  return nonLosing;
+}
+
+template <typename Heuristic, typename B>
+size_t AgentNegamax<Heuristic, B>::orderMoves(const B &board,
+                                              typename B::Mask candidates,
+                                              size_t first,
+                                              size_t moves[B::WIDTH]) {
+  size_t numMoves = 0;
+  if (first < B::WIDTH &&
+      (candidates & (B::COLUMN_MASK << (first * B::COLUMN_BITS)))) {
+    moves[numMoves++] = first;
+  }
+
+  // Fill in the remaining moves by the threats they create, and otherwise in
+  // MOVE_ORDER (insertion sort keeps earlier moves ahead of equal scores)
+  typename B::Mask mine = board.getMask(board.getTurn());
+  typename B::Mask open =
+      B::BOARD_MASK ^ (mine | board.getMask(1 - board.getTurn()));
+  size_t scores[B::WIDTH];
+  size_t numFirst = numMoves;
+  for (size_t move : B::MOVE_ORDER) {
+    typename B::Mask position =
+        candidates & (B::COLUMN_MASK << (move * B::COLUMN_BITS));
+    if (move == first || !position) {
+      continue;
+    }
+
+    size_t score =
+        B::popcount(B::getWinningPositions(mine | position) & open & ~position);
+    size_t i = numMoves++;
+    for (; i > numFirst && scores[i - 1] < score; --i) {
+      moves[i] = moves[i - 1];
+      scores[i] = scores[i - 1];
+    }
+    moves[i] = move;
+    scores[i] = score;
+  }
+  return numMoves;
+}
+
+template <typename Heuristic, typename B>
+void AgentNegamax<Heuristic, B>::extractPrincipalVariation(SearchThread &thread,
+                                                           size_t depth) {
+  // Follow the best moves stored in the table from the root
+  B curBoard = thread.board;
+  TranspositionTable::Entry entry;
+  bool mirrored;
+  thread.pv.clear();
+  while (thread.pv.size() < depth && !curBoard.isWon() &&
+         !curBoard.isDraw() &&
+         table_.probe(getTableKey(curBoard, mirrored), entry) &&
+         curBoard.isValidMove(mirrorMove(entry.move, mirrored))) {
+    thread.pv.push_back(mirrorMove(entry.move, mirrored));
+    curBoard.handleMove(thread.pv.back());
+  }
+}
+
+#endif  // AGENTS_AGENT_NEGAMAX_HPP_
@@ -0,0 +1,298 @@
+/**
+ * \file agent-solver.cpp
+ * \copyright Matthew Calligaro
+ * \date December 2019
+ * \brief Implements the AgentSolver class
+ */
+
+#include "agent-solver.hpp"
+#include <algorithm>
+#include <string>
+
+// A table entry packs a key into its upper 56 bits and an encoded bound
+// into its lowest 8 bits
+static_assert(Board::WIDTH * Board::COLUMN_BITS <= 56,
+              "AgentSolver needs boards whose keys fit in 56 bits");
+static_assert(2 * (AgentSolver::MAX_SCORE - AgentSolver::MIN_SCORE) + 2 <= 0xFF,
+              "AgentSolver needs scores whose bounds fit in 8 bits");
+
+namespace {
+/** \brief The number of positions on the board */
+const int SIZE = static_cast<int>(Board::SIZE);
+}  // namespace
+
+/*******************************************************************************
+ * AgentSolver Implementation
+ ******************************************************************************/
+
+AgentSolver::AgentSolver() : AgentSolver(DEFAULT_TABLE_BYTES) {}
+
+AgentSolver::AgentSolver(size_t tableBytes)
+    : numNodes_{0}, aborted_{false}, symmetric_{false} {
+  // Round the number of slots down to a power of 2 so that a slot can be
+  // chosen with a mask
+  size_t numSlots = 1;
+  while (numSlots * 2 * sizeof(uint64_t) <= tableBytes) {
+    numSlots *= 2;
+  }
+  tableMask_ = numSlots - 1;
+  table_.reset(new uint64_t[numSlots]());
+}
+
+void AgentSolver::getMove(
+    const Board &board, size_t &move,
+    const std::chrono::system_clock::time_point &endTime) {
+  numNodes_ = 0;
+  endTime_ = endTime;
+  aborted_ = false;
+
+  // Fall back to the first move which does not lose immediately
+  Position pos(board);
+  uint64_t nonLosing = pos.getNonLosingMoves();
+  move = Board::MOVE_ORDER[0];
+  for (size_t col : Board::MOVE_ORDER) {
+    if (board.isValidMove(col)) {
+      move = col;
+      break;
+    }
+  }
+  for (size_t col : Board::MOVE_ORDER) {
+    if (nonLosing & (Board::COLUMN_MASK << (col * Board::COLUMN_BITS))) {
+      move = col;
+      break;
+    }
+  }
+
+  // Score every move by solving the board after it, and play a move which
+  // wins immediately without searching
+  int bestScore = MIN_SCORE - 1;
+  for (size_t col : Board::MOVE_ORDER) {
+    if (!board.isValidMove(col)) {
+      continue;
+    }
+
+    Board child = board;
+    child.handleMove(col);
+    if (child.isWon()) {
+      move = col;
+      return;
+    }
+    int score = child.isDraw() ? 0 : -solvePosition(Position(child), false);
+    if (aborted_) {
+      return;
+    }
+    if (score > bestScore) {
+      bestScore = score;
+      move = col;
+    }
+  }
+}
+
+std::string AgentSolver::getAgentName() const { return "Solver"; }
+
+int AgentSolver::solve(const Board &board, bool weak) {
+  numNodes_ = 0;
+  endTime_ = std::chrono::system_clock::time_point::max();
+  aborted_ = false;
+  return solvePosition(Position(board), weak);
+}
+
+size_t AgentSolver::getNodeCount() const { return numNodes_; }
+
+void AgentSolver::setSymmetric(bool symmetric) { symmetric_ = symmetric; }
+
+int AgentSolver::probe(uint64_t key) const {
+  // Fibonacci hashing spreads the structured keys over the slots
+  uint64_t entry = table_[(key * 0x9E3779B97F4A7C15UL >> 32) & tableMask_];
+  return (entry >> 8) == key ? entry & 0xFF : 0;
+}
+
+void AgentSolver::store(uint64_t key, int value) {
+  table_[(key * 0x9E3779B97F4A7C15UL >> 32) & tableMask_] =
+      key << 8 | static_cast<uint8_t>(value);
+}
+
+int AgentSolver::negamax(const Position &pos, int alpha, int beta) {
+  if (++numNodes_ % CHECK_INTERVAL == 0 &&
+      std::chrono::system_clock::now() >= endTime_) {
+    aborted_ = true;
+  }
+  if (aborted_) {
+    return 0;
+  }
+
+  // If every move lets the opponent win, they win with their next piece
+  uint64_t next = pos.getNonLosingMoves();
+  if (!next) {
+    return -(SIZE - pos.numMoves) / 2;
+  }
+
+  // With two empty positions left, neither player can win any more
+  if (pos.numMoves >= SIZE - 2) {
+    return 0;
+  }
+
+  // The opponent cannot win with their next piece, and we cannot win with
+  // our next piece (or we would have played it), which bounds the score.
+  // Early in the game, no one can win before their Board::CONNECT-th piece,
+  // which bounds it further and keeps every stored bound within
+  // [MIN_SCORE, MAX_SCORE].
+  int min = std::max(-(SIZE - 2 - pos.numMoves) / 2, MIN_SCORE);
+  if (alpha < min) {
+    alpha = min;
+    if (alpha >= beta) {
+      return alpha;
+    }
+  }
+  int max = std::min((SIZE - 1 - pos.numMoves) / 2, MAX_SCORE);
+  // The key keeps every column in its own bits, so it can be mirrored
+  uint64_t key = pos.getKey();
+  if (symmetric_) {
+    key = std::min(key, Board::mirror(key));
+  }
+  if (int value = probe(key)) {
+    if (value > MAX_SCORE - MIN_SCORE + 1) {
+      min = value + 2 * MIN_SCORE - MAX_SCORE - 2;
+      if (alpha < min) {
+        alpha = min;
+        if (alpha >= beta) {
+          return alpha;
+        }
+      }
+    } else {
+      max = value + MIN_SCORE - 1;
+    }
+  }
+  if (beta > max) {
+    beta = max;
+    if (alpha >= beta) {
+      return beta;
+    }
+  }
+
+  // Try the moves which create the most threats first, breaking ties by
+  // MOVE_ORDER (insertion sort keeps earlier moves ahead of equal scores)
+  uint64_t moves[Board::WIDTH];
+  int scores[Board::WIDTH];
+  size_t numMoves = 0;
+  for (size_t col : Board::MOVE_ORDER) {
+    uint64_t move = next & (Board::COLUMN_MASK << (col * Board::COLUMN_BITS));
+    if (!move) {
+      continue;
+    }
+
+    int score = pos.getMoveScore(move);
+    size_t i = numMoves++;
+    for (; i && scores[i - 1] < score; --i) {
+      moves[i] = moves[i - 1];
+      scores[i] = scores[i - 1];
+    }
+    moves[i] = move;
+    scores[i] = score;
+  }
+
+  for (size_t i = 0; i < numMoves; ++i) {
+    Position child = pos;
+    child.play(moves[i]);
+    int score = -negamax(child, -beta, -alpha);
+    if (aborted_) {
+      return 0;
+    }
+    if (score >= beta) {
+      store(key, score + MAX_SCORE - 2 * MIN_SCORE + 2);
+      return score;
+    }
+    alpha = std::max(alpha, score);
+  }
+
+  store(key, alpha - MIN_SCORE + 1);
+  return alpha;
+}
+
+int AgentSolver::solvePosition(const Position &pos, bool weak) {
+  if (pos.canWinNext()) {
+    return weak ? 1 : (SIZE + 1 - pos.numMoves) / 2;
+  }
+
+  // Decide win, draw or loss with the window (-1, 1) first, then narrow the
+  // distance within the side of 0 which that search found
+  int min = -1;
+  int max = 1;
+  for (bool exact = false;; exact = true) {
+    while (min < max) {
+      // Probe near 0 first, where the windows are cheapest
+      int med = min + (max - min) / 2;
+      if (med <= 0 && min / 2 < med) {
+        med = min / 2;
+      } else if (med >= 0 && max / 2 > med) {
+        med = max / 2;
+      }
+      int score = negamax(pos, med, med + 1);
+      if (aborted_) {
+        return 0;
+      }
+      if (score <= med) {
+        max = score;
+      } else {
+        min = score;
+      }
+    }
+
+    if (weak || exact || min == 0) {
+      break;
+    }
+    max = min > 0 ? std::min((SIZE + 1 - pos.numMoves) / 2, MAX_SCORE) : -1;
+    min = min > 0 ? 1 : std::max(-(SIZE - pos.numMoves) / 2, MIN_SCORE);
+  }
+
+  return weak ? (min > 0) - (min < 0) : min;
+}
+
+/*******************************************************************************
+ * AgentSolver::Position Implementation
+ ******************************************************************************/
+
+AgentSolver::Position::Position(const Board &board)
+    : current{board.getMask(board.getTurn())},
+      mask{board.getMask(0) | board.getMask(1)},
+      numMoves{static_cast<int>(board.getNumMoves())} {}
+
+uint64_t AgentSolver::Position::getKey() const { return current + mask; }
+
+uint64_t AgentSolver::Position::getLegalMask() const {
+  return (mask + Board::BOTTOM_MASK) & Board::BOARD_MASK;
+}
+
+bool AgentSolver::Position::canWinNext() const {
+  return Board::getWinningPositions(current) & getLegalMask();
+}
+
+uint64_t AgentSolver::Position::getNonLosingMoves() const {
+  // The opponent's winning positions which are still open
+  uint64_t legal = getLegalMask();
+  uint64_t threats = Board::getWinningPositions(current ^ mask) &
+                     (Board::BOARD_MASK ^ mask);
+
+  // An immediate threat must be blocked, and two cannot both be blocked
+  uint64_t forced = legal & threats;
+  if (forced) {
+    if (forced & (forced - 1)) {
+      return 0;
+    }
+    legal = forced;
+  }
+
+  // Never play directly below a threat of the opponent
+  return legal & ~(threats >> 1);
+}
+
+int AgentSolver::Position::getMoveScore(uint64_t move) const {
+  return __builtin_popcountll(Board::getWinningPositions(current | move) &
+                              (Board::BOARD_MASK ^ (mask | move)));
+}
+
+void AgentSolver::Position::play(uint64_t move) {
+  current ^= mask;
+  mask |= move;
+  ++numMoves;
+}
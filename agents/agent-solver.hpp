@@ -0,0 +1,213 @@
+/**
+ * \file agent-solver.hpp
+ * \copyright Matthew Calligaro
+ * \date December 2019
+ * \brief Declares the AgentSolver class
+ */
+
+#ifndef AGENTS_AGENT_SOLVER_HPP_
+#define AGENTS_AGENT_SOLVER_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "agent.hpp"
+
+/**
+ * \class AgentSolver
+ * \brief An agent which plays perfectly by solving the game exactly
+ * \note The score of a position is from the perspective of the player to
+ * move: 0 for a draw, and otherwise positive for a win and negative for a
+ * loss, with a larger magnitude the sooner the game ends.  A player who wins
+ * with their k-th piece scores (Board::SIZE + 3) / 2 - k as the first player
+ * and (Board::SIZE + 2) / 2 - k as the second (22 - k either way on the 7x6
+ * board), so the score is between MIN_SCORE and MAX_SCORE.
+ * \note The search is a negamax with alpha-beta pruning which only considers
+ * moves that do not hand the opponent an immediate win, tries the moves
+ * which create the most threats first, and stores bounds in a transposition
+ * table.  The exact score is found with a sequence of null-window searches:
+ * the first decides win, draw or loss, and the rest narrow the distance.
+ */
+class AgentSolver : public Agent {
+ public:
+  /** \brief The default memory budget of the transposition table */
+  static const size_t DEFAULT_TABLE_BYTES = 1 << 26;
+
+  /**
+   * \brief The lowest possible score (losing to the opponent's
+   * Board::CONNECT-th piece)
+   */
+  static const int MIN_SCORE =
+      static_cast<int>(Board::CONNECT) - static_cast<int>(Board::SIZE + 2) / 2;
+
+  /**
+   * \brief The highest possible score (winning with the Board::CONNECT-th
+   * piece)
+   */
+  static const int MAX_SCORE =
+      static_cast<int>(Board::SIZE + 3) / 2 - static_cast<int>(Board::CONNECT);
+
+  AgentSolver();
+
+  /**
+   * \brief Creates a solver with a specified transposition table size
+   * \param tableBytes    The memory budget of the transposition table
+   */
+  explicit AgentSolver(size_t tableBytes);
+
+  /**
+   * \note Plays the move with the best score.  If the position cannot be
+   * solved before endTime, plays the best move among the moves solved so far,
+   * or else the first move in MOVE_ORDER which does not lose immediately.
+   */
+  void getMove(const Board &board, size_t &move,
+               const std::chrono::system_clock::time_point &endTime) override;
+
+  std::string getAgentName() const override;
+
+  /**
+   * \brief Computes the exact score of a board
+   * \param board   The board to solve, which must not be finished
+   * \param weak    True to only find the sign of the score (win, draw or loss)
+   * \returns The score of the board for the player to move (-1, 0 or 1 if
+   * weak)
+   */
+  int solve(const Board &board, bool weak = false);
+
+  /**
+   * \brief Returns the number of positions searched by the last call to
+   * solve or getMove
+   * \returns The number of positions searched
+   */
+  size_t getNodeCount() const;
+
+  /**
+   * \brief Sets whether a position and its mirror image share table entries
+   * \param symmetric   True to key the table by the smaller of the keys of
+   * the position and its mirror image
+   */
+  void setSymmetric(bool symmetric);
+
+ private:
+  /**
+   * \struct Position
+   * \brief A board stored as the pieces of the player to move and of both
+   * players, which is all that the search needs
+   */
+  struct Position {
+    /** \brief The pieces of the player to move */
+    uint64_t current;
+
+    /** \brief The pieces of both players */
+    uint64_t mask;
+
+    /** \brief The number of pieces on the board */
+    int numMoves;
+
+    /**
+     * \brief Creates the position of a board
+     * \param board   The board
+     */
+    explicit Position(const Board &board);
+
+    /**
+     * \brief Computes a key which uniquely identifies the position
+     * \returns A key below 2^50
+     */
+    uint64_t getKey() const;
+
+    /**
+     * \brief Determines the positions at which a piece can be placed
+     * \returns A bitmask with the lowest open position of each column set
+     */
+    uint64_t getLegalMask() const;
+
+    /**
+     * \brief Determines whether the player to move can win immediately
+     * \returns True if a legal move completes N in a row (Board::CONNECT)
+     */
+    bool canWinNext() const;
+
+    /**
+     * \brief Determines the moves which do not let the opponent win at once
+     * \returns A bitmask of the legal moves after which the opponent cannot
+     * win immediately (0 if every move loses)
+     * \note Assumes that the player to move cannot win immediately
+     */
+    uint64_t getNonLosingMoves() const;
+
+    /**
+     * \brief Scores a move for move ordering
+     * \param move    A bitmask with the position of the move set
+     * \returns The number of open positions at which the player to move would
+     * complete N in a row after the move
+     */
+    int getMoveScore(uint64_t move) const;
+
+    /**
+     * \brief Plays a move for the player to move
+     * \param move    A bitmask with the position of the move set
+     */
+    void play(uint64_t move);
+  };
+
+  /** \brief The number of positions between checks of the deadline */
+  static const size_t CHECK_INTERVAL = 1 << 12;
+
+  /** \brief The transposition table, one 64-bit entry per slot */
+  std::unique_ptr<uint64_t[]> table_;
+
+  /** \brief The number of slots minus one (the slots are a power of 2) */
+  size_t tableMask_;
+
+  /** \brief The number of positions searched by the current solve */
+  size_t numNodes_;
+
+  /** \brief The time at which the current search is abandoned */
+  std::chrono::system_clock::time_point endTime_;
+
+  /** \brief True once the current search has passed endTime_ */
+  bool aborted_;
+
+  /** \brief True if a position and its mirror image share table entries */
+  bool symmetric_;
+
+  /**
+   * \brief Looks up the bound stored for a position
+   * \param key     The key of the position
+   * \returns The stored value (0 if the position is not stored)
+   * \note A value v at most MAX_SCORE - MIN_SCORE + 1 is the upper bound
+   * v + MIN_SCORE - 1, and a larger value is the lower bound
+   * v + 2 * MIN_SCORE - MAX_SCORE - 2
+   */
+  int probe(uint64_t key) const;
+
+  /**
+   * \brief Stores a bound for a position, replacing the slot's entry
+   * \param key     The key of the position
+   * \param value   The encoded bound (see probe)
+   */
+  void store(uint64_t key, int value);
+
+  /**
+   * \brief Finds the score of a position within a window
+   * \param pos     The position, in which the player to move cannot win
+   * immediately
+   * \param alpha   The lower bound of the window
+   * \param beta    The upper bound of the window
+   * \returns The exact score if it lies within (alpha, beta), and otherwise
+   * a bound on the score: at most alpha, or at least beta
+   */
+  int negamax(const Position &pos, int alpha, int beta);
+
+  /**
+   * \brief Finds the score of a position with a sequence of null windows
+   * \param pos     The position, which must not be finished
+   * \param weak    True to only find the sign of the score
+   * \returns The score of the position (meaningless if the search aborted)
+   */
+  int solvePosition(const Position &pos, bool weak);
+};
+
+#endif  // AGENTS_AGENT_SOLVER_HPP_
@@ -2,7 +2,7 @@
  * \file agent.hpp
  * \copyright Matthew Calligaro
  * \date December 2019
- * \brief Declares the Agent class
+ * \brief Declares the BasicAgent class template
  */
 
 #ifndef AGENTS_AGENT_HPP_
@@ -13,12 +13,14 @@
 #include "../board.hpp"
 
 /**
- * \class Agent
+ * \class BasicAgent
  * \brief An abstract class defining a Connect 4 agent
+ * \tparam B   The board type on which the agent plays (see BasicBoard)
  */
-class Agent {
+template <typename B>
+class BasicAgent {
  public:
-  virtual ~Agent() = default;
+  virtual ~BasicAgent() = default;
 
   /**
    * \brief Calculates the next move to be taken by the agent
@@ -27,7 +29,7 @@ class Agent {
    * \param endTime The agent should return before this time, or as ASAP after
    */
   virtual void getMove(
-      const Board &board, size_t &move,
+      const B &board, size_t &move,
       const std::chrono::system_clock::time_point &endTime) = 0;
 
   /**
@@ -37,4 +39,7 @@ class Agent {
   virtual std::string getAgentName() const = 0;
 };
 
+/** \brief An agent for the standard board */
+typedef BasicAgent<Board> Agent;
+
 #endif  // AGENTS_AGENT_HPP_
@@ -0,0 +1,554 @@
+/**
+ * \file rollout-policy.cpp
+ * \copyright Matthew Calligaro
+ * \date December 2019
+ * \brief Implements the RolloutPolicy classes used by AgentMCTS
+ */
+
+#include "rollout-policy.hpp"
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+/*******************************************************************************
+ * RolloutPolicy Implementation
+ ******************************************************************************/
+
+std::unique_ptr<RolloutPolicy> RolloutPolicy::create(Type type,
+                                                     uint64_t seed) {
+  switch (type) {
+    case MINIMAX:
+      return std::unique_ptr<RolloutPolicy>(new MinimaxRolloutPolicy());
+    case BATCH:
+      return std::unique_ptr<RolloutPolicy>(new BatchRolloutPolicy(seed));
+    default:
+      return std::unique_ptr<RolloutPolicy>(new RandomRolloutPolicy(seed));
+  }
+}
+
+float RolloutPolicy::playoutGames(const Board &board, Game *games) {
+  Board end = board;
+  float reward = playout(end);
+  games->masks[0] = end.getMask(0);
+  games->masks[1] = end.getMask(1);
+  games->reward = static_cast<int32_t>(reward);
+  return reward;
+}
+
+size_t RolloutPolicy::getBatchSize() const { return 1; }
+
+/*******************************************************************************
+ * RandomRolloutPolicy Implementation
+ ******************************************************************************/
+
+RandomRolloutPolicy::RandomRolloutPolicy(uint64_t seed) {
+  // Scramble the seed (splitmix64) so that nearby seeds give unrelated
+  // streams, and so that the state is never 0
+  seed += 0x9E3779B97F4A7C15UL;
+  seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9UL;
+  seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBUL;
+  state_ = (seed ^ (seed >> 31)) | 1;
+}
+
+float RandomRolloutPolicy::playout(Board &board) {
+  if (board.isWon() || board.isDraw()) {
+    return board.getReward();
+  }
+
+  while (uint64_t legal = board.getLegalMask()) {
+    // If the player to move can win, the game is decided
+    size_t turn = board.getTurn();
+    if (board.getThreatMask(turn) & legal) {
+      return turn ? -1 : 1;
+    }
+
+    // Otherwise block the opponent's win, or else play any legal move
+    uint64_t blocks = board.getThreatMask(1 - turn) & legal;
+    uint64_t position = chooseBit(blocks ? blocks : legal);
+    board.handleMove(__builtin_ctzll(position) / Board::COLUMN_BITS);
+  }
+
+  // Neither player won before the board filled up
+  return 0;
+}
+
+std::string RandomRolloutPolicy::getName() const { return "Random"; }
+
+uint64_t RandomRolloutPolicy::next() {
+  state_ ^= state_ >> 12;
+  state_ ^= state_ << 25;
+  state_ ^= state_ >> 27;
+  return state_ * 0x2545F4914F6CDD1DUL;
+}
+
+uint64_t RandomRolloutPolicy::chooseBit(uint64_t mask) {
+  // Map the random number onto [0, popcount) without a division, then clear
+  // that many of the lowest set bits
+  size_t skip = ((next() >> 32) * __builtin_popcountll(mask)) >> 32;
+  for (; skip; --skip) {
+    mask &= mask - 1;
+  }
+  return mask & -mask;
+}
+
+/*******************************************************************************
+ * Batch Playout Kernels
+ ******************************************************************************/
+
+namespace {
+
+// Every lane of a kernel holds the pieces of a player in 64 bits
+static_assert(sizeof(Board::Mask) == sizeof(uint64_t),
+              "The batch kernels need boards with 64-bit masks");
+
+const uint64_t BOTTOM = Board::BOTTOM_MASK;
+const uint64_t FULL = Board::BOARD_MASK;
+const uint64_t COLUMN = Board::COLUMN_MASK;
+const uint64_t WIDTH = Board::WIDTH;
+const uint64_t COLUMN_BITS = Board::COLUMN_BITS;
+
+const size_t CONNECT = Board::CONNECT;
+
+/**
+ * \brief Computes the positions which would complete N for a player
+ * \param mask  The pieces of the player
+ * \returns The winning positions (see Board::getThreatMask)
+ */
+uint64_t winningPositions(uint64_t mask) {
+  return Board::getWinningPositions(mask);
+}
+
+/**
+ * \brief Records where one game of a batch stopped
+ * \param me      The pieces of the player to move
+ * \param opp     The pieces of the other player
+ * \param sign    The reward if the player to move wins
+ * \param reward  The reward of the game
+ * \param game    Where to record the game, or nullptr (output)
+ */
+void recordLane(uint64_t me, uint64_t opp, int64_t sign, int64_t reward,
+                RolloutPolicy::Game *game) {
+  if (game) {
+    game->masks[0] = sign > 0 ? me : opp;
+    game->masks[1] = sign > 0 ? opp : me;
+    game->reward = static_cast<int32_t>(reward);
+  }
+}
+
+/**
+ * \brief Plays one game of a batch with plain 64-bit instructions
+ * \param me    The pieces of the player to move
+ * \param opp   The pieces of the other player
+ * \param sign  The reward if the player to move wins
+ * \param s0    The first word of the lane's xorshift128+ state (modified)
+ * \param s1    The second word of the lane's xorshift128+ state (modified)
+ * \param game  Where to record the game, or nullptr (output)
+ * \returns The reward of the finished game
+ */
+int64_t playLane(uint64_t me, uint64_t opp, int64_t sign, uint64_t &s0,
+                 uint64_t &s1, RolloutPolicy::Game *game) {
+  while (uint64_t legal = ((me | opp) + BOTTOM) & FULL) {
+    // The player to move wins if they can, and otherwise blocks
+    if (winningPositions(me) & legal) {
+      recordLane(me, opp, sign, sign, game);
+      return sign;
+    }
+    uint64_t blocks = winningPositions(opp) & legal;
+    uint64_t move = blocks & -blocks;
+
+    // Otherwise draw random columns until one is legal
+    while (!move) {
+      uint64_t x = s0;
+      uint64_t y = s1;
+      uint64_t r = x + y;
+      x ^= x << 23;
+      s0 = y;
+      s1 = x ^ y ^ (x >> 17) ^ (y >> 26);
+      uint64_t col = ((r >> 32) * WIDTH) >> 32;
+      move = legal & (COLUMN << (col * COLUMN_BITS));
+    }
+
+    std::swap(me, opp);
+    opp |= move;
+    sign = -sign;
+  }
+  recordLane(me, opp, sign, 0, game);
+  return 0;
+}
+
+#if defined(__x86_64__)
+
+/**
+ * \brief Computes the winning positions of one direction for 4 lanes
+ * \tparam SHIFT  The distance between adjacent positions of the direction
+ */
+template <int SHIFT>
+__attribute__((target("avx2"))) __m256i lineWins256(__m256i m) {
+  // See Board::getWinningPositions
+  __m256i before[CONNECT];
+  __m256i after[CONNECT];
+  before[0] = after[0] = _mm256_set1_epi64x(-1);
+  for (size_t j = 1; j < CONNECT; ++j) {
+    before[j] =
+        _mm256_and_si256(before[j - 1], _mm256_slli_epi64(m, j * SHIFT));
+    after[j] = _mm256_and_si256(after[j - 1], _mm256_srli_epi64(m, j * SHIFT));
+  }
+  __m256i r = _mm256_setzero_si256();
+  for (size_t j = 0; j < CONNECT; ++j) {
+    r = _mm256_or_si256(r, _mm256_and_si256(before[j], after[CONNECT - 1 - j]));
+  }
+  return r;
+}
+
+/** \brief winningPositions for 4 lanes */
+__attribute__((target("avx2"))) __m256i winningPositions256(__m256i m) {
+  __m256i r = _mm256_set1_epi64x(-1);
+  for (size_t j = 1; j < CONNECT; ++j) {
+    r = _mm256_and_si256(r, _mm256_slli_epi64(m, j));
+  }
+  r = _mm256_or_si256(r, lineWins256<Board::COLUMN_BITS - 1>(m));
+  r = _mm256_or_si256(r, lineWins256<Board::COLUMN_BITS>(m));
+  return _mm256_or_si256(r, lineWins256<Board::COLUMN_BITS + 1>(m));
+}
+
+/**
+ * \brief Plays 4 games of a batch in lockstep with AVX2 instructions
+ * \param me    The pieces of the player to move
+ * \param opp   The pieces of the other player
+ * \param sign  The reward if the player to move wins
+ * \param s0    The first words of the lanes' xorshift128+ states (modified)
+ * \param s1    The second words of the lanes' xorshift128+ states (modified)
+ * \param games Where to record the 4 games, or nullptr (output)
+ * \returns The sum of the rewards of the finished games
+ * \note Lanes are masks of all ones or all zeros: a finished game stops
+ * changing, and only lanes which still need a move advance their generator
+ */
+__attribute__((target("avx2"))) int64_t playLanes256(
+    uint64_t me, uint64_t opp, int64_t sign, uint64_t *s0, uint64_t *s1,
+    RolloutPolicy::Game *games) {
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i bottom = _mm256_set1_epi64x(BOTTOM);
+  const __m256i full = _mm256_set1_epi64x(FULL);
+  const __m256i column = _mm256_set1_epi64x(COLUMN);
+  const __m256i width = _mm256_set1_epi64x(WIDTH);
+  const __m256i columnBits = _mm256_set1_epi64x(COLUMN_BITS);
+  __m256i cur = _mm256_set1_epi64x(me);
+  __m256i other = _mm256_set1_epi64x(opp);
+  __m256i x = _mm256_loadu_si256(reinterpret_cast<__m256i *>(s0));
+  __m256i y = _mm256_loadu_si256(reinterpret_cast<__m256i *>(s1));
+  __m256i active = _mm256_cmpeq_epi64(zero, zero);
+  __m256i result = zero;
+  while (true) {
+    // A lane with no legal move is a draw
+    __m256i legal = _mm256_and_si256(
+        _mm256_add_epi64(_mm256_or_si256(cur, other), bottom), full);
+    active = _mm256_andnot_si256(_mm256_cmpeq_epi64(legal, zero), active);
+
+    // A lane in which the player to move can win is decided
+    __m256i wins = _mm256_andnot_si256(
+        _mm256_cmpeq_epi64(
+            _mm256_and_si256(winningPositions256(cur), legal), zero),
+        active);
+    result = _mm256_or_si256(
+        result, _mm256_and_si256(wins, _mm256_set1_epi64x(sign)));
+    active = _mm256_andnot_si256(wins, active);
+    if (_mm256_testz_si256(active, active)) {
+      break;
+    }
+
+    // Block, or else draw random columns until one is legal
+    __m256i blocks =
+        _mm256_and_si256(winningPositions256(other), legal);
+    __m256i move = _mm256_and_si256(blocks, _mm256_sub_epi64(zero, blocks));
+    __m256i need = _mm256_and_si256(_mm256_cmpeq_epi64(move, zero), active);
+    while (!_mm256_testz_si256(need, need)) {
+      __m256i r = _mm256_add_epi64(x, y);
+      __m256i nx = _mm256_xor_si256(x, _mm256_slli_epi64(x, 23));
+      __m256i ny = _mm256_xor_si256(
+          _mm256_xor_si256(nx, y),
+          _mm256_xor_si256(_mm256_srli_epi64(nx, 17),
+                           _mm256_srli_epi64(y, 26)));
+      x = _mm256_blendv_epi8(x, y, need);
+      y = _mm256_blendv_epi8(y, ny, need);
+
+      __m256i col = _mm256_srli_epi64(
+          _mm256_mul_epu32(_mm256_srli_epi64(r, 32), width), 32);
+      __m256i shift = _mm256_mul_epu32(col, columnBits);
+      __m256i candidate =
+          _mm256_and_si256(legal, _mm256_sllv_epi64(column, shift));
+      move = _mm256_or_si256(move, _mm256_and_si256(candidate, need));
+      need = _mm256_and_si256(need, _mm256_cmpeq_epi64(candidate, zero));
+    }
+
+    move = _mm256_and_si256(move, active);
+    __m256i next = _mm256_or_si256(cur, move);
+    cur = other;
+    other = next;
+    sign = -sign;
+  }
+
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(s0), x);
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(s1), y);
+  int64_t lanes[4];
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), result);
+  if (games) {
+    // Every lane has stopped with the same player to move
+    uint64_t curLanes[4];
+    uint64_t otherLanes[4];
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(curLanes), cur);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(otherLanes), other);
+    for (size_t i = 0; i < 4; ++i) {
+      recordLane(curLanes[i], otherLanes[i], sign, lanes[i], games + i);
+    }
+  }
+  return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+// The AVX-512 intrinsics of some GCC versions start from an undefined
+// register, which -Wall reports as uninitialized
+#pragma GCC diagnostic push
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+/**
+ * \brief Computes the winning positions of one direction for 8 lanes
+ * \tparam SHIFT  The distance between adjacent positions of the direction
+ */
+template <int SHIFT>
+__attribute__((target("avx512f"))) __m512i lineWins512(__m512i m) {
+  // See Board::getWinningPositions
+  __m512i before[CONNECT];
+  __m512i after[CONNECT];
+  before[0] = after[0] = _mm512_set1_epi64(-1);
+  for (size_t j = 1; j < CONNECT; ++j) {
+    before[j] =
+        _mm512_and_si512(before[j - 1], _mm512_slli_epi64(m, j * SHIFT));
+    after[j] = _mm512_and_si512(after[j - 1], _mm512_srli_epi64(m, j * SHIFT));
+  }
+  __m512i r = _mm512_setzero_si512();
+  for (size_t j = 0; j < CONNECT; ++j) {
+    r = _mm512_or_si512(r, _mm512_and_si512(before[j], after[CONNECT - 1 - j]));
+  }
+  return r;
+}
+
+/** \brief winningPositions for 8 lanes */
+__attribute__((target("avx512f"))) __m512i winningPositions512(__m512i m) {
+  __m512i r = _mm512_set1_epi64(-1);
+  for (size_t j = 1; j < CONNECT; ++j) {
+    r = _mm512_and_si512(r, _mm512_slli_epi64(m, j));
+  }
+  r = _mm512_or_si512(r, lineWins512<Board::COLUMN_BITS - 1>(m));
+  r = _mm512_or_si512(r, lineWins512<Board::COLUMN_BITS>(m));
+  return _mm512_or_si512(r, lineWins512<Board::COLUMN_BITS + 1>(m));
+}
+
+/**
+ * \brief Plays 8 games of a batch in lockstep with AVX-512 instructions
+ * \note See playLanes256, except that lanes are selected by mask registers
+ */
+__attribute__((target("avx512f"))) int64_t playLanes512(
+    uint64_t me, uint64_t opp, int64_t sign, uint64_t *s0, uint64_t *s1,
+    RolloutPolicy::Game *games) {
+  const __m512i zero = _mm512_setzero_si512();
+  const __m512i bottom = _mm512_set1_epi64(BOTTOM);
+  const __m512i full = _mm512_set1_epi64(FULL);
+  const __m512i column = _mm512_set1_epi64(COLUMN);
+  const __m512i width = _mm512_set1_epi64(WIDTH);
+  const __m512i columnBits = _mm512_set1_epi64(COLUMN_BITS);
+  __m512i cur = _mm512_set1_epi64(me);
+  __m512i other = _mm512_set1_epi64(opp);
+  __m512i x = _mm512_loadu_si512(s0);
+  __m512i y = _mm512_loadu_si512(s1);
+  __mmask8 active = 0xFF;
+  __m512i result = zero;
+  while (true) {
+    // A lane with no legal move is a draw
+    __m512i legal = _mm512_and_si512(
+        _mm512_add_epi64(_mm512_or_si512(cur, other), bottom), full);
+    active &= _mm512_test_epi64_mask(legal, legal);
+
+    // A lane in which the player to move can win is decided
+    __mmask8 wins = _mm512_mask_test_epi64_mask(
+        active, winningPositions512(cur), legal);
+    result = _mm512_mask_mov_epi64(result, wins, _mm512_set1_epi64(sign));
+    active &= ~wins;
+    if (!active) {
+      break;
+    }
+
+    // Block, or else draw random columns until one is legal
+    __m512i blocks = _mm512_and_si512(winningPositions512(other), legal);
+    __m512i move = _mm512_and_si512(blocks, _mm512_sub_epi64(zero, blocks));
+    __mmask8 need = active & ~_mm512_test_epi64_mask(move, move);
+    while (need) {
+      __m512i r = _mm512_add_epi64(x, y);
+      __m512i nx = _mm512_xor_si512(x, _mm512_slli_epi64(x, 23));
+      __m512i ny = _mm512_xor_si512(
+          _mm512_xor_si512(nx, y),
+          _mm512_xor_si512(_mm512_srli_epi64(nx, 17),
+                           _mm512_srli_epi64(y, 26)));
+      x = _mm512_mask_mov_epi64(x, need, y);
+      y = _mm512_mask_mov_epi64(y, need, ny);
+
+      __m512i col = _mm512_srli_epi64(
+          _mm512_mul_epu32(_mm512_srli_epi64(r, 32), width), 32);
+      __m512i shift = _mm512_mul_epu32(col, columnBits);
+      __m512i candidate =
+          _mm512_and_si512(legal, _mm512_sllv_epi64(column, shift));
+      move = _mm512_mask_mov_epi64(move, need, candidate);
+      need &= ~_mm512_test_epi64_mask(candidate, candidate);
+    }
+
+    move = _mm512_maskz_mov_epi64(active, move);
+    __m512i next = _mm512_or_si512(cur, move);
+    cur = other;
+    other = next;
+    sign = -sign;
+  }
+
+  _mm512_storeu_si512(s0, x);
+  _mm512_storeu_si512(s1, y);
+  if (games) {
+    // Every lane has stopped with the same player to move
+    int64_t lanes[8];
+    uint64_t curLanes[8];
+    uint64_t otherLanes[8];
+    _mm512_storeu_si512(lanes, result);
+    _mm512_storeu_si512(curLanes, cur);
+    _mm512_storeu_si512(otherLanes, other);
+    for (size_t i = 0; i < 8; ++i) {
+      recordLane(curLanes[i], otherLanes[i], sign, lanes[i], games + i);
+    }
+  }
+  return _mm512_reduce_add_epi64(result);
+}
+
+#pragma GCC diagnostic pop
+
+#endif
+
+}  // namespace
+
+/*******************************************************************************
+ * BatchRolloutPolicy Implementation
+ ******************************************************************************/
+
+BatchRolloutPolicy::BatchRolloutPolicy(uint64_t seed, size_t batchSize,
+                                       Backend backend)
+    : batchSize_{batchSize <= 4 ? 4u : batchSize <= 8 ? 8u : 16u} {
+  // Round the batch to 4, 8 or 16 games so that it fills whole registers, and
+  // use the widest supported instruction set which the batch fills
+  if ((backend == AUTO || backend == AVX512) && isSupported(AVX512) &&
+      batchSize_ % 8 == 0) {
+    backend_ = AVX512;
+  } else if (backend != SCALAR && isSupported(AVX2)) {
+    backend_ = AVX2;
+  } else {
+    backend_ = SCALAR;
+  }
+
+  // Seed every lane from one splitmix64 stream, so that no state is 0
+  for (size_t word = 0; word < 2; ++word) {
+    for (size_t lane = 0; lane < MAX_BATCH_SIZE; ++lane) {
+      seed += 0x9E3779B97F4A7C15UL;
+      uint64_t z = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9UL;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBUL;
+      state_[word][lane] = (z ^ (z >> 31)) | 1;
+    }
+  }
+}
+
+float BatchRolloutPolicy::playout(Board &board) {
+  return playBatch(board, nullptr);
+}
+
+float BatchRolloutPolicy::playoutGames(const Board &board, Game *games) {
+  return playBatch(board, games);
+}
+
+float BatchRolloutPolicy::playBatch(const Board &board, Game *games) {
+  size_t turn = board.getTurn();
+  uint64_t me = board.getMask(turn);
+  uint64_t opp = board.getMask(1 - turn);
+  int64_t sign = turn ? -1 : 1;
+  if (board.isWon() || board.isDraw()) {
+    for (size_t lane = 0; games && lane < batchSize_; ++lane) {
+      recordLane(me, opp, sign, board.getReward(), games + lane);
+    }
+    return board.getReward() * batchSize_;
+  }
+
+  int64_t total = 0;
+  for (size_t lane = 0; lane < batchSize_;) {
+    uint64_t *s0 = state_[0] + lane;
+    uint64_t *s1 = state_[1] + lane;
+    Game *laneGames = games ? games + lane : nullptr;
+    switch (backend_) {
+#if defined(__x86_64__)
+      case AVX512:
+        total += playLanes512(me, opp, sign, s0, s1, laneGames);
+        lane += 8;
+        break;
+      case AVX2:
+        total += playLanes256(me, opp, sign, s0, s1, laneGames);
+        lane += 4;
+        break;
+#endif
+      default:
+        total += playLane(me, opp, sign, *s0, *s1, laneGames);
+        lane += 1;
+        break;
+    }
+  }
+  return total;
+}
+
+std::string BatchRolloutPolicy::getName() const {
+  const char *names[4] = {"Auto", "Scalar", "AVX2", "AVX-512"};
+  return "Batch x" + std::to_string(batchSize_) + " (" + names[backend_] + ")";
+}
+
+size_t BatchRolloutPolicy::getBatchSize() const { return batchSize_; }
+
+BatchRolloutPolicy::Backend BatchRolloutPolicy::getBackend() const {
+  return backend_;
+}
+
+bool BatchRolloutPolicy::isSupported(Backend backend) {
+#if defined(__x86_64__)
+  switch (backend) {
+    case AVX512:
+      return __builtin_cpu_supports("avx512f");
+    case AVX2:
+      return __builtin_cpu_supports("avx2");
+    default:
+      return true;
+  }
+#else
+  return backend == AUTO || backend == SCALAR;
+#endif
+}
+
+/*******************************************************************************
+ * MinimaxRolloutPolicy Implementation
+ ******************************************************************************/
+
+MinimaxRolloutPolicy::MinimaxRolloutPolicy() : agent_(3, true) {}
+
+float MinimaxRolloutPolicy::playout(Board &board) {
+  size_t move;
+  while (!(board.isWon() || board.isDraw())) {
+    agent_.getMove(board, move, std::chrono::system_clock::time_point::max());
+    board.handleMove(move);
+  }
+  return board.getReward();
+}
+
+std::string MinimaxRolloutPolicy::getName() const { return "Minimax"; }
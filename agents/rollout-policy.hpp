@@ -0,0 +1,226 @@
+/**
+ * \file rollout-policy.hpp
+ * \copyright Matthew Calligaro
+ * \date December 2019
+ * \brief Declares the RolloutPolicy classes used by AgentMCTS
+ */
+
+#ifndef AGENTS_ROLLOUT_POLICY_HPP_
+#define AGENTS_ROLLOUT_POLICY_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "../board.hpp"
+#include "agent-benchmark.hpp"
+
+/**
+ * \class RolloutPolicy
+ * \brief Plays a game to completion from a board state during MCTS
+ * \note A policy keeps its own random state, so each searching thread needs
+ * its own policy
+ */
+class RolloutPolicy {
+ public:
+  /** \brief The rollout policies which can be created */
+  enum Type {
+    /** \brief Random moves which take immediate wins and block threats */
+    RANDOM,
+    /** \brief Moves chosen by a depth 3 minimax with a random heuristic */
+    MINIMAX,
+    /** \brief RANDOM games played several at a time with SIMD instructions */
+    BATCH
+  };
+
+  /**
+   * \struct Game
+   * \brief Where one game of a playout stopped
+   */
+  struct Game {
+    /** \brief The pieces of X and of O (see Board::getMask) */
+    Board::Mask masks[2];
+
+    /** \brief The reward of the game (see playout) */
+    int32_t reward;
+  };
+
+  virtual ~RolloutPolicy() = default;
+
+  /**
+   * \brief Creates a rollout policy
+   * \param type  The type of policy to create
+   * \param seed  The seed of the policy's random number generator
+   * \returns The new policy
+   */
+  static std::unique_ptr<RolloutPolicy> create(Type type, uint64_t seed);
+
+  /**
+   * \brief Plays getBatchSize() games to completion
+   * \param board   The board state at which to begin (modified)
+   * \returns The sum of the rewards of the finished games, where each reward
+   * is 1 if X won, -1 if O won, and 0 for a draw
+   * \note The policy may stop once the winner is certain, so board is not
+   * necessarily a finished game afterwards
+   */
+  virtual float playout(Board &board) = 0;
+
+  /**
+   * \brief Plays getBatchSize() games to completion and records where each
+   * game stopped
+   * \param board   The board state at which to begin
+   * \param games   Where to record the getBatchSize() games (output)
+   * \returns The sum of the rewards of the games (see playout)
+   * \note By default, plays a single game with playout on a copy of board
+   */
+  virtual float playoutGames(const Board &board, Game *games);
+
+  /**
+   * \brief Returns the name of the policy
+   * \returns The name of the policy
+   */
+  virtual std::string getName() const = 0;
+
+  /**
+   * \brief Returns the number of games played by each call to playout
+   * \returns The number of games (1 unless the policy plays a batch)
+   */
+  virtual size_t getBatchSize() const;
+};
+
+/**
+ * \class RandomRolloutPolicy
+ * \brief A fast policy which plays random legal moves using bit operations
+ * \note The player to move wins immediately if they can, and otherwise must
+ * block an immediate win of the opponent if there is one
+ */
+class RandomRolloutPolicy : public RolloutPolicy {
+ public:
+  RandomRolloutPolicy() = delete;
+
+  /**
+   * \brief Creates a random rollout policy
+   * \param seed  The seed of the random number generator
+   */
+  explicit RandomRolloutPolicy(uint64_t seed);
+
+  float playout(Board &board) override;
+  std::string getName() const override;
+
+ private:
+  /** \brief The state of the xorshift random number generator */
+  uint64_t state_;
+
+  /**
+   * \brief Generates the next random number (xorshift64*)
+   * \returns A 64-bit random number
+   */
+  uint64_t next();
+
+  /**
+   * \brief Chooses one set bit of a mask uniformly at random
+   * \param mask  A non-zero bitmask
+   * \returns A mask with only the chosen bit set
+   */
+  uint64_t chooseBit(uint64_t mask);
+};
+
+/**
+ * \class BatchRolloutPolicy
+ * \brief Plays a batch of games with the rules of RandomRolloutPolicy in
+ * lockstep, one game per 64-bit lane of a SIMD register
+ * \note Every lane has its own xorshift128+ generator, and a lane only draws
+ * a random number when its own game needs one, so a lane plays the same game
+ * with every backend.  A lane chooses a random move by drawing random
+ * columns until one is legal.
+ * \note The board passed to playout is not modified, since the games of the
+ * batch end in different states, so use playoutGames to see the moves played
+ */
+class BatchRolloutPolicy : public RolloutPolicy {
+ public:
+  /** \brief The instruction sets which can play the batch */
+  enum Backend {
+    /** \brief The widest instruction set supported by this CPU */
+    AUTO,
+    /** \brief Plain 64-bit instructions, one game at a time */
+    SCALAR,
+    /** \brief 256-bit registers, 4 games at a time */
+    AVX2,
+    /** \brief 512-bit registers, 8 games at a time */
+    AVX512
+  };
+
+  /** \brief The default number of games in a batch */
+  static const size_t DEFAULT_BATCH_SIZE = 8;
+
+  /** \brief The largest number of games in a batch */
+  static const size_t MAX_BATCH_SIZE = 16;
+
+  BatchRolloutPolicy() = delete;
+
+  /**
+   * \brief Creates a batch rollout policy
+   * \param seed        The seed of the random number generators
+   * \param batchSize   The number of games in a batch (4, 8 or 16; other
+   * sizes are rounded up to one of these)
+   * \param backend     The instruction set to use (falls back to a narrower
+   * one if the CPU does not support it, or if the batch does not fill a
+   * register)
+   */
+  explicit BatchRolloutPolicy(uint64_t seed,
+                              size_t batchSize = DEFAULT_BATCH_SIZE,
+                              Backend backend = AUTO);
+
+  float playout(Board &board) override;
+  float playoutGames(const Board &board, Game *games) override;
+  std::string getName() const override;
+  size_t getBatchSize() const override;
+
+  /**
+   * \brief Returns the instruction set used to play the batch
+   * \returns The backend chosen when the policy was created (never AUTO)
+   */
+  Backend getBackend() const;
+
+  /**
+   * \brief Determines whether this CPU supports an instruction set
+   * \param backend   The instruction set
+   * \returns True if the backend can be used
+   */
+  static bool isSupported(Backend backend);
+
+ private:
+  /** \brief The number of games in a batch */
+  size_t batchSize_;
+
+  /** \brief The instruction set used to play the batch */
+  Backend backend_;
+
+  /** \brief The two words of the xorshift128+ state of each lane */
+  uint64_t state_[2][MAX_BATCH_SIZE];
+
+  /**
+   * \brief Plays the batch of games
+   * \param board   The board state at which to begin
+   * \param games   Where to record the games, or nullptr (output)
+   * \returns The sum of the rewards of the games (see playout)
+   */
+  float playBatch(const Board &board, Game *games);
+};
+
+/**
+ * \class MinimaxRolloutPolicy
+ * \brief A slow policy which chooses every move with a shallow minimax search
+ */
+class MinimaxRolloutPolicy : public RolloutPolicy {
+ public:
+  MinimaxRolloutPolicy();
+
+  float playout(Board &board) override;
+  std::string getName() const override;
+
+ private:
+  /** \brief The agent used to choose moves */
+  AgentBenchmark agent_;
+};
+
+#endif  // AGENTS_ROLLOUT_POLICY_HPP_
@@ -2,20 +2,25 @@
  * \file board.hpp
  * \copyright Matthew Calligaro
  * \date December 2019
- * \brief Declares the Board class
+ * \brief Declares and implements the BasicBoard class template
  */
 
 #ifndef BOARD_HPP_
 #define BOARD_HPP_
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <ostream>
+#include <type_traits>
 #include <vector>
 
 using std::vector;
 
-// Bitboard encoding
+/** \brief An unsigned 128-bit integer for boards with more than 64 bits */
+__extension__ typedef unsigned __int128 uint128_t;
+
+// Bitboard encoding (7x6)
 // .  .  .  .  .  .  .  TOP
 // 5 12 19 26 33 40 47
 // 4 11 18 25 32 39 46
@@ -23,22 +28,126 @@ using std::vector;
 // 2  9 16 23 30 37 44
 // 1  8 15 22 29 36 43
 // 0  7 14 21 28 35 42  BOTTOM
+//
+// Every column uses H + 1 bits, the top one of which is always empty, so a
+// board of W columns uses W * (H + 1) bits.
+
+namespace board_geometry {
+/**
+ * \brief Orders the columns from the center outwards
+ * \returns The columns sorted by their distance from the center, with the
+ * left column of each pair first
+ */
+template <size_t W>
+constexpr std::array<size_t, W> makeMoveOrder() {
+  std::array<size_t, W> order = {};
+  size_t i = 0;
+  for (size_t distance = 0; distance < W; ++distance) {
+    // distance is twice the distance of a column from the center
+    for (size_t col = 0; col < W; ++col) {
+      if (2 * col + distance == W - 1 || 2 * col == W - 1 + distance) {
+        order[i++] = col;
+      }
+    }
+  }
+  return order;
+}
 
 /**
- * \class Board
- * \brief An efficient implementation of a Connect 4 board
+ * \brief Sets one bit in every column
+ * \returns A bitmask with the given row of each column set
  */
-class Board {
+template <typename Mask, size_t W, size_t H>
+constexpr Mask makeRowMask(size_t row) {
+  Mask mask = 0;
+  for (size_t col = 0; col < W; ++col) {
+    mask |= static_cast<Mask>(1) << (col * (H + 1) + row);
+  }
+  return mask;
+}
+
+/**
+ * \brief Generates the random values of the Zobrist hash at compile time
+ * \returns Values from the SplitMix64 generator with a fixed seed
+ */
+template <size_t BITS>
+constexpr std::array<std::array<uint64_t, BITS>, 2> makeZobrist() {
+  std::array<std::array<uint64_t, BITS>, 2> values = {};
+  uint64_t state = 0;
+  for (size_t player = 0; player < 2; ++player) {
+    for (size_t bit = 0; bit < BITS; ++bit) {
+      uint64_t z = state += 0x9E3779B97F4A7C15UL;
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9UL;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBUL;
+      values[player][bit] = z ^ (z >> 31);
+    }
+  }
+  return values;
+}
+}  // namespace board_geometry
+
+/**
+ * \class BasicBoard
+ * \brief An efficient implementation of a Connect N board of any size
+ * \tparam W    The number of columns
+ * \tparam H    The number of rows
+ * \tparam N    The number of tokens in a row which wins the game
+ * \note Every mask, shift and move order is computed at compile time from W
+ * and H.  Boards which fit in 64 bits use uint64_t bitmasks, and larger
+ * boards use uint128_t.
+ */
+template <size_t W, size_t H, size_t N = 4>
+class BasicBoard {
  public:
+  static_assert(N >= 2 && N <= W && N <= H, "A board must fit N in a row");
+  static_assert(W * (H + 1) <= 128, "A board must fit in 128 bits");
+
+  /** \brief The bitmask type which stores one bit per position */
+  typedef typename std::conditional<W * (H + 1) <= 64, uint64_t,
+                                    uint128_t>::type Mask;
+
+  static_assert((N - 1) * (H + 2) < sizeof(Mask) * 8,
+                "The shifts of a line of N must fit in a mask");
+
+  /** \brief The number of columns */
+  static constexpr size_t WIDTH = W;
+
+  /** \brief The number of rows */
+  static constexpr size_t HEIGHT = H;
+
+  /** \brief The number of positions (and the most moves in a game) */
+  static constexpr size_t SIZE = W * H;
+
+  /** \brief The number of tokens in a row which wins the game */
+  static constexpr size_t CONNECT = N;
+
+  /** \brief The number of bits used by each column */
+  static constexpr size_t COLUMN_BITS = H + 1;
+
   /** \brief The order of moves returned by getSuccessors */
-  static const size_t MOVE_ORDER[7];
+  static constexpr std::array<size_t, W> MOVE_ORDER =
+      board_geometry::makeMoveOrder<W>();
+
+  /** \brief A bitmask with the bottom position of each column set */
+  static constexpr Mask BOTTOM_MASK =
+      board_geometry::makeRowMask<Mask, W, H>(0);
+
+  /** \brief A bitmask with the top position of each column set */
+  static constexpr Mask TOP_MASK =
+      board_geometry::makeRowMask<Mask, W, H>(H - 1);
+
+  /** \brief A bitmask with every position in column 0 set */
+  static constexpr Mask COLUMN_MASK = (static_cast<Mask>(1) << H) - 1;
 
-  Board();
-  Board(const Board &other) = default;
-  Board(uint64_t xMask, uint64_t oMask);
-  ~Board() = default;
-  Board &operator=(const Board &other) = default;
-  bool operator==(const Board &rhs) const;
+  /** \brief A bitmask with every position on the board set */
+  static constexpr Mask BOARD_MASK = BOTTOM_MASK * COLUMN_MASK;
+
+  BasicBoard();
+  BasicBoard(const BasicBoard &other) = default;
+  BasicBoard(Mask xMask, Mask oMask);
+  ~BasicBoard() = default;
+  BasicBoard &operator=(const BasicBoard &other) = default;
+  bool operator==(const BasicBoard &rhs) const;
 
   /**
    * \brief Determines the player whose turn it is
@@ -46,6 +155,51 @@ class Board {
    */
   size_t getTurn() const;
 
+  /**
+   * \brief Determines the number of moves which have been played
+   * \returns The number of pieces on the board
+   */
+  size_t getNumMoves() const;
+
+  /**
+   * \brief Computes a key which uniquely identifies the board
+   * \returns A key of W * (H + 1) bits (49 for 7x6) which differs for every
+   * reachable board state
+   */
+  Mask getKey() const;
+
+  /**
+   * \brief Computes the key of the mirror image of the board
+   * \returns The key of the board with its columns in reverse order
+   */
+  Mask getMirroredKey() const;
+
+  /**
+   * \brief Computes a key shared by the board and its mirror image
+   * \returns The smaller of getKey() and getMirroredKey()
+   * \note A board and its mirror image have the same value, so a cache keyed
+   * by this key stores a single entry for both.  The best move of the mirror
+   * image is W - 1 - move.
+   */
+  Mask getCanonicalKey() const;
+
+  /**
+   * \brief Returns a well-mixed hash of the board
+   * \returns The Zobrist hash of the board: the XOR of a random 64-bit value
+   * for each piece, chosen by its player and position
+   * \note The hash is updated incrementally by handleMove and undoMove.
+   * Unlike getKey, every bit of the hash depends on every piece, so any
+   * subset of its bits can index a hash table.
+   */
+  uint64_t getHash() const;
+
+  /**
+   * \brief Returns the pieces of one player
+   * \param player  The player whose pieces are returned (0 for X, 1 for O)
+   * \returns A bitmask with the position of each of the player's pieces set
+   */
+  Mask getMask(size_t player) const;
+
   /**
    * \brief Determines if either player has won the game
    * \returns True if the game has been won
@@ -79,20 +233,63 @@ class Board {
 
   /**
    * \brief Determines the valid moves from the current board state (faster)
-   * \returns A size_t in which the first 7 bits indicate which moves are valid
-   * \note The bits correspond to the moves in MOVE_ORDER, so the 0th bit
-   * corresponds to collumn 3, the 1st bit corresponds to column 2, and so on
+   * \returns A size_t in which the first W bits indicate which moves are
+   * valid
+   * \note The bits correspond to the moves in MOVE_ORDER, so on a 7x6 board
+   * the 0th bit corresponds to collumn 3, the 1st bit corresponds to column 2,
+   * and so on
    */
   size_t getSuccessorsFast() const;
 
+  /**
+   * \brief Determines the positions at which a piece can be placed
+   * \returns A bitmask with the lowest open position of each column set
+   * \note Full columns contribute no bits to the mask
+   */
+  Mask getLegalMask() const;
+
   /**
    * \brief Calculates the number of threats for each player
    * \returns An array storing [X threats, O threats]
    * \note An X threat is any open space on the board for which there would be
-   * four X tokens in a row if an X token was placed there
+   * N X tokens in a row if an X token was placed there
    */
   std::array<size_t, 2> getThreatCount() const;
 
+  /**
+   * \brief Calculates the positions at which a player would win
+   * \param player  The player whose threats are computed (0 for X, 1 for O)
+   * \returns A bitmask of every open position which would give player N
+   * tokens in a row if player placed a token there
+   * \note AND the result with getLegalMask() to find the threats which can be
+   * played immediately
+   */
+  Mask getThreatMask(size_t player) const;
+
+  /**
+   * \brief Determines the moves which win the game at once
+   * \returns A bitmask of the legal positions which would give the player to
+   * move N tokens in a row
+   */
+  Mask winningMoves() const;
+
+  /**
+   * \brief Determines the moves with which the opponent would win at once
+   * \returns A bitmask of the legal positions which would give the player
+   * who moved last N tokens in a row, and so must be blocked
+   */
+  Mask opponentWinningMoves() const;
+
+  /**
+   * \brief Determines the moves after which the opponent cannot win at once
+   * \returns A bitmask of the legal positions which block every immediate
+   * win of the opponent and are not directly below a position at which the
+   * opponent would win (0 if every move lets the opponent win)
+   * \note Check winningMoves() first: a move which wins at once is better
+   * than any of these moves
+   */
+  Mask possibleNonLosingMoves() const;
+
   /**
    * \brief Returns the board formatted as a row-major 1D vector of chars
    * \returns The board formatted as a vector
@@ -111,40 +308,544 @@ class Board {
   /**
    * \brief Applies a move to the board in the given column
    * \param The column index in which the current player should play
+   * \note The column must not be full
    */
   void handleMove(size_t move);
 
+  /**
+   * \brief Removes the top piece of a column and gives the turn back
+   * \param move    The column of the most recent move
+   * \note move must be the column of the most recent move for the board to be
+   * restored to its previous state
+   */
+  void undoMove(size_t move);
+
+  /**
+   * \brief Calculates the positions which would complete N in a row
+   * \param mask    The bitmask representing the pieces of one player
+   * \returns A bitmask of every position (occupied or not) which would
+   * complete N in a row with the pieces in mask
+   */
+  static Mask getWinningPositions(Mask mask);
+
+  /**
+   * \brief Finds the lines of a given length in one direction
+   * \tparam LENGTH  The number of tokens in a line
+   * \param mask     The bitmask representing the pieces of one player
+   * \param shift    The distance between adjacent positions of a line (1 for
+   * vertical, COLUMN_BITS for horizontal, and COLUMN_BITS - 1 or
+   * COLUMN_BITS + 1 for the diagonals)
+   * \returns A bitmask with the first position of every line of LENGTH
+   * tokens set
+   * \note Doubles the length of the lines found with each shift, so it uses
+   * O(log LENGTH) shifts
+   */
+  template <size_t LENGTH>
+  static Mask getLines(Mask mask, size_t shift);
+
+  /**
+   * \brief Reverses the order of the columns of a bitmask
+   * \param mask    A bitmask which uses the COLUMN_BITS bits of each column,
+   * such as the pieces of a player or a key
+   * \returns The bitmask with column c moved to column W - 1 - c
+   */
+  static Mask mirror(Mask mask);
+
+  /**
+   * \brief Counts the set bits of a bitmask
+   * \param mask    The bitmask
+   * \returns The number of bits set in mask
+   */
+  static size_t popcount(Mask mask);
+
  private:
   /** \brief The X and O bitmasks representing the pieces on the board */
-  uint64_t masks_[2];
+  Mask masks_[2];
 
   /** \brief The player whose turn it is (0 for X, 1 for O) */
   size_t turn_;
 
+  /** \brief The Zobrist hash of the pieces on the board */
+  uint64_t hash_;
+
+  /**
+   * \brief The random values XORed into the hash, indexed by player and
+   * position
+   */
+  static constexpr std::array<std::array<uint64_t, W * (H + 1)>, 2> ZOBRIST =
+      board_geometry::makeZobrist<W * (H + 1)>();
+
   /**
    * \brief Determines whether a particular bitmask represents a win state
    * \param mask    The bitmask representing the pieces of one player
    * \returns 1 if the game is won for the player, 0 otherwise
    */
-  static size_t isWon(uint64_t mask);
+  static size_t isWon(Mask mask);
 
-  friend struct BoardHasher;
+  /**
+   * \brief Finds the lowest set bit of a bitmask
+   * \param mask    The bitmask, which must not be 0
+   * \returns The index of the lowest bit set in mask
+   */
+  static size_t lowestBit(Mask mask);
 };
 
+/**
+ * \class BasicMoveHistory
+ * \brief A board which records the moves applied to it so they can be undone
+ * \tparam W    The number of columns of the board
+ * \tparam H    The number of rows of the board
+ */
+template <size_t W, size_t H, size_t N = 4>
+class BasicMoveHistory {
+ public:
+  BasicMoveHistory();
+  explicit BasicMoveHistory(const BasicBoard<W, H, N> &board);
+  BasicMoveHistory(const BasicMoveHistory &other) = default;
+  ~BasicMoveHistory() = default;
+  BasicMoveHistory &operator=(const BasicMoveHistory &other) = default;
+
+  /**
+   * \brief Returns the current board state
+   * \returns The board with every recorded move applied
+   */
+  const BasicBoard<W, H, N> &getBoard() const;
+
+  /**
+   * \brief Returns the number of recorded moves
+   * \returns The number of moves which can be undone
+   */
+  size_t size() const;
+
+  /**
+   * \brief Returns the most recently recorded move
+   * \returns The column of the last move (undefined if size() is 0)
+   */
+  size_t lastMove() const;
+
+  /**
+   * \brief Applies a move to the board and records it
+   * \param move    The column index in which the current player should play
+   */
+  void handleMove(size_t move);
+
+  /**
+   * \brief Undoes the most recently recorded move
+   */
+  void undoMove();
+
+ private:
+  /** \brief The current board state */
+  BasicBoard<W, H, N> board_;
+
+  /** \brief The recorded moves, oldest first */
+  uint8_t moves_[W * H];
+
+  /** \brief The number of recorded moves */
+  size_t numMoves_;
+};
+
+#ifndef CONNECT_N
+/** \brief The tokens in a row which win the game for every agent */
+#define CONNECT_N 4
+#endif
+
+/** \brief The standard 7 column, 6 row board played by the game */
+typedef BasicBoard<7, 6, CONNECT_N> Board;
+
+/** \brief A MoveHistory of the standard board */
+typedef BasicMoveHistory<7, 6, CONNECT_N> MoveHistory;
+
 /**
  * \brief Overloads the print operator to use the Board print function
  * \param os    The output stream to which the board is printed
  * \param board The board to print to the output stream
  * \returns The output stream which was passed in
  */
-std::ostream &operator<<(std::ostream &os, const Board &board);
+template <size_t W, size_t H, size_t N>
+std::ostream &operator<<(std::ostream &os, const BasicBoard<W, H, N> &board);
 
 /**
  * \struct BoardHasher
- * \brief Implements a hash function for the Board class
+ * \brief Implements a hash function for the BasicBoard class template
+ * \note Returns the Zobrist hash of the board (see BasicBoard::getHash)
  */
 struct BoardHasher {
-  size_t operator()(const Board &b) const;
+  template <size_t W, size_t H, size_t N>
+  size_t operator()(const BasicBoard<W, H, N> &b) const;
 };
 
+////////////////////////////////////////////////////////////////////////////////
+// BasicBoard
+////////////////////////////////////////////////////////////////////////////////
+
+template <size_t W, size_t H, size_t N>
+BasicBoard<W, H, N>::BasicBoard() : masks_{0, 0}, turn_{0}, hash_{0} {}
+
+template <size_t W, size_t H, size_t N>
+BasicBoard<W, H, N>::BasicBoard(Mask xMask, Mask oMask)
+    : masks_{xMask, oMask}, hash_{0} {
+  // Count x and o pieces to determine turn
+  turn_ = popcount(xMask) > popcount(oMask);
+
+  for (size_t player = 0; player < 2; ++player) {
+    for (Mask mask = masks_[player]; mask; mask &= mask - 1) {
+      hash_ ^= ZOBRIST[player][lowestBit(mask)];
+    }
+  }
+}
+
+template <size_t W, size_t H, size_t N>
+bool BasicBoard<W, H, N>::operator==(const BasicBoard &rhs) const {
+  return masks_[0] == rhs.masks_[0] && masks_[1] == rhs.masks_[1];
+}
+
+template <size_t W, size_t H, size_t N>
+size_t BasicBoard<W, H, N>::getTurn() const {
+  return turn_;
+}
+
+template <size_t W, size_t H, size_t N>
+size_t BasicBoard<W, H, N>::getNumMoves() const {
+  return popcount(masks_[0] | masks_[1]);
+}
+
+template <size_t W, size_t H, size_t N>
+typename BasicBoard<W, H, N>::Mask BasicBoard<W, H, N>::getKey() const {
+  // Adding BOTTOM_MASK to the occupied positions leaves only a marker above
+  // the top piece of each column, which cannot overlap the X pieces
+  return masks_[0] + (masks_[0] | masks_[1]) + BOTTOM_MASK;
+}
+
+template <size_t W, size_t H, size_t N>
+typename BasicBoard<W, H, N>::Mask BasicBoard<W, H, N>::getMirroredKey() const {
+  return mirror(getKey());
+}
+
+template <size_t W, size_t H, size_t N>
+typename BasicBoard<W, H, N>::Mask BasicBoard<W, H, N>::getCanonicalKey()
+    const {
+  Mask key = getKey();
+  return std::min(key, mirror(key));
+}
+
+template <size_t W, size_t H, size_t N>
+uint64_t BasicBoard<W, H, N>::getHash() const {
+  return hash_;
+}
+
+template <size_t W, size_t H, size_t N>
+typename BasicBoard<W, H, N>::Mask BasicBoard<W, H, N>::getMask(
+    size_t player) const {
+  return masks_[player];
+}
+
+template <size_t W, size_t H, size_t N>
+bool BasicBoard<W, H, N>::isWon() const {
+  // Check if player who most recently played won
+  return isWon(masks_[!turn_]);
+}
+
+template <size_t W, size_t H, size_t N>
+bool BasicBoard<W, H, N>::isDraw() const {
+  return (masks_[0] | masks_[1]) == BOARD_MASK;
+}
+
+template <size_t W, size_t H, size_t N>
+bool BasicBoard<W, H, N>::isValidMove(size_t move) const {
+  if (move >= W) {
+    return false;
+  }
+  return !(((masks_[0] | masks_[1]) >> (move * COLUMN_BITS + H - 1)) & 1);
+}
+
+template <size_t W, size_t H, size_t N>
+float BasicBoard<W, H, N>::getReward() const {
+  return isWon() * (turn_ * 2.0 - 1.0);
+}
+
+template <size_t W, size_t H, size_t N>
+std::vector<size_t> BasicBoard<W, H, N>::getSuccessors() const {
+  std::vector<size_t> sucs;
+  Mask invBoard = ~(masks_[0] | masks_[1]);
+
+  // We can play in any column in which the top bit is open
+  for (size_t move : MOVE_ORDER) {
+    if ((invBoard >> (move * COLUMN_BITS + H - 1)) & 1) {
+      sucs.push_back(move);
+    }
+  }
+
+  return sucs;
+}
+
+template <size_t W, size_t H, size_t N>
+size_t BasicBoard<W, H, N>::getSuccessorsFast() const {
+  // Shift the top bit of the column of each move to its bit in the result
+  // (the loop is unrolled into one shift and mask per column)
+  Mask invBoard = ~(masks_[0] | masks_[1]);
+  size_t sucs = 0;
+  for (size_t i = 0; i < W; ++i) {
+    size_t top = MOVE_ORDER[i] * COLUMN_BITS + H - 1;
+    sucs |= static_cast<size_t>(top > i ? (invBoard >> (top - i))
+                                        : (invBoard << (i - top))) &
+            (static_cast<size_t>(1) << i);
+  }
+  return sucs;
+}
+
+template <size_t W, size_t H, size_t N>
+typename BasicBoard<W, H, N>::Mask BasicBoard<W, H, N>::getLegalMask() const {
+  // Adding a bottom bit carries into the lowest open position of each column
+  return ((masks_[0] | masks_[1]) + BOTTOM_MASK) & BOARD_MASK;
+}
+
+template <size_t W, size_t H, size_t N>
+std::array<size_t, 2> BasicBoard<W, H, N>::getThreatCount() const {
+  return {{popcount(getThreatMask(0)), popcount(getThreatMask(1))}};
+}
+
+template <size_t W, size_t H, size_t N>
+typename BasicBoard<W, H, N>::Mask BasicBoard<W, H, N>::getThreatMask(
+    size_t player) const {
+  Mask open = BOARD_MASK ^ (masks_[0] | masks_[1]);
+  return getWinningPositions(masks_[player]) & open;
+}
+
+template <size_t W, size_t H, size_t N>
+typename BasicBoard<W, H, N>::Mask BasicBoard<W, H, N>::winningMoves() const {
+  return getWinningPositions(masks_[turn_]) & getLegalMask();
+}
+
+template <size_t W, size_t H, size_t N>
+typename BasicBoard<W, H, N>::Mask BasicBoard<W, H, N>::opponentWinningMoves()
+    const {
+  return getWinningPositions(masks_[!turn_]) & getLegalMask();
+}
+
+// Source: Connect 4 Game Solver by Pascal Pons
+// https://github.com/PascalPons/connect4
+template <size_t W, size_t H, size_t N>
+typename BasicBoard<W, H, N>::Mask
+BasicBoard<W, H, N>::possibleNonLosingMoves() const {
+  Mask legal = getLegalMask();
+  Mask threats = getThreatMask(!turn_);
+
+  // An immediate threat must be blocked, and two cannot both be blocked
+  Mask forced = legal & threats;
+  if (forced) {
+    if (forced & (forced - 1)) {
+      return 0;
+    }
+    legal = forced;
+  }
+
+  // Never play directly below a threat of the opponent
+  return legal & ~(threats >> 1);
+}
+
+template <size_t W, size_t H, size_t N>
+std::ostream &BasicBoard<W, H, N>::print(std::ostream &os) const {
+  const char chars[3] = {'.', 'X', 'O'};
+
+  // Iterate through the board row by row left to right top to bottom
+  for (size_t row = H; row-- > 0;) {
+    for (size_t col = 0; col < W; ++col) {
+      size_t bit = col * COLUMN_BITS + row;
+      os << chars[((masks_[0] >> bit) & 1) + 2 * ((masks_[1] >> bit) & 1)]
+         << " ";
+    }
+    os << std::endl;
+  }
+
+  // Print column indices along the bottom
+  for (size_t col = 0; col < W; ++col) {
+    os << col << (col + 1 < W ? " " : "");
+  }
+  os << std::endl;
+
+  return os;
+}
+
+template <size_t W, size_t H, size_t N>
+vector<char> BasicBoard<W, H, N>::getBoardVector() {
+  const char chars[3] = {'.', 'X', 'O'};
+
+  vector<char> outputBoard = vector<char>();
+  // Iterate through the board row by row left to right top to bottom
+  for (size_t row = H; row-- > 0;) {
+    for (size_t col = 0; col < W; ++col) {
+      size_t bit = col * COLUMN_BITS + row;
+      outputBoard.push_back(
+          chars[((masks_[0] >> bit) & 1) + 2 * ((masks_[1] >> bit) & 1)]);
+    }
+  }
+
+  return outputBoard;
+}
+
+template <size_t W, size_t H, size_t N>
+void BasicBoard<W, H, N>::handleMove(size_t move) {
+  // Adding the bottom bit of the column carries into its lowest open position
+  Mask board = masks_[0] | masks_[1];
+  Mask piece = (board + (static_cast<Mask>(1) << (move * COLUMN_BITS))) &
+               (COLUMN_MASK << (move * COLUMN_BITS));
+  masks_[turn_] |= piece;
+  hash_ ^= ZOBRIST[turn_][lowestBit(piece)];
+  turn_ = !turn_;
+}
+
+template <size_t W, size_t H, size_t N>
+void BasicBoard<W, H, N>::undoMove(size_t move) {
+  // The lowest open position of the column sits directly above its top piece
+  Mask board = masks_[0] | masks_[1];
+  Mask top = ((board + (static_cast<Mask>(1) << (move * COLUMN_BITS))) &
+              (((COLUMN_MASK << 1) | 1) << (move * COLUMN_BITS))) >>
+             1;
+  turn_ = !turn_;
+  masks_[turn_] &= ~top;
+  hash_ ^= ZOBRIST[turn_][lowestBit(top)];
+}
+
+// Source: Fhourstones Benchmark by John Tromp
+// https://github.com/qu1j0t3/fhourstones
+template <size_t W, size_t H, size_t N>
+size_t BasicBoard<W, H, N>::isWon(Mask mask) {
+  // check \ diagonal, horizontal, / diagonal, and vertical
+  for (size_t shift : {COLUMN_BITS - 1, COLUMN_BITS, COLUMN_BITS + 1,
+                       static_cast<size_t>(1)}) {
+    if (getLines<N>(mask, shift)) {
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+// Source: Connect 4 Game Solver by Pascal Pons
+// https://github.com/PascalPons/connect4
+template <size_t W, size_t H, size_t N>
+typename BasicBoard<W, H, N>::Mask BasicBoard<W, H, N>::getWinningPositions(
+    Mask mask) {
+  // vertical (only the position above N - 1 stacked tokens can complete it)
+  Mask r = getLines<N - 1>(mask, 1) << (N - 1);
+
+  // For each other direction, a position completes N if it has j tokens on
+  // one side and N - 1 - j tokens on the other.  before[j] and after[j] are
+  // the positions with at least j tokens directly before and after them.
+  for (size_t shift : {COLUMN_BITS - 1, COLUMN_BITS, COLUMN_BITS + 1}) {
+    Mask before[N];
+    Mask after[N];
+    before[0] = after[0] = ~static_cast<Mask>(0);
+    for (size_t j = 1; j < N; ++j) {
+      before[j] = before[j - 1] & (mask << j * shift);
+      after[j] = after[j - 1] & (mask >> j * shift);
+    }
+    for (size_t j = 0; j < N; ++j) {
+      r |= before[j] & after[N - 1 - j];
+    }
+  }
+
+  return r;
+}
+
+template <size_t W, size_t H, size_t N>
+template <size_t LENGTH>
+typename BasicBoard<W, H, N>::Mask BasicBoard<W, H, N>::getLines(
+    Mask mask, size_t shift) {
+  // A position starts a line of 2k tokens if it starts a line of k tokens
+  // and so does the position k steps along, and two overlapping lines of k
+  // tokens cover any length up to 2k
+  size_t length = 1;
+  for (; 2 * length <= LENGTH; length *= 2) {
+    mask &= mask >> (length * shift);
+  }
+  if (length < LENGTH) {
+    mask &= mask >> ((LENGTH - length) * shift);
+  }
+  return mask;
+}
+
+template <size_t W, size_t H, size_t N>
+typename BasicBoard<W, H, N>::Mask BasicBoard<W, H, N>::mirror(Mask mask) {
+  // Swap columns c and W - 1 - c, leaving the center column of an odd width
+  // in place (the loop is unrolled into constant masks and shifts)
+  const Mask COLUMN = (static_cast<Mask>(1) << COLUMN_BITS) - 1;
+  Mask result = W % 2 ? mask & (COLUMN << (W / 2 * COLUMN_BITS)) : 0;
+  for (size_t col = 0; col < W / 2; ++col) {
+    size_t shift = (W - 1 - 2 * col) * COLUMN_BITS;
+    Mask column = COLUMN << (col * COLUMN_BITS);
+    result |= ((mask & column) << shift) | ((mask >> shift) & column);
+  }
+  return result;
+}
+
+template <size_t W, size_t H, size_t N>
+size_t BasicBoard<W, H, N>::popcount(Mask mask) {
+  if constexpr (sizeof(Mask) > sizeof(uint64_t)) {
+    return __builtin_popcountll(static_cast<uint64_t>(mask)) +
+           __builtin_popcountll(static_cast<uint64_t>(mask >> 64));
+  } else {
+    return __builtin_popcountll(mask);
+  }
+}
+
+template <size_t W, size_t H, size_t N>
+size_t BasicBoard<W, H, N>::lowestBit(Mask mask) {
+  if constexpr (sizeof(Mask) > sizeof(uint64_t)) {
+    uint64_t low = static_cast<uint64_t>(mask);
+    return low ? __builtin_ctzll(low)
+               : 64 + __builtin_ctzll(static_cast<uint64_t>(mask >> 64));
+  } else {
+    return __builtin_ctzll(mask);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// BasicMoveHistory
+////////////////////////////////////////////////////////////////////////////////
+
+template <size_t W, size_t H, size_t N>
+BasicMoveHistory<W, H, N>::BasicMoveHistory() : numMoves_{0} {}
+
+template <size_t W, size_t H, size_t N>
+BasicMoveHistory<W, H, N>::BasicMoveHistory(const BasicBoard<W, H, N> &board)
+    : board_{board}, numMoves_{0} {}
+
+template <size_t W, size_t H, size_t N>
+const BasicBoard<W, H, N> &BasicMoveHistory<W, H, N>::getBoard() const {
+  return board_;
+}
+
+template <size_t W, size_t H, size_t N>
+size_t BasicMoveHistory<W, H, N>::size() const {
+  return numMoves_;
+}
+
+template <size_t W, size_t H, size_t N>
+size_t BasicMoveHistory<W, H, N>::lastMove() const {
+  return moves_[numMoves_ - 1];
+}
+
+template <size_t W, size_t H, size_t N>
+void BasicMoveHistory<W, H, N>::handleMove(size_t move) {
+  board_.handleMove(move);
+  moves_[numMoves_++] = move;
+}
+
+template <size_t W, size_t H, size_t N>
+void BasicMoveHistory<W, H, N>::undoMove() {
+  board_.undoMove(moves_[--numMoves_]);
+}
+
+template <size_t W, size_t H, size_t N>
+std::ostream &operator<<(std::ostream &os, const BasicBoard<W, H, N> &board) {
+  return board.print(os);
+}
+
+template <size_t W, size_t H, size_t N>
+size_t BoardHasher::operator()(const BasicBoard<W, H, N> &b) const {
+  return b.getHash();
+}
+
 #endif  // BOARD_HPP_
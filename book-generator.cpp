@@ -0,0 +1,225 @@
+/**
+ * \file book-generator.cpp
+ * \copyright Matthew Calligaro
+ * \date December 2019
+ * \brief Implements the BookGenerator class
+ */
+
+#include "book-generator.hpp"
+#include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "agents/agent-solver.hpp"
+#include "opening-book.hpp"
+
+BookGenerator::BookGenerator(const std::string &path, size_t maxPly,
+                             const Board &root, size_t numThreads)
+    : path_{path},
+      maxPly_{maxPly},
+      root_{root},
+      numThreads_{numThreads ? numThreads
+                             : std::max<size_t>(
+                                   std::thread::hardware_concurrency(), 1)},
+      numPositions_{0},
+      next_{0},
+      numRunning_{0} {}
+
+bool BookGenerator::generate(
+    const std::chrono::system_clock::time_point &endTime, bool verbose) {
+  std::vector<std::vector<uint64_t>> plies = enumerate();
+  numPositions_ = 0;
+  for (const std::vector<uint64_t> &keys : plies) {
+    numPositions_ += keys.size();
+  }
+
+  // Read the entries of earlier runs, dropping a partly written last entry
+  std::string checkpoint = path_ + ".partial";
+  std::vector<uint64_t> done;
+  {
+    std::ifstream file(checkpoint, std::ios::binary | std::ios::ate);
+    if (file) {
+      done.resize(static_cast<size_t>(file.tellg()) / sizeof(uint64_t));
+      file.seekg(0);
+      file.read(reinterpret_cast<char *>(done.data()),
+                done.size() * sizeof(uint64_t));
+      file.close();
+      if (truncate(checkpoint.c_str(), done.size() * sizeof(uint64_t))) {
+        return false;
+      }
+    }
+  }
+  std::sort(done.begin(), done.end());
+
+  // An entry sorts before every entry with a larger key, whatever its score
+  unsolved_.clear();
+  for (const std::vector<uint64_t> &keys : plies) {
+    for (uint64_t key : keys) {
+      std::vector<uint64_t>::const_iterator it =
+          std::lower_bound(done.begin(), done.end(), key << 8);
+      if (it == done.end() || (*it >> 8) != key) {
+        unsolved_.push_back(key);
+      }
+    }
+  }
+  std::vector<uint64_t>().swap(done);
+  std::vector<uint64_t> keys;
+  for (const std::vector<uint64_t> &ply : plies) {
+    keys.insert(keys.end(), ply.begin(), ply.end());
+  }
+  std::vector<std::vector<uint64_t>>().swap(plies);
+  std::sort(keys.begin(), keys.end());
+  if (verbose) {
+    std::cout << numPositions_ << " positions, "
+              << numPositions_ - unsolved_.size() << " already solved"
+              << std::endl;
+  }
+
+  // Solve on every thread while this thread streams the results to the
+  // checkpoint file
+  std::ofstream file(checkpoint, std::ios::binary | std::ios::app);
+  next_ = 0;
+  numRunning_ = numThreads_;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < numThreads_; ++i) {
+    threads.emplace_back(&BookGenerator::work, this, std::cref(endTime));
+  }
+
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  size_t numSolved = 0;
+  bool running = true;
+  while (running) {
+    std::vector<uint64_t> solved;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      finished_.wait_for(lock, std::chrono::seconds(CHECKPOINT_SECONDS),
+                         [this]() { return !numRunning_; });
+      running = numRunning_;
+      solved.swap(solved_);
+    }
+
+    file.write(reinterpret_cast<const char *>(solved.data()),
+               solved.size() * sizeof(uint64_t));
+    file.flush();
+    numSolved += solved.size();
+    if (verbose) {
+      double seconds = std::chrono::duration_cast<std::chrono::milliseconds>(
+                           std::chrono::steady_clock::now() - start)
+                           .count() /
+                       1000.0;
+      std::cout << numSolved << " of " << unsolved_.size()
+                << " positions solved (" << numSolved / seconds
+                << " positions/s)" << std::endl;
+    }
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  file.close();
+  if (!file || numSolved < unsolved_.size()) {
+    return false;
+  }
+
+  // Keep the entries of this book from the checkpoint, which may also hold
+  // positions from runs with a different root or ply
+  std::vector<uint64_t> entries;
+  {
+    std::ifstream file(checkpoint, std::ios::binary | std::ios::ate);
+    entries.resize(static_cast<size_t>(file.tellg()) / sizeof(uint64_t));
+    file.seekg(0);
+    file.read(reinterpret_cast<char *>(entries.data()),
+              entries.size() * sizeof(uint64_t));
+  }
+  std::sort(entries.begin(), entries.end());
+  entries.erase(std::unique(entries.begin(), entries.end(),
+                            [](uint64_t a, uint64_t b) {
+                              return (a >> 8) == (b >> 8);
+                            }),
+                entries.end());
+  entries.erase(std::remove_if(entries.begin(), entries.end(),
+                               [&keys](uint64_t entry) {
+                                 return !std::binary_search(
+                                     keys.begin(), keys.end(), entry >> 8);
+                               }),
+                entries.end());
+
+  if (!OpeningBook::write(path_, entries, maxPly_)) {
+    return false;
+  }
+  std::remove(checkpoint.c_str());
+  return true;
+}
+
+size_t BookGenerator::getNumPositions() const { return numPositions_; }
+
+Board BookGenerator::decodeKey(uint64_t key) {
+  // The key of each column is the X pieces of the column below a marker just
+  // above the top piece, so the bits below the marker are the pieces
+  uint64_t xMask = 0;
+  uint64_t mask = 0;
+  for (size_t col = 0; col < Board::WIDTH; ++col) {
+    size_t shift = col * Board::COLUMN_BITS;
+    uint64_t bits = (key >> shift) & ((1UL << Board::COLUMN_BITS) - 1);
+    uint64_t below = ((1UL << (63 - __builtin_clzll(bits))) - 1) << shift;
+    mask |= below;
+    xMask |= (bits << shift) & below;
+  }
+  return Board(xMask, mask ^ xMask);
+}
+
+std::vector<std::vector<uint64_t>> BookGenerator::enumerate() const {
+  // Expand one ply at a time.  The children of one of a pair of mirror images
+  // are the mirror images of the children of the other, so only the
+  // canonical board of each pair needs to be expanded.
+  std::vector<std::vector<uint64_t>> plies;
+  if (root_.isWon() || root_.isDraw() || root_.getNumMoves() > maxPly_) {
+    return plies;
+  }
+  plies.push_back({root_.getCanonicalKey()});
+  for (size_t ply = root_.getNumMoves(); ply < maxPly_; ++ply) {
+    std::vector<uint64_t> next;
+    for (uint64_t key : plies.back()) {
+      Board board = decodeKey(key);
+      for (size_t move : board.getSuccessors()) {
+        Board child = board;
+        child.handleMove(move);
+        if (!child.isWon() && !child.isDraw()) {
+          next.push_back(child.getCanonicalKey());
+        }
+      }
+    }
+    std::sort(next.begin(), next.end());
+    next.erase(std::unique(next.begin(), next.end()), next.end());
+    plies.push_back(std::move(next));
+  }
+
+  std::reverse(plies.begin(), plies.end());
+  return plies;
+}
+
+void BookGenerator::work(
+    const std::chrono::system_clock::time_point &endTime) {
+  AgentSolver solver;
+  while (std::chrono::system_clock::now() < endTime) {
+    size_t i = next_++;
+    if (i >= unsolved_.size()) {
+      break;
+    }
+
+    uint64_t entry = OpeningBook::makeEntry(
+        unsolved_[i], solver.solve(decodeKey(unsolved_[i])));
+    std::lock_guard<std::mutex> lock(mutex_);
+    solved_.push_back(entry);
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!--numRunning_) {
+    finished_.notify_all();
+  }
+}
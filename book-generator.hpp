@@ -0,0 +1,123 @@
+/**
+ * \file book-generator.hpp
+ * \copyright Matthew Calligaro
+ * \date December 2019
+ * \brief Declares the BookGenerator class
+ */
+
+#ifndef BOOK_GENERATOR_HPP_
+#define BOOK_GENERATOR_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "board.hpp"
+
+/**
+ * \class BookGenerator
+ * \brief Builds an opening book by solving every position up to a ply
+ * \note The positions are enumerated one ply at a time, keeping only one of
+ * each pair of mirror images, and then solved by a pool of threads with one
+ * AgentSolver each, deepest (cheapest) positions first.
+ * \note Solved positions are streamed to a checkpoint file (the book path
+ * with ".partial" appended) as raw book entries.  If the generator is stopped
+ * or killed, running it again skips every position in the checkpoint.  Once
+ * every position is solved, the book is written and the checkpoint removed.
+ */
+class BookGenerator {
+ public:
+  /** \brief The number of seconds between writes to the checkpoint file */
+  static const size_t CHECKPOINT_SECONDS = 5;
+
+  BookGenerator() = delete;
+  BookGenerator(const BookGenerator &other) = delete;
+
+  /**
+   * \brief Creates a generator for a book
+   * \param path        The path of the book file to create
+   * \param maxPly      The most pieces on the board of a position in the book
+   * \param root        The board from which the positions are enumerated
+   * \param numThreads  The number of solving threads (0 for one per core)
+   */
+  BookGenerator(const std::string &path, size_t maxPly,
+                const Board &root = Board(), size_t numThreads = 0);
+
+  ~BookGenerator() = default;
+  BookGenerator &operator=(const BookGenerator &other) = delete;
+
+  /**
+   * \brief Solves the positions and writes the book
+   * \param endTime   The time after which no new position is started
+   * \param verbose   Print the progress of the generation
+   * \returns True if the book was written, or false if endTime passed first
+   * or a file could not be written (the checkpoint keeps the progress)
+   */
+  bool generate(const std::chrono::system_clock::time_point &endTime =
+                    std::chrono::system_clock::time_point::max(),
+                bool verbose = false);
+
+  /**
+   * \brief Returns the number of positions in the book
+   * \returns The number of positions enumerated by the last call to generate
+   */
+  size_t getNumPositions() const;
+
+  /**
+   * \brief Recreates a board from its key
+   * \param key     The key of the board (see Board::getKey)
+   * \returns The board
+   */
+  static Board decodeKey(uint64_t key);
+
+ private:
+  /** \brief The path of the book file to create */
+  std::string path_;
+
+  /** \brief The most pieces on the board of a position in the book */
+  size_t maxPly_;
+
+  /** \brief The board from which the positions are enumerated */
+  Board root_;
+
+  /** \brief The number of solving threads */
+  size_t numThreads_;
+
+  /** \brief The number of positions in the book */
+  size_t numPositions_;
+
+  /** \brief The canonical keys of the positions which are not yet solved */
+  std::vector<uint64_t> unsolved_;
+
+  /** \brief The index in unsolved_ of the next position to solve */
+  std::atomic<size_t> next_;
+
+  /** \brief The number of solving threads which have not finished */
+  size_t numRunning_;
+
+  /** \brief Entries solved since the last checkpoint */
+  std::vector<uint64_t> solved_;
+
+  /** \brief Protects numRunning_ and solved_ */
+  std::mutex mutex_;
+
+  /** \brief Wakes the checkpointing thread when a solving thread finishes */
+  std::condition_variable finished_;
+
+  /**
+   * \brief Finds the canonical key of every position in the book
+   * \returns The keys of each ply, sorted, deepest ply first
+   */
+  std::vector<std::vector<uint64_t>> enumerate() const;
+
+  /**
+   * \brief Solves positions from unsolved_ until none are left
+   * \param endTime   The time after which no new position is started
+   */
+  void work(const std::chrono::system_clock::time_point &endTime);
+};
+
+#endif  // BOOK_GENERATOR_HPP_
@@ -7,6 +7,8 @@
 
 #include <getopt.h>
 #include <iostream>
+#include <string>
+#include "book-generator.hpp"
 #include "test.hpp"
 
 /**
@@ -18,14 +20,22 @@ void printUsage() {
             << std::endl
             << std::endl
             << "Usage: ./c4 [-t <test type>] [-n <number of trials>] [-d "
-               "<depth>] [-v] [-h]"
+               "<depth>] [-f <book file>] [-v] [-h]"
             << std::endl
             << std::endl
             << "Options:" << std::endl
-            << "-t: test type (single, time, win, winTrain, depth)" << std::endl
+            << "-t: test type (single, time, win, winTrain, depth, bench, "
+               "deadline, threads, rollout, mcts, mctsRoot, mctsReuse, "
+               "mctsSolver, mctsGraph, mctsRave, batch, solver, book, "
+               "bookGen, bookGenTrials, symmetry, hash, geometry, connect, "
+               "forced, pvs)"
+            << std::endl
             << "-n: number of trials (positive integer number)" << std::endl
             << "-d: depth for minimax agents (positive integer number)"
             << std::endl
+            << "-f: opening book file written by bookGen, which solves every "
+               "board with at most depth pieces (default book.bin)"
+            << std::endl
             << "-v: verbose" << std::endl
             << "-h: show this help message" << std::endl;
 }
@@ -37,11 +47,12 @@ int main(int argc, char **argv) {
   std::string testType = "single";
   size_t numTrials = 1;
   size_t depth = 4;
+  std::string bookPath = "book.bin";
   bool verbose = false;
   int c;
 
   // Parse command line arguments
-  while ((c = getopt(argc, argv, "t:n:d:vh")) != -1) {
+  while ((c = getopt(argc, argv, "t:n:d:f:vh")) != -1) {
     switch (c) {
       case 't':
         testType = optarg;
@@ -52,6 +63,9 @@ int main(int argc, char **argv) {
       case 'd':
         depth = atoi(optarg);
         break;
+      case 'f':
+        bookPath = optarg;
+        break;
       case 'v':
         verbose = true;
         break;
@@ -80,6 +94,53 @@ int main(int argc, char **argv) {
     Test::winTrialsWithTrain(numTrials, depth, verbose);
   } else if (testType == "depth") {
     Test::pairwiseDepthTrials(1, 12);
+  } else if (testType == "bench") {
+    Test::boardBenchmark(numTrials, depth);
+  } else if (testType == "deadline") {
+    Test::deadlineTrials(numTrials, verbose);
+  } else if (testType == "threads") {
+    Test::threadScalingTrials(numTrials, depth);
+  } else if (testType == "rollout") {
+    Test::rolloutTrials(numTrials, verbose);
+  } else if (testType == "mcts") {
+    Test::mctsThreadTrials(numTrials, verbose);
+  } else if (testType == "mctsRoot") {
+    Test::mctsRootTrials(numTrials, verbose);
+  } else if (testType == "mctsReuse") {
+    Test::mctsReuseTrials(numTrials, verbose);
+  } else if (testType == "mctsSolver") {
+    Test::mctsSolverTrials(numTrials, verbose);
+  } else if (testType == "mctsGraph") {
+    Test::mctsGraphTrials(numTrials, verbose);
+  } else if (testType == "mctsRave") {
+    Test::mctsRaveTrials(numTrials, verbose);
+  } else if (testType == "batch") {
+    Test::batchRolloutTrials(numTrials, verbose);
+  } else if (testType == "solver") {
+    Test::solverTrials(numTrials, verbose);
+  } else if (testType == "book") {
+    Test::bookTrials(numTrials, depth, verbose);
+  } else if (testType == "hash") {
+    Test::hashTrials(numTrials, depth);
+  } else if (testType == "pvs") {
+    Test::pvsTrials(numTrials, depth, verbose);
+  } else if (testType == "forced") {
+    Test::forcedMoveTrials(numTrials, depth, verbose);
+  } else if (testType == "connect") {
+    Test::connectTrials(numTrials);
+  } else if (testType == "geometry") {
+    Test::geometryTrials(numTrials);
+  } else if (testType == "symmetry") {
+    Test::symmetryTrials(numTrials, depth, verbose);
+  } else if (testType == "bookGenTrials") {
+    Test::bookGeneratorTrials(numTrials, verbose);
+  } else if (testType == "bookGen") {
+    BookGenerator generator(bookPath, depth);
+    if (!generator.generate(std::chrono::system_clock::time_point::max(),
+                            verbose)) {
+      std::cerr << "could not write " << bookPath << std::endl;
+      return 2;
+    }
   } else {
     std::cerr << "test type was not recognized, enter 'h' for help"
               << std::endl;
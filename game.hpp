@@ -1,24 +1,32 @@
 /**
- * \file board.hpp
+ * \file game.hpp
  * \copyright Matthew Calligaro
  * \date December 2019
- * \brief Declares the Game class
+ * \brief Declares and implements the BasicGame class template
  */
 
 #ifndef GAME_HPP_
 #define GAME_HPP_
 
+#include <array>
+#include <chrono>
 #include <future>
-#include <list>
+#include <iostream>
 #include <memory>
 #include <ostream>
 #include "agents/agent.hpp"
 #include "board.hpp"
 
-class Game {
+/**
+ * \class BasicGame
+ * \brief A game between two agents
+ * \tparam B   The board type on which the game is played (see BasicBoard)
+ */
+template <typename B>
+class BasicGame {
  public:
-  Game() = delete;
-  Game(const Game &other) = default;
+  BasicGame() = delete;
+  BasicGame(const BasicGame &other) = default;
 
   /**
    * \brief Creates a new game with the specified agents and time limit
@@ -26,11 +34,11 @@ class Game {
    * \param oAgent    The agent playing as O (second move)
    * \param turnTime  The maximum time in miliseconds an agent can take per turn
    */
-  Game(std::shared_ptr<Agent> xAgent, std::shared_ptr<Agent> oAgent,
-       size_t turnTime = 2000);
+  BasicGame(std::shared_ptr<BasicAgent<B>> xAgent,
+            std::shared_ptr<BasicAgent<B>> oAgent, size_t turnTime = 2000);
 
-  ~Game() = default;
-  Game &operator=(const Game &other) = default;
+  ~BasicGame() = default;
+  BasicGame &operator=(const BasicGame &other) = default;
 
   /**
    * \brief Allows the agents to play the game to completion
@@ -46,8 +54,9 @@ class Game {
    * \param verbose     If true, print information as the game progresses
    * \returns The winner (0 if X won, 1 if O won, or 2 if a draw)
    */
-  size_t execute(std::array<double, 42> &xMoveTimes,
-                 std::array<double, 42> &oMoveTimes, bool verbose = false);
+  size_t execute(std::array<double, B::SIZE> &xMoveTimes,
+                 std::array<double, B::SIZE> &oMoveTimes,
+                 bool verbose = false);
 
   /**
    * \brief Prints the current board state of the game
@@ -61,10 +70,10 @@ class Game {
   static const size_t NO_MOVE = 15942;
 
   /** \brief The current board state */
-  Board board_;
+  B board_;
 
   /** \brief The X and O agents */
-  std::shared_ptr<Agent> agents_[2];
+  std::shared_ptr<BasicAgent<B>> agents_[2];
 
   /** \brief The maximum time in miliseconds an agent can take per turn */
   size_t turnTime_;
@@ -78,6 +87,142 @@ class Game {
    * \returns the column move (column index) taken by the agent
    */
   size_t getMove(size_t agent);
+
+  /**
+   * \brief Runs the getMove function of an agent on another thread
+   * \param agent     The agent taking the move
+   * \param board     A copy of the board state
+   * \param move      Where the agent stores its move
+   * \param endTime   The time by which the agent should return
+   */
+  static void threadHelper(
+      std::shared_ptr<BasicAgent<B>> agent, B board,
+      std::shared_ptr<size_t> move,
+      const std::chrono::system_clock::time_point &endTime);
 };
 
+/** \brief A game on the standard board */
+typedef BasicGame<Board> Game;
+
+////////////////////////////////////////////////////////////////////////////////
+// Implementation
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename B>
+void BasicGame<B>::threadHelper(
+    std::shared_ptr<BasicAgent<B>> agent, B board, std::shared_ptr<size_t> move,
+    const std::chrono::system_clock::time_point &endTime) {
+  agent->getMove(board, *move, endTime);
+}
+
+template <typename B>
+BasicGame<B>::BasicGame(std::shared_ptr<BasicAgent<B>> xAgent,
+                        std::shared_ptr<BasicAgent<B>> oAgent, size_t turnTime)
+    : turnTime_{turnTime}, move_{0} {
+  agents_[0] = xAgent;
+  agents_[1] = oAgent;
+}
+
+template <typename B>
+size_t BasicGame<B>::execute(bool verbose) {
+  std::array<double, B::SIZE> xMoveTimes;
+  std::array<double, B::SIZE> oMoveTimes;
+  return execute(xMoveTimes, oMoveTimes, verbose);
+}
+
+template <typename B>
+size_t BasicGame<B>::execute(std::array<double, B::SIZE> &xMoveTimes,
+                             std::array<double, B::SIZE> &oMoveTimes,
+                             bool verbose) {
+  double totalTimes[2] = {0, 0};
+
+  // Allow each agent to play on their turn until the game is won or a draw
+  while (move_ < B::SIZE && !board_.isWon()) {
+    // Allow the agent to determine its move and measure the elapsed time
+    std::chrono::high_resolution_clock::time_point start =
+        std::chrono::high_resolution_clock::now();
+    size_t move = getMove(board_.getTurn());
+    std::chrono::high_resolution_clock::time_point end =
+        std::chrono::high_resolution_clock::now();
+    double elapsed =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+            .count() /
+        1000000000.0;
+
+    // Record the elapsed time
+    totalTimes[board_.getTurn()] += elapsed;
+    if (board_.getTurn() == 1) {
+      oMoveTimes[move_ / 2] = elapsed;
+    } else {
+      xMoveTimes[move_ / 2] = elapsed;
+    }
+
+    // Handle if board move was invalid
+    if (!board_.isValidMove(move)) {
+      // Explain why the move was not valid
+      if (move == NO_MOVE) {
+        std::cerr << agents_[board_.getTurn()]->getAgentName()
+                  << " did not make a move in the time limit.  ";
+      } else {
+        std::cerr << agents_[board_.getTurn()]->getAgentName()
+                  << " made an invalid move (" << move << ").  ";
+      }
+
+      // Use the default move instead
+      move = board_.getSuccessors()[0];
+      std::cerr << "Using move " << move << " instead." << std::endl;
+    }
+
+    if (verbose) {
+      std::cout << agents_[board_.getTurn()]->getAgentName() << " ("
+                << (board_.getTurn() ? "O" : "X") << " player) played " << move
+                << " after " << elapsed << " seconds." << std::endl;
+    }
+
+    board_.handleMove(move);
+    ++move_;
+  }
+
+  if (verbose) {
+    std::cout << std::endl;
+    std::cout << agents_[0]->getAgentName()
+              << "(X player) average time: " << totalTimes[0] / (move_ / 2)
+              << std::endl;
+    std::cout << agents_[1]->getAgentName()
+              << "(O player) average time: " << totalTimes[1] / (move_ / 2)
+              << std::endl;
+  }
+
+  // Return winner, or 2 if a draw
+  if (move_ == B::SIZE) {
+    return 2;
+  }
+  return (move_ + 1) % 2;
+}
+
+template <typename B>
+std::ostream &BasicGame<B>::printBoard(std::ostream &os) const {
+  os << board_;
+  return os;
+}
+
+template <typename B>
+size_t BasicGame<B>::getMove(size_t agent) {
+  std::shared_ptr<size_t> agentMove(new size_t(NO_MOVE));
+  std::chrono::system_clock::time_point endTime =
+      std::chrono::system_clock::now() + std::chrono::milliseconds(turnTime_);
+
+  // Run the agent's getMove function (via threadHelper) until at most endTime
+  // and grab the value currently stored in move
+  std::future<void> threadFuture =
+      async(std::launch::async, threadHelper, agents_[agent], board_, agentMove,
+            endTime);
+  threadFuture.wait_until(endTime);
+  size_t output = *agentMove;
+
+  // For thread safety, wait until the agent finishes deciding its move
+  // before returning, but return the value grabbed at endTime
+  return output;
+}
+
 #endif  // GAME_HPP_
@@ -0,0 +1,105 @@
+/**
+ * \file opening-book.cpp
+ * \copyright Matthew Calligaro
+ * \date December 2019
+ * \brief Implements the OpeningBook class
+ */
+
+#include "opening-book.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// An entry packs a key into its upper 56 bits
+static_assert(Board::WIDTH * Board::COLUMN_BITS <= 56,
+              "OpeningBook needs boards whose keys fit in 56 bits");
+
+OpeningBook::OpeningBook()
+    : data_{nullptr},
+      bytes_{0},
+      entries_{nullptr},
+      numEntries_{0},
+      maxPly_{0} {}
+
+OpeningBook::OpeningBook(const std::string &path) : OpeningBook() {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return;
+  }
+  struct stat info;
+  if (fstat(fd, &info) ||
+      static_cast<size_t>(info.st_size) < sizeof(Header)) {
+    close(fd);
+    return;
+  }
+  size_t bytes = info.st_size;
+
+  // The mapping stays valid after the file is closed
+  void *data = mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    return;
+  }
+  const Header *header = static_cast<const Header *>(data);
+  if (header->magic != MAGIC ||
+      bytes != sizeof(Header) + header->numEntries * sizeof(uint64_t)) {
+    munmap(data, bytes);
+    return;
+  }
+
+  // A lookup touches a few scattered pages, so reading ahead would be wasted
+  madvise(data, bytes, MADV_RANDOM);
+  data_ = data;
+  bytes_ = bytes;
+  entries_ = reinterpret_cast<const uint64_t *>(header + 1);
+  numEntries_ = header->numEntries;
+  maxPly_ = header->maxPly;
+}
+
+OpeningBook::~OpeningBook() {
+  if (data_) {
+    munmap(data_, bytes_);
+  }
+}
+
+bool OpeningBook::isOpen() const { return data_; }
+
+size_t OpeningBook::size() const { return numEntries_; }
+
+size_t OpeningBook::getMaxPly() const { return maxPly_; }
+
+bool OpeningBook::probe(const Board &board, int &score) const {
+  if (board.getNumMoves() > maxPly_) {
+    return false;
+  }
+
+  // An entry sorts before every entry with a larger key, whatever its score
+  uint64_t key = board.getCanonicalKey();
+  const uint64_t *end = entries_ + numEntries_;
+  const uint64_t *entry = std::lower_bound(entries_, end, key << 8);
+  if (entry == end || (*entry >> 8) != key) {
+    return false;
+  }
+  score = static_cast<int8_t>(*entry & 0xFF);
+  return true;
+}
+
+uint64_t OpeningBook::makeEntry(uint64_t key, int score) {
+  return key << 8 | static_cast<uint8_t>(score);
+}
+
+bool OpeningBook::write(const std::string &path,
+                        std::vector<uint64_t> &entries, size_t maxPly) {
+  std::sort(entries.begin(), entries.end());
+  Header header = {MAGIC, maxPly, entries.size()};
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  file.write(reinterpret_cast<const char *>(entries.data()),
+             entries.size() * sizeof(uint64_t));
+  return static_cast<bool>(file);
+}
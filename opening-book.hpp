@@ -0,0 +1,134 @@
+/**
+ * \file opening-book.hpp
+ * \copyright Matthew Calligaro
+ * \date December 2019
+ * \brief Declares the OpeningBook class
+ */
+
+#ifndef OPENING_BOOK_HPP_
+#define OPENING_BOOK_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "board.hpp"
+
+/**
+ * \class OpeningBook
+ * \brief A read-only book of solved positions stored in a memory-mapped file
+ * \note A book file is a Header followed by one 64-bit entry per position,
+ * sorted by key.  An entry stores the canonical key of the position in its
+ * upper 56 bits and the exact score of the position (see AgentSolver) in its
+ * lowest 8 bits.  The file is mapped as is, so opening a book reads nothing
+ * but the header and allocates nothing, and a lookup is a binary search over
+ * the mapped entries.  Books are built by BookGenerator.
+ * \note A position and its mirror image (with the columns reversed) have the
+ * same score, so the book stores only the one with the smaller key (see
+ * Board::getCanonicalKey).
+ */
+class OpeningBook {
+ public:
+  /**
+   * \brief The first 8 bytes of every book file
+   * \note The third byte is the digit of Board::CONNECT ("1C4BOOK1" for
+   * Connect 4), so a book is only opened by a build for the same N
+   */
+  static const uint64_t MAGIC =
+      0x314B4F4F42304331UL | static_cast<uint64_t>(Board::CONNECT) << 16;
+
+  /**
+   * \struct Header
+   * \brief The header at the start of a book file
+   */
+  struct Header {
+    /** \brief Identifies the file as a book (MAGIC) */
+    uint64_t magic;
+
+    /** \brief The most pieces on the board of any position in the book */
+    uint64_t maxPly;
+
+    /** \brief The number of entries which follow the header */
+    uint64_t numEntries;
+  };
+
+  /**
+   * \brief Creates a book which contains no positions
+   */
+  OpeningBook();
+
+  /**
+   * \brief Maps a book file into memory
+   * \param path    The path of the book file
+   * \note If the file cannot be mapped or is not a valid book, the book
+   * contains no positions (see isOpen)
+   */
+  explicit OpeningBook(const std::string &path);
+
+  OpeningBook(const OpeningBook &other) = delete;
+  ~OpeningBook();
+  OpeningBook &operator=(const OpeningBook &other) = delete;
+
+  /**
+   * \brief Determines whether a book file was mapped successfully
+   * \returns True if the book was opened
+   */
+  bool isOpen() const;
+
+  /**
+   * \brief Returns the number of positions in the book
+   * \returns The number of entries
+   */
+  size_t size() const;
+
+  /**
+   * \brief Returns the most pieces on the board of any position in the book
+   * \returns The max ply of the book (0 if it contains no positions)
+   * \note Boards with more pieces than this never need to be looked up
+   */
+  size_t getMaxPly() const;
+
+  /**
+   * \brief Looks up the score of a board
+   * \param board   The board to look up
+   * \param score   The exact score of the board for the player to move
+   * (output)
+   * \returns True if the board (or its mirror image) is in the book
+   */
+  bool probe(const Board &board, int &score) const;
+
+  /**
+   * \brief Packs a position and its score into a book entry
+   * \param key     The canonical key of the position
+   * \param score   The exact score of the position
+   * \returns The entry
+   */
+  static uint64_t makeEntry(uint64_t key, int score);
+
+  /**
+   * \brief Writes a book file
+   * \param path      The path of the book file to create
+   * \param entries   The entries of the book, which are sorted in place
+   * \param maxPly    The most pieces on the board of any position in entries
+   * \returns True if the whole file was written
+   */
+  static bool write(const std::string &path, std::vector<uint64_t> &entries,
+                    size_t maxPly);
+
+ private:
+  /** \brief The mapped file, or null if no book is open */
+  void *data_;
+
+  /** \brief The size of the mapped file in bytes */
+  size_t bytes_;
+
+  /** \brief The sorted entries, which follow the header in the mapped file */
+  const uint64_t *entries_;
+
+  /** \brief The number of entries */
+  size_t numEntries_;
+
+  /** \brief The most pieces on the board of any position in the book */
+  size_t maxPly_;
+};
+
+#endif  // OPENING_BOOK_HPP_
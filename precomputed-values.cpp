@@ -1,5007 +0,0 @@
-/**
- * \file precomputed-values.cpp
- * \copyright Matthew Calligaro
- * \date December 2019
- * \brief Implements a HashTable of precomputed 8-ply minimax values
- */
-
-#include "precomputed-values.hpp"
-#include <unordered_map>
-
-std::unordered_map<Board, float, BoardHasher> precomp(
-    {{{44056576UL, 88113152UL}, 0.96},
-     {{44056576UL, 356515840UL}, 0.96},
-     {{44056576UL, 88080512UL}, 0.96},
-     {{44056576UL, 34447818752UL}, 0.96},
-     {{44056576UL, 88080385UL}, 0.96},
-     {{44056576UL, 4398134591488UL}, 0.96},
-     {{44040320UL, 88096768UL}, 0},
-     {{44040320UL, 356515840UL}, 0.96},
-     {{44040320UL, 88080640UL}, 0.96},
-     {{44040320UL, 34447818752UL}, 0.96},
-     {{44040320UL, 88080385UL}, 0.96},
-     {{44040320UL, 4398134591488UL}, 0.96},
-     {{44040193UL, 88096768UL}, 0.96},
-     {{44040193UL, 356515840UL}, 0.96},
-     {{44040193UL, 88080512UL}, -0.96},
-     {{44040193UL, 34447818752UL}, 0.96},
-     {{44040193UL, 88080386UL}, 0.96},
-     {{44040193UL, 4398134591488UL}, 0.96},
-     {{111149056UL, 21020672UL}, -0.96},
-     {{111149056UL, 289423360UL}, 0.96},
-     {{111149056UL, 20988032UL}, 0.96},
-     {{111149056UL, 34380726272UL}, 0.96},
-     {{111149056UL, 20987905UL}, 0.96},
-     {{111149056UL, 4398067499008UL}, 0},
-     {{44072960UL, 88096768UL}, 0.96},
-     {{44072960UL, 21053440UL}, 0.96},
-     {{44072960UL, 289423360UL}, 0.96},
-     {{44072960UL, 20988032UL}, 0.96},
-     {{44072960UL, 34380726272UL}, 0.96},
-     {{44072960UL, 20987905UL}, 0.96},
-     {{44072960UL, 4398067499008UL}, 0.96},
-     {{312475648UL, 21020672UL}, -0.96},
-     {{312475648UL, 557858816UL}, 0},
-     {{312475648UL, 20988032UL}, 0.96},
-     {{312475648UL, 34380726272UL}, -0.96},
-     {{312475648UL, 20987905UL}, 0.96},
-     {{312475648UL, 4398067499008UL}, 0.96},
-     {{44040320UL, 21020672UL}, -0.96},
-     {{44040320UL, 289423360UL}, 0.96},
-     {{44040320UL, 20988160UL}, -0.96},
-     {{44040320UL, 34380726272UL}, 0},
-     {{44040320UL, 20987905UL}, 0.96},
-     {{44040320UL, 4398067499008UL}, 0},
-     {{34403778560UL, 21020672UL}, 0.96},
-     {{34403778560UL, 20988032UL}, 0.96},
-     {{34403778560UL, 68740464640UL}, 0.96},
-     {{34403778560UL, 20987905UL}, 0.96},
-     {{34403778560UL, 4398067499008UL}, 0.96},
-     {{44040193UL, 21020672UL}, -0.96},
-     {{44040193UL, 289423360UL}, 0.96},
-     {{44040193UL, 20988032UL}, 0.96},
-     {{44040193UL, 34380726272UL}, 0},
-     {{44040193UL, 20987906UL}, 0.96},
-     {{44040193UL, 4398067499008UL}, 0.96},
-     {{4398090551296UL, 21020672UL}, 0.96},
-     {{4398090551296UL, 20988032UL}, 0.96},
-     {{4398090551296UL, 34380726272UL}, -0.96},
-     {{4398090551296UL, 20987905UL}, 0.96},
-     {{4398090551296UL, 8796114010112UL}, 0.96},
-     {{111149056UL, 20971904UL}, -0.96},
-     {{111149056UL, 34380710016UL}, -0.96},
-     {{111149056UL, 20971649UL}, 0.96},
-     {{111149056UL, 4398067482752UL}, 0},
-     {{44056576UL, 21004416UL}, 0.96},
-     {{44056576UL, 20971904UL}, -0.96},
-     {{44056576UL, 34380710016UL}, 0},
-     {{44056576UL, 20971649UL}, 0.96},
-     {{44056576UL, 4398067482752UL}, 0.96},
-     {{312475648UL, 557842560UL}, 0.96},
-     {{312475648UL, 20971904UL}, 0.96},
-     {{312475648UL, 20971649UL}, 0.96},
-     {{312475648UL, 4398067482752UL}, 0.96},
-     {{44040448UL, 88080512UL}, 0.96},
-     {{44040448UL, 20988032UL}, 0.96},
-     {{44040448UL, 289407104UL}, 0.96},
-     {{44040448UL, 20972160UL}, 0.96},
-     {{44040448UL, 34380710016UL}, 0.96},
-     {{44040448UL, 20971649UL}, 0.96},
-     {{44040448UL, 4398067482752UL}, 0.96},
-     {{34403778560UL, 20971904UL}, 0.96},
-     {{34403778560UL, 68740448384UL}, 0.96},
-     {{34403778560UL, 20971649UL}, 0.96},
-     {{34403778560UL, 4398067482752UL}, 0.96},
-     {{44040193UL, 20971904UL}, 0},
-     {{44040193UL, 34380710016UL}, 0},
-     {{44040193UL, 20971650UL}, 0},
-     {{44040193UL, 4398067482752UL}, 0},
-     {{4398090551296UL, 20971904UL}, -0.96},
-     {{4398090551296UL, 20971649UL}, 0.96},
-     {{4398090551296UL, 8796113993856UL}, 0.96},
-     {{111149056UL, 20971523UL}, 0.96},
-     {{111149056UL, 4398067482625UL}, -0.96},
-     {{44056576UL, 21004289UL}, 0.96},
-     {{44056576UL, 20971523UL}, 0.96},
-     {{44056576UL, 4398067482625UL}, 0.96},
-     {{312475648UL, 557842433UL}, 0.96},
-     {{312475648UL, 20971523UL}, 0.96},
-     {{44040320UL, 20971777UL}, -0.96},
-     {{44040320UL, 20971523UL}, 0.96},
-     {{44040320UL, 4398067482625UL}, 0.96},
-     {{34403778560UL, 68740448257UL}, 0.96},
-     {{34403778560UL, 20971523UL}, 0.96},
-     {{44040194UL, 88080385UL}, 0.96},
-     {{44040194UL, 20987905UL}, 0.96},
-     {{44040194UL, 289406977UL}, 0.96},
-     {{44040194UL, 20971649UL}, 0.96},
-     {{44040194UL, 34380709889UL}, 0},
-     {{44040194UL, 20971525UL}, 0.96},
-     {{44040194UL, 4398067482625UL}, 0},
-     {{4398090551296UL, 20971523UL}, 0.96},
-     {{4398090551296UL, 8796113993729UL}, 0.96},
-     {{77611008UL, 54558720UL}, 0.96},
-     {{77611008UL, 322961408UL}, -0.96},
-     {{77611008UL, 54526080UL}, -0.96},
-     {{77611008UL, 34414264320UL}, 0.96},
-     {{77611008UL, 54525953UL}, 0.96},
-     {{77611008UL, 4398101037056UL}, 0.96},
-     {{10534912UL, 121634816UL}, 0.96},
-     {{10534912UL, 54591488UL}, 0.96},
-     {{10534912UL, 322961408UL}, 0.96},
-     {{10534912UL, 54526080UL}, 0.96},
-     {{10534912UL, 34414264320UL}, 0.96},
-     {{10534912UL, 54525953UL}, 0.96},
-     {{10534912UL, 4398101037056UL}, 0.96},
-     {{34370240512UL, 322961408UL}, -0.96},
-     {{10502145UL, 54526080UL}, -0.96},
-     {{4398057013248UL, 121634816UL}, 0.96},
-     {{4398057013248UL, 54558720UL}, 0.96},
-     {{4398057013248UL, 322961408UL}, -0.96},
-     {{4398057013248UL, 54526080UL}, -0.96},
-     {{4398057013248UL, 34414264320UL}, 0.96},
-     {{4398057013248UL, 54525953UL}, 0.96},
-     {{4398057013248UL, 8796147548160UL}, 0.96},
-     {{44056576UL, 21069824UL}, 0.96},
-     {{10567680UL, 54558720UL}, 0.96},
-     {{10567680UL, 21135360UL}, 0.96},
-     {{10567680UL, 289439744UL}, 0.96},
-     {{10567680UL, 21004416UL}, 0.96},
-     {{10567680UL, 34380742656UL}, 0.96},
-     {{10567680UL, 21004289UL}, 0.96},
-     {{10567680UL, 4398067515392UL}, 0.96},
-     {{34370240512UL, 289439744UL}, -0.96},
-     {{10502145UL, 21004416UL}, -0.96},
-     {{4398057013248UL, 21069824UL}, 0.96},
-     {{4398057013248UL, 289439744UL}, -0.96},
-     {{4398057013248UL, 21004416UL}, -0.96},
-     {{4398057013248UL, 34380742656UL}, 0.96},
-     {{4398057013248UL, 21004289UL}, 0.96},
-     {{4398057013248UL, 8796114026496UL}, 0.96},
-     {{10534912UL, 289472512UL}, -0.96},
-     {{10534912UL, 826277888UL}, 0.96},
-     {{10534912UL, 289407104UL}, 0.96},
-     {{10534912UL, 34649145344UL}, 0.96},
-     {{10534912UL, 289406977UL}, 0.96},
-     {{10534912UL, 4398335918080UL}, 0.96},
-     {{547373056UL, 322961408UL}, 0.96},
-     {{547373056UL, 289439744UL}, 0.96},
-     {{547373056UL, 1363148800UL}, -0.96},
-     {{547373056UL, 289407104UL}, 0.96},
-     {{547373056UL, 34649145344UL}, 0.96},
-     {{547373056UL, 289406977UL}, 0.96},
-     {{547373056UL, 4398335918080UL}, 0.96},
-     {{10502272UL, 289406977UL}, -0.96},
-     {{34370240512UL, 826277888UL}, -0.96},
-     {{34370240512UL, 289407104UL}, -0.96},
-     {{34370240512UL, 69008883712UL}, -0.96},
-     {{34370240512UL, 289406977UL}, 0.96},
-     {{34370240512UL, 4398335918080UL}, -0.96},
-     {{10502145UL, 289407104UL}, -0.96},
-     {{4398057013248UL, 826277888UL}, -0.96},
-     {{4398057013248UL, 289407104UL}, -0.96},
-     {{4398057013248UL, 34649145344UL}, 0},
-     {{4398057013248UL, 289406977UL}, -0.96},
-     {{4398057013248UL, 8796382429184UL}, 0.96},
-     {{10534912UL, 21037184UL}, -0.96},
-     {{10534912UL, 20971904UL}, 0.96},
-     {{10534912UL, 34380710016UL}, 0.96},
-     {{10534912UL, 20971649UL}, 0.96},
-     {{10534912UL, 4398067482752UL}, 0.96},
-     {{278937600UL, 34380710016UL}, -0.96},
-     {{10502400UL, 54526080UL}, 0.96},
-     {{10502400UL, 21004416UL}, 0.96},
-     {{10502400UL, 289407104UL}, 0.96},
-     {{10502400UL, 20972160UL}, -0.96},
-     {{10502400UL, 34380710016UL}, 0},
-     {{10502400UL, 20971649UL}, 0.96},
-     {{10502400UL, 4398067482752UL}, 0.96},
-     {{10502145UL, 20971904UL}, -0.96},
-     {{10502145UL, 34380710016UL}, -0.96},
-     {{10502145UL, 20971650UL}, -0.96},
-     {{10502145UL, 4398067482752UL}, 0},
-     {{4398057013248UL, 20971904UL}, -0.96},
-     {{4398057013248UL, 34380710016UL}, -0.96},
-     {{4398057013248UL, 20971649UL}, -0.96},
-     {{4398057013248UL, 8796113993856UL}, 0.96},
-     {{10534912UL, 34380775424UL}, 0.96},
-     {{10534912UL, 103100186624UL}, 0.96},
-     {{10534912UL, 34380709889UL}, 0.96},
-     {{10534912UL, 4432427220992UL}, 0.96},
-     {{68729978880UL, 34414264320UL}, 0.96},
-     {{68729978880UL, 34380742656UL}, 0.96},
-     {{68729978880UL, 34649145344UL}, 0.96},
-     {{68729978880UL, 34380710016UL}, 0},
-     {{68729978880UL, 171819663360UL}, 0.96},
-     {{68729978880UL, 34380709889UL}, 0.96},
-     {{68729978880UL, 4432427220992UL}, 0.96},
-     {{4398057013248UL, 103100186624UL}, 0.96},
-     {{4398057013248UL, 34380709889UL}, 0},
-     {{4398057013248UL, 8830473732096UL}, 0.96},
-     {{10534912UL, 21037057UL}, 0.96},
-     {{10534912UL, 20971523UL}, 0.96},
-     {{10534912UL, 4398067482625UL}, 0.96},
-     {{10502146UL, 54525953UL}, 0.96},
-     {{10502146UL, 21004289UL}, 0.96},
-     {{10502146UL, 289406977UL}, 0},
-     {{10502146UL, 20971649UL}, 0.96},
-     {{10502146UL, 34380709889UL}, -0.96},
-     {{10502146UL, 20971525UL}, 0.96},
-     {{10502146UL, 4398067482625UL}, 0.96},
-     {{4398057013248UL, 20971523UL}, 0.96},
-     {{4398057013248UL, 8796113993729UL}, 0.96},
-     {{10534912UL, 4398067548160UL}, 0.96},
-     {{10534912UL, 13194160504832UL}, 0.96},
-     {{8796103524352UL, 4398101037056UL}, 0.96},
-     {{8796103524352UL, 4398067515392UL}, 0.96},
-     {{8796103524352UL, 4398335918080UL}, -0.96},
-     {{8796103524352UL, 4398067482752UL}, -0.96},
-     {{8796103524352UL, 4432427220992UL}, 0.96},
-     {{8796103524352UL, 4398067482625UL}, 0.96},
-     {{8796103524352UL, 21990253527040UL}, 0.96},
-     {{77594752UL, 54542336UL}, -0.96},
-     {{77594752UL, 322961408UL}, -0.96},
-     {{77594752UL, 54526208UL}, 0.96},
-     {{77594752UL, 34414264320UL}, 0.96},
-     {{77594752UL, 54525953UL}, -0.96},
-     {{77594752UL, 4398101037056UL}, 0.96},
-     {{10486144UL, 121634816UL}, 0.96},
-     {{10486144UL, 54542336UL}, 0.96},
-     {{10486144UL, 322961408UL}, 0.96},
-     {{10486144UL, 54526464UL}, 0.96},
-     {{10486144UL, 34414264320UL}, 0.96},
-     {{10486144UL, 54525953UL}, 0.96},
-     {{10486144UL, 4398101037056UL}, 0.96},
-     {{34370224256UL, 121634816UL}, 0.96},
-     {{34370224256UL, 54542336UL}, -0.96},
-     {{34370224256UL, 54526208UL}, 0.96},
-     {{34370224256UL, 54525953UL}, 0.96},
-     {{10485889UL, 54542336UL}, -0.96},
-     {{4398056996992UL, 121634816UL}, 0.96},
-     {{4398056996992UL, 54542336UL}, -0.96},
-     {{4398056996992UL, 322961408UL}, -0.96},
-     {{4398056996992UL, 54526208UL}, 0.96},
-     {{4398056996992UL, 34414264320UL}, 0.96},
-     {{4398056996992UL, 54525953UL}, 0.96},
-     {{4398056996992UL, 8796147548160UL}, 0.96},
-     {{10518656UL, 54542336UL}, 0.96},
-     {{10518656UL, 21053440UL}, -0.96},
-     {{10518656UL, 289423360UL}, 0.96},
-     {{10518656UL, 20988160UL}, 0.96},
-     {{10518656UL, 34380726272UL}, 0.96},
-     {{10518656UL, 20987905UL}, 0.96},
-     {{10518656UL, 4398067499008UL}, 0.96},
-     {{10486144UL, 21020672UL}, 0.96},
-     {{10486144UL, 289423360UL}, 0.96},
-     {{10486144UL, 20988416UL}, -0.96},
-     {{10486144UL, 34380726272UL}, 0.96},
-     {{10486144UL, 20987905UL}, 0.96},
-     {{10486144UL, 4398067499008UL}, 0.96},
-     {{34370224256UL, 21020672UL}, -0.96},
-     {{34370224256UL, 289423360UL}, -0.96},
-     {{34370224256UL, 20988160UL}, -0.96},
-     {{34370224256UL, 68740464640UL}, -0.96},
-     {{34370224256UL, 20987905UL}, -0.96},
-     {{34370224256UL, 4398067499008UL}, -0.96},
-     {{10485889UL, 21020672UL}, -0.96},
-     {{10485889UL, 289423360UL}, 0.96},
-     {{10485889UL, 20988160UL}, -0.96},
-     {{10485889UL, 34380726272UL}, -0.96},
-     {{10485889UL, 20987906UL}, -0.96},
-     {{10485889UL, 4398067499008UL}, -0.96},
-     {{4398056996992UL, 21020672UL}, -0.96},
-     {{4398056996992UL, 289423360UL}, 0.96},
-     {{4398056996992UL, 20988160UL}, -0.96},
-     {{4398056996992UL, 34380726272UL}, -0.96},
-     {{4398056996992UL, 20987905UL}, -0.96},
-     {{4398056996992UL, 8796114010112UL}, 0.96},
-     {{547356800UL, 322961408UL}, 0.96},
-     {{547356800UL, 289423360UL}, 0.96},
-     {{547356800UL, 1363148800UL}, 0.96},
-     {{547356800UL, 289407232UL}, 0.96},
-     {{547356800UL, 34649145344UL}, 0.96},
-     {{547356800UL, 289406977UL}, 0.96},
-     {{547356800UL, 4398335918080UL}, 0.96},
-     {{10486144UL, 826277888UL}, 0.96},
-     {{10486144UL, 289407488UL}, -0.96},
-     {{10486144UL, 34649145344UL}, 0.96},
-     {{10486144UL, 289406977UL}, 0.96},
-     {{10486144UL, 4398335918080UL}, 0.96},
-     {{4398056996992UL, 826277888UL}, -0.96},
-     {{4398056996992UL, 289407232UL}, 0.96},
-     {{4398056996992UL, 34649145344UL}, 0.96},
-     {{4398056996992UL, 289406977UL}, -0.96},
-     {{4398056996992UL, 8796382429184UL}, 0.96},
-     {{44040320UL, 20972288UL}, 0.96},
-     {{10486400UL, 54526208UL}, 0.96},
-     {{10486400UL, 20988160UL}, -0.96},
-     {{10486400UL, 289407232UL}, 0.96},
-     {{10486400UL, 20972800UL}, 0.96},
-     {{10486400UL, 34380710144UL}, 0.96},
-     {{10486400UL, 20971777UL}, -0.96},
-     {{10486400UL, 4398067482880UL}, 0.96},
-     {{34370224256UL, 20972288UL}, 0.96},
-     {{34370224256UL, 68740448512UL}, 0.96},
-     {{34370224256UL, 20971777UL}, 0.96},
-     {{34370224256UL, 4398067482880UL}, 0.96},
-     {{4398056996992UL, 20972288UL}, 0.96},
-     {{4398056996992UL, 34380710144UL}, 0.96},
-     {{4398056996992UL, 20971777UL}, 0.96},
-     {{4398056996992UL, 8796113993984UL}, 0.96},
-     {{10486144UL, 34380710400UL}, 0.96},
-     {{10486144UL, 103100186624UL}, 0.96},
-     {{10486144UL, 34380709889UL}, 0.96},
-     {{10486144UL, 4432427220992UL}, 0.96},
-     {{68729962624UL, 34414264320UL}, 0.96},
-     {{68729962624UL, 34380726272UL}, 0.96},
-     {{68729962624UL, 34649145344UL}, 0.96},
-     {{68729962624UL, 34380710144UL}, 0.96},
-     {{68729962624UL, 171819663360UL}, 0.96},
-     {{68729962624UL, 34380709889UL}, 0.96},
-     {{68729962624UL, 4432427220992UL}, 0.96},
-     {{4398056996992UL, 103100186624UL}, 0.96},
-     {{4398056996992UL, 34380709889UL}, -0.96},
-     {{4398056996992UL, 8830473732096UL}, 0.96},
-     {{10486144UL, 20972033UL}, -0.96},
-     {{10486144UL, 20971523UL}, 0.96},
-     {{10486144UL, 4398067482625UL}, 0.96},
-     {{34370224256UL, 20971523UL}, 0.96},
-     {{34370224256UL, 4398067482625UL}, -0.96},
-     {{10485890UL, 54525953UL}, 0.96},
-     {{10485890UL, 20987905UL}, 0},
-     {{10485890UL, 289406977UL}, 0.96},
-     {{10485890UL, 20971777UL}, -0.96},
-     {{10485890UL, 34380709889UL}, -0.96},
-     {{10485890UL, 20971525UL}, 0},
-     {{10485890UL, 4398067482625UL}, 0.96},
-     {{4398056996992UL, 20971523UL}, 0.96},
-     {{4398056996992UL, 8796113993729UL}, 0.96},
-     {{10486144UL, 4398067483136UL}, 0.96},
-     {{10486144UL, 13194160504832UL}, 0.96},
-     {{8796103508096UL, 4398101037056UL}, 0.96},
-     {{8796103508096UL, 4398067499008UL}, 0.96},
-     {{8796103508096UL, 4398335918080UL}, 0.96},
-     {{8796103508096UL, 4398067482880UL}, 0.96},
-     {{8796103508096UL, 4432427220992UL}, 0.96},
-     {{8796103508096UL, 4398067482625UL}, 0.96},
-     {{8796103508096UL, 21990253527040UL}, 0.96},
-     {{77594625UL, 54542336UL}, -0.96},
-     {{77594625UL, 322961408UL}, -0.96},
-     {{77594625UL, 54526080UL}, -0.96},
-     {{77594625UL, 34414264320UL}, -0.96},
-     {{77594625UL, 54525954UL}, -0.96},
-     {{77594625UL, 4398101037056UL}, 0},
-     {{10485763UL, 121634816UL}, 0.96},
-     {{10485763UL, 54542336UL}, 0.96},
-     {{10485763UL, 322961408UL}, 0.96},
-     {{10485763UL, 54526080UL}, 0.96},
-     {{10485763UL, 34414264320UL}, -0.96},
-     {{10485763UL, 54525956UL}, 0.96},
-     {{10485763UL, 4398101037056UL}, 0.96},
-     {{4398056996865UL, 121634816UL}, -0.96},
-     {{4398056996865UL, 54542336UL}, -0.96},
-     {{4398056996865UL, 54526080UL}, -0.96},
-     {{4398056996865UL, 54525954UL}, -0.96},
-     {{10518529UL, 54542336UL}, 0.96},
-     {{10518529UL, 21053440UL}, -0.96},
-     {{10518529UL, 289423360UL}, 0.96},
-     {{10518529UL, 20988032UL}, 0.96},
-     {{10518529UL, 34380726272UL}, 0.96},
-     {{10518529UL, 20987906UL}, 0.96},
-     {{10518529UL, 4398067499008UL}, 0.96},
-     {{10485763UL, 21020672UL}, 0.96},
-     {{10485763UL, 289423360UL}, 0.96},
-     {{10485763UL, 20988032UL}, 0.96},
-     {{10485763UL, 34380726272UL}, -0.96},
-     {{10485763UL, 20987908UL}, 0.96},
-     {{10485763UL, 4398067499008UL}, 0.96},
-     {{4398056996865UL, 21020672UL}, -0.96},
-     {{4398056996865UL, 289423360UL}, 0},
-     {{4398056996865UL, 20988032UL}, 0},
-     {{4398056996865UL, 34380726272UL}, -0.96},
-     {{4398056996865UL, 20987906UL}, 0.96},
-     {{4398056996865UL, 8796114010112UL}, 0.96},
-     {{547356673UL, 322961408UL}, 0.96},
-     {{547356673UL, 289423360UL}, 0.96},
-     {{547356673UL, 1363148800UL}, -0.96},
-     {{547356673UL, 289407104UL}, 0.96},
-     {{547356673UL, 34649145344UL}, 0.96},
-     {{547356673UL, 289406978UL}, 0.96},
-     {{547356673UL, 4398335918080UL}, 0.96},
-     {{10485763UL, 826277888UL}, 0},
-     {{10485763UL, 289407104UL}, 0.96},
-     {{10485763UL, 34649145344UL}, 0},
-     {{10485763UL, 289406980UL}, 0.96},
-     {{10485763UL, 4398335918080UL}, 0.96},
-     {{10486017UL, 54526080UL}, -0.96},
-     {{10486017UL, 20988032UL}, 0.96},
-     {{10486017UL, 289407104UL}, 0.96},
-     {{10486017UL, 20972160UL}, -0.96},
-     {{10486017UL, 34380710016UL}, -0.96},
-     {{10486017UL, 20971650UL}, 0.96},
-     {{10486017UL, 4398067482752UL}, 0.96},
-     {{10485763UL, 20971904UL}, 0.96},
-     {{10485763UL, 34380710016UL}, 0},
-     {{10485763UL, 20971652UL}, -0.96},
-     {{10485763UL, 4398067482752UL}, 0.96},
-     {{4398056996865UL, 20971904UL}, -0.96},
-     {{4398056996865UL, 34380710016UL}, -0.96},
-     {{4398056996865UL, 20971650UL}, -0.96},
-     {{4398056996865UL, 8796113993856UL}, 0},
-     {{68729962497UL, 34414264320UL}, 0.96},
-     {{68729962497UL, 34380726272UL}, 0.96},
-     {{68729962497UL, 34649145344UL}, 0.96},
-     {{68729962497UL, 34380710016UL}, 0},
-     {{68729962497UL, 171819663360UL}, -0.96},
-     {{68729962497UL, 34380709890UL}, 0.96},
-     {{68729962497UL, 4432427220992UL}, 0.96},
-     {{10485763UL, 103100186624UL}, -0.96},
-     {{10485763UL, 34380709892UL}, 0.96},
-     {{10485763UL, 4432427220992UL}, 0.96},
-     {{44040193UL, 20971526UL}, 0.96},
-     {{278921217UL, 20971526UL}, 0.96},
-     {{34370224129UL, 20971526UL}, 0.96},
-     {{10485765UL, 54525954UL}, 0.96},
-     {{10485765UL, 20987906UL}, 0.96},
-     {{10485765UL, 289406978UL}, 0.96},
-     {{10485765UL, 20971650UL}, -0.96},
-     {{10485765UL, 34380709890UL}, 0.96},
-     {{10485765UL, 20971530UL}, 0.96},
-     {{10485765UL, 4398067482626UL}, 0.96},
-     {{4398056996865UL, 20971526UL}, 0.96},
-     {{4398056996865UL, 8796113993730UL}, 0.96},
-     {{10485763UL, 4398067482628UL}, 0.96},
-     {{10485763UL, 13194160504832UL}, 0.96},
-     {{8796103507969UL, 4398101037056UL}, 0.96},
-     {{8796103507969UL, 4398067499008UL}, 0.96},
-     {{8796103507969UL, 4398335918080UL}, 0.96},
-     {{8796103507969UL, 4398067482752UL}, 0},
-     {{8796103507969UL, 4432427220992UL}, 0.96},
-     {{8796103507969UL, 4398067482626UL}, 0.96},
-     {{8796103507969UL, 21990253527040UL}, 0.96},
-     {{94371840UL, 37797888UL}, -0.96},
-     {{94371840UL, 306200576UL}, 0.96},
-     {{94371840UL, 37765248UL}, 0.96},
-     {{94371840UL, 34397503488UL}, 0.96},
-     {{94371840UL, 37765121UL}, 0.96},
-     {{94371840UL, 4398084276224UL}, 0},
-     {{27295744UL, 104873984UL}, 0.96},
-     {{27295744UL, 37830656UL}, 0.96},
-     {{27295744UL, 306200576UL}, 0.96},
-     {{27295744UL, 37765248UL}, 0.96},
-     {{27295744UL, 34397503488UL}, 0.96},
-     {{27295744UL, 37765121UL}, 0.96},
-     {{27295744UL, 4398084276224UL}, 0.96},
-     {{295698432UL, 104873984UL}, 0.96},
-     {{295698432UL, 37797888UL}, 0.96},
-     {{295698432UL, 574636032UL}, 0.96},
-     {{295698432UL, 37765248UL}, 0.96},
-     {{295698432UL, 34397503488UL}, 0.96},
-     {{295698432UL, 37765121UL}, 0.96},
-     {{295698432UL, 4398084276224UL}, 0.96},
-     {{27263104UL, 104873984UL}, 0.96},
-     {{27263104UL, 37797888UL}, -0.96},
-     {{27263104UL, 306200576UL}, 0.96},
-     {{27263104UL, 37765376UL}, 0.96},
-     {{27263104UL, 34397503488UL}, 0.96},
-     {{27263104UL, 37765121UL}, 0.96},
-     {{27263104UL, 4398084276224UL}, 0.96},
-     {{34387001344UL, 104873984UL}, 0.96},
-     {{34387001344UL, 37797888UL}, 0.96},
-     {{34387001344UL, 37765248UL}, 0.96},
-     {{34387001344UL, 68757241856UL}, 0.96},
-     {{34387001344UL, 37765121UL}, 0.96},
-     {{34387001344UL, 4398084276224UL}, 0.96},
-     {{27262977UL, 104873984UL}, 0.96},
-     {{27262977UL, 37797888UL}, -0.96},
-     {{27262977UL, 306200576UL}, 0.96},
-     {{27262977UL, 37765248UL}, 0.96},
-     {{27262977UL, 34397503488UL}, 0.96},
-     {{27262977UL, 37765122UL}, 0.96},
-     {{27262977UL, 4398084276224UL}, 0.96},
-     {{4398073774080UL, 104873984UL}, 0.96},
-     {{4398073774080UL, 37797888UL}, 0.96},
-     {{4398073774080UL, 37765248UL}, 0.96},
-     {{4398073774080UL, 34397503488UL}, 0.96},
-     {{4398073774080UL, 37765121UL}, 0.96},
-     {{4398073774080UL, 8796130787328UL}, 0.96},
-     {{60817408UL, 71352320UL}, 0.96},
-     {{27328512UL, 37797888UL}, 0.96},
-     {{27328512UL, 4374528UL}, 0.96},
-     {{27328512UL, 272678912UL}, 0.96},
-     {{27328512UL, 4243584UL}, 0.96},
-     {{27328512UL, 34363981824UL}, 0.96},
-     {{27328512UL, 4243457UL}, 0.96},
-     {{27328512UL, 4398050754560UL}, -0.96},
-     {{295698432UL, 541114368UL}, -0.96},
-     {{295698432UL, 4243584UL}, 0.96},
-     {{295698432UL, 34363981824UL}, 0.96},
-     {{295698432UL, 4243457UL}, 0.96},
-     {{295698432UL, 4398050754560UL}, 0.96},
-     {{27263104UL, 272678912UL}, 0.96},
-     {{27263104UL, 4243712UL}, -0.96},
-     {{27263104UL, 34363981824UL}, -0.96},
-     {{27263104UL, 4243457UL}, 0.96},
-     {{27263104UL, 4398050754560UL}, -0.96},
-     {{34387001344UL, 272678912UL}, 0.96},
-     {{34387001344UL, 4243584UL}, 0.96},
-     {{34387001344UL, 68723720192UL}, 0.96},
-     {{34387001344UL, 4243457UL}, 0.96},
-     {{34387001344UL, 4398050754560UL}, 0.96},
-     {{27262977UL, 272678912UL}, 0.96},
-     {{27262977UL, 4243584UL}, 0.96},
-     {{27262977UL, 34363981824UL}, 0.96},
-     {{27262977UL, 4243458UL}, -0.96},
-     {{27262977UL, 4398050754560UL}, 0.96},
-     {{4398073774080UL, 272678912UL}, 0.96},
-     {{4398073774080UL, 4243584UL}, 0.96},
-     {{4398073774080UL, 34363981824UL}, 0.96},
-     {{4398073774080UL, 4243457UL}, 0.96},
-     {{4398073774080UL, 8796097265664UL}, 0.96},
-     {{60817408UL, 339755008UL}, 0.96},
-     {{27295744UL, 272711680UL}, 0.96},
-     {{27295744UL, 809517056UL}, 0.96},
-     {{27295744UL, 272646272UL}, 0.96},
-     {{27295744UL, 34632384512UL}, 0.96},
-     {{27295744UL, 272646145UL}, 0.96},
-     {{27295744UL, 4398319157248UL}, 0.96},
-     {{27263104UL, 272646400UL}, 0.96},
-     {{27263104UL, 34632384512UL}, 0.96},
-     {{27263104UL, 272646145UL}, 0.96},
-     {{27263104UL, 4398319157248UL}, 0.96},
-     {{27262977UL, 272646272UL}, 0.96},
-     {{27262977UL, 34632384512UL}, 0.96},
-     {{27262977UL, 272646146UL}, 0.96},
-     {{27262977UL, 4398319157248UL}, 0.96},
-     {{60817408UL, 71319680UL}, 0.96},
-     {{27295744UL, 4276352UL}, 0.96},
-     {{27295744UL, 4211072UL}, 0.96},
-     {{27295744UL, 34363949184UL}, 0.96},
-     {{27295744UL, 4210817UL}, 0.96},
-     {{27295744UL, 4398050721920UL}, 0.96},
-     {{295698432UL, 541081728UL}, 0.96},
-     {{295698432UL, 4211072UL}, 0.96},
-     {{295698432UL, 34363949184UL}, 0.96},
-     {{295698432UL, 4210817UL}, 0.96},
-     {{295698432UL, 4398050721920UL}, 0.96},
-     {{27263232UL, 37765248UL}, 0.96},
-     {{27263232UL, 4243584UL}, 0.96},
-     {{27263232UL, 272646272UL}, 0.96},
-     {{27263232UL, 4211328UL}, 0.96},
-     {{27263232UL, 34363949184UL}, 0.96},
-     {{27263232UL, 4210817UL}, 0.96},
-     {{27263232UL, 4398050721920UL}, 0.96},
-     {{34387001344UL, 4211072UL}, 0.96},
-     {{34387001344UL, 68723687552UL}, 0.96},
-     {{34387001344UL, 4210817UL}, 0.96},
-     {{34387001344UL, 4398050721920UL}, 0.96},
-     {{27262977UL, 4211072UL}, 0.96},
-     {{27262977UL, 34363949184UL}, 0.96},
-     {{27262977UL, 4210818UL}, 0.96},
-     {{27262977UL, 4398050721920UL}, 0.96},
-     {{4398073774080UL, 4211072UL}, 0.96},
-     {{4398073774080UL, 34363949184UL}, 0.96},
-     {{4398073774080UL, 4210817UL}, 0.96},
-     {{4398073774080UL, 8796097233024UL}, 0.96},
-     {{60817408UL, 34431057920UL}, 0.96},
-     {{27295744UL, 34364014592UL}, 0.96},
-     {{27295744UL, 103083425792UL}, 0.96},
-     {{27295744UL, 34363949057UL}, 0.96},
-     {{27295744UL, 4432410460160UL}, 0.96},
-     {{295698432UL, 34900819968UL}, 0.96},
-     {{295698432UL, 103083425792UL}, 0.96},
-     {{295698432UL, 34363949057UL}, 0.96},
-     {{295698432UL, 4432410460160UL}, 0.96},
-     {{27263104UL, 34363949312UL}, 0.96},
-     {{27263104UL, 103083425792UL}, 0.96},
-     {{27263104UL, 34363949057UL}, 0.96},
-     {{27263104UL, 4432410460160UL}, 0.96},
-     {{68746739712UL, 34397503488UL}, 0.96},
-     {{68746739712UL, 34363981824UL}, 0.96},
-     {{68746739712UL, 34363949184UL}, 0.96},
-     {{68746739712UL, 171802902528UL}, 0.96},
-     {{68746739712UL, 34363949057UL}, 0.96},
-     {{68746739712UL, 4432410460160UL}, 0.96},
-     {{27262977UL, 103083425792UL}, 0.96},
-     {{27262977UL, 34363949058UL}, 0.96},
-     {{27262977UL, 4432410460160UL}, 0.96},
-     {{4398073774080UL, 103083425792UL}, 0.96},
-     {{4398073774080UL, 34363949057UL}, 0.96},
-     {{4398073774080UL, 8830456971264UL}, 0.96},
-     {{60817408UL, 71319553UL}, 0.96},
-     {{27295744UL, 4276225UL}, 0.96},
-     {{27295744UL, 4210691UL}, 0.96},
-     {{27295744UL, 4398050721793UL}, 0.96},
-     {{295698432UL, 541081601UL}, 0.96},
-     {{295698432UL, 4210691UL}, 0.96},
-     {{295698432UL, 4398050721793UL}, 0.96},
-     {{27263104UL, 4210945UL}, 0.96},
-     {{27263104UL, 4210691UL}, 0.96},
-     {{27263104UL, 4398050721793UL}, 0.96},
-     {{34387001344UL, 68723687425UL}, 0.96},
-     {{34387001344UL, 4210691UL}, 0.96},
-     {{34387001344UL, 4398050721793UL}, 0.96},
-     {{27262978UL, 37765121UL}, 0.96},
-     {{27262978UL, 4243457UL}, 0.96},
-     {{27262978UL, 272646145UL}, 0.96},
-     {{27262978UL, 4210817UL}, 0.96},
-     {{27262978UL, 34363949057UL}, 0.96},
-     {{27262978UL, 4210693UL}, 0.96},
-     {{27262978UL, 4398050721793UL}, 0.96},
-     {{4398073774080UL, 4210691UL}, 0.96},
-     {{4398073774080UL, 8796097232897UL}, 0.96},
-     {{60817408UL, 4398117830656UL}, 0.96},
-     {{27295744UL, 4398050787328UL}, 0.96},
-     {{27295744UL, 13194143744000UL}, 0.96},
-     {{295698432UL, 4398587592704UL}, 0.96},
-     {{295698432UL, 13194143744000UL}, 0.96},
-     {{27263104UL, 4398050722048UL}, 0.96},
-     {{27263104UL, 13194143744000UL}, 0.96},
-     {{34387001344UL, 4466770198528UL}, 0.96},
-     {{34387001344UL, 13194143744000UL}, 0.96},
-     {{27262977UL, 4398050721794UL}, 0.96},
-     {{27262977UL, 13194143744000UL}, 0.96},
-     {{8796120285184UL, 4398084276224UL}, 0.96},
-     {{8796120285184UL, 4398050754560UL}, -0.96},
-     {{8796120285184UL, 4398050721920UL}, 0.96},
-     {{8796120285184UL, 4432410460160UL}, 0.96},
-     {{8796120285184UL, 4398050721793UL}, 0.96},
-     {{8796120285184UL, 21990236766208UL}, 0.96},
-     {{10584064UL, 54542336UL}, 0.96},
-     {{10584064UL, 21118976UL}, 0.96},
-     {{10584064UL, 289423360UL}, 0.96},
-     {{10584064UL, 20988032UL}, 0.96},
-     {{10584064UL, 34380726272UL}, 0.96},
-     {{10584064UL, 20987905UL}, 0.96},
-     {{10584064UL, 4398067499008UL}, 0.96},
-     {{27295744UL, 4407296UL}, 0.96},
-     {{10649600UL, 21053440UL}, 0.96},
-     {{10649600UL, 4538368UL}, 0.96},
-     {{10649600UL, 272711680UL}, 0.96},
-     {{10649600UL, 4276352UL}, 0.96},
-     {{10649600UL, 34364014592UL}, 0.96},
-     {{10649600UL, 4276225UL}, 0.96},
-     {{10649600UL, 4398050787328UL}, 0.96},
-     {{278953984UL, 4407296UL}, -0.96},
-     {{278953984UL, 541147136UL}, 0.96},
-     {{278953984UL, 4276352UL}, 0.96},
-     {{278953984UL, 34364014592UL}, 0.96},
-     {{278953984UL, 4276225UL}, 0.96},
-     {{278953984UL, 4398050787328UL}, 0.96},
-     {{10518656UL, 4407296UL}, 0},
-     {{10518656UL, 272711680UL}, 0.96},
-     {{10518656UL, 4276480UL}, 0.96},
-     {{10518656UL, 34364014592UL}, 0.96},
-     {{10518656UL, 4276225UL}, 0.96},
-     {{10518656UL, 4398050787328UL}, 0},
-     {{34370256896UL, 4407296UL}, -0.96},
-     {{34370256896UL, 272711680UL}, 0.96},
-     {{34370256896UL, 4276352UL}, 0.96},
-     {{34370256896UL, 68723752960UL}, 0.96},
-     {{34370256896UL, 4276225UL}, 0.96},
-     {{34370256896UL, 4398050787328UL}, 0.96},
-     {{10518529UL, 4407296UL}, -0.96},
-     {{10518529UL, 272711680UL}, 0.96},
-     {{10518529UL, 4276352UL}, 0.96},
-     {{10518529UL, 34364014592UL}, 0.96},
-     {{10518529UL, 4276226UL}, 0.96},
-     {{10518529UL, 4398050787328UL}, -0.96},
-     {{4398057029632UL, 4407296UL}, 0.96},
-     {{4398057029632UL, 272711680UL}, 0.96},
-     {{4398057029632UL, 4276352UL}, 0.96},
-     {{4398057029632UL, 34364014592UL}, 0.96},
-     {{4398057029632UL, 4276225UL}, 0.96},
-     {{4398057029632UL, 8796097298432UL}, 0.96},
-     {{10584064UL, 272777216UL}, 0.96},
-     {{10584064UL, 809517056UL}, 0.96},
-     {{10584064UL, 272646272UL}, 0.96},
-     {{10584064UL, 34632384512UL}, 0.96},
-     {{10584064UL, 272646145UL}, 0.96},
-     {{10584064UL, 4398319157248UL}, 0.96},
-     {{547389440UL, 289423360UL}, 0.96},
-     {{547389440UL, 272711680UL}, 0.96},
-     {{547389440UL, 272646272UL}, 0.96},
-     {{547389440UL, 272646145UL}, 0.96},
-     {{10518656UL, 809517056UL}, 0.96},
-     {{10518656UL, 272646400UL}, 0.96},
-     {{10518656UL, 34632384512UL}, 0.96},
-     {{10518656UL, 272646145UL}, 0.96},
-     {{10518656UL, 4398319157248UL}, 0.96},
-     {{34370256896UL, 809517056UL}, 0.96},
-     {{34370256896UL, 272646272UL}, 0.96},
-     {{34370256896UL, 68992122880UL}, 0.96},
-     {{34370256896UL, 272646145UL}, 0.96},
-     {{34370256896UL, 4398319157248UL}, 0.96},
-     {{10518529UL, 809517056UL}, 0.96},
-     {{10518529UL, 272646272UL}, 0.96},
-     {{10518529UL, 34632384512UL}, 0.96},
-     {{10518529UL, 272646146UL}, 0.96},
-     {{10518529UL, 4398319157248UL}, 0.96},
-     {{4398057029632UL, 809517056UL}, 0.96},
-     {{4398057029632UL, 272646272UL}, 0.96},
-     {{4398057029632UL, 34632384512UL}, 0.96},
-     {{4398057029632UL, 272646145UL}, 0.96},
-     {{4398057029632UL, 8796365668352UL}, 0.96},
-     {{10584064UL, 4341888UL}, 0.96},
-     {{10584064UL, 4211072UL}, 0.96},
-     {{10584064UL, 34363949184UL}, 0.96},
-     {{10584064UL, 4210817UL}, 0.96},
-     {{10584064UL, 4398050721920UL}, 0.96},
-     {{278953984UL, 541081728UL}, 0.96},
-     {{278953984UL, 4211072UL}, 0.96},
-     {{278953984UL, 34363949184UL}, 0.96},
-     {{278953984UL, 4210817UL}, 0.96},
-     {{278953984UL, 4398050721920UL}, 0.96},
-     {{10518784UL, 20988032UL}, 0.96},
-     {{10518784UL, 4276352UL}, 0},
-     {{10518784UL, 272646272UL}, 0.96},
-     {{10518784UL, 4211328UL}, 0.96},
-     {{10518784UL, 34363949184UL}, 0.96},
-     {{10518784UL, 4210817UL}, 0.96},
-     {{10518784UL, 4398050721920UL}, 0.96},
-     {{34370256896UL, 4211072UL}, 0.96},
-     {{34370256896UL, 68723687552UL}, 0.96},
-     {{34370256896UL, 4210817UL}, 0.96},
-     {{34370256896UL, 4398050721920UL}, 0.96},
-     {{10518529UL, 4211072UL}, 0.96},
-     {{10518529UL, 34363949184UL}, 0.96},
-     {{10518529UL, 4210818UL}, 0.96},
-     {{10518529UL, 4398050721920UL}, 0.96},
-     {{4398057029632UL, 4211072UL}, 0.96},
-     {{4398057029632UL, 34363949184UL}, 0.96},
-     {{4398057029632UL, 4210817UL}, 0.96},
-     {{4398057029632UL, 8796097233024UL}, 0.96},
-     {{10584064UL, 34364080128UL}, 0.96},
-     {{10584064UL, 103083425792UL}, 0.96},
-     {{10584064UL, 34363949057UL}, 0.96},
-     {{10584064UL, 4432410460160UL}, 0.96},
-     {{278953984UL, 34900819968UL}, 0.96},
-     {{278953984UL, 103083425792UL}, 0.96},
-     {{278953984UL, 34363949057UL}, 0.96},
-     {{278953984UL, 4432410460160UL}, 0.96},
-     {{10518656UL, 34363949312UL}, 0.96},
-     {{10518656UL, 103083425792UL}, 0.96},
-     {{10518656UL, 34363949057UL}, 0.96},
-     {{10518656UL, 4432410460160UL}, 0.96},
-     {{68729995264UL, 34380726272UL}, 0.96},
-     {{68729995264UL, 34364014592UL}, 0.96},
-     {{68729995264UL, 34632384512UL}, 0.96},
-     {{68729995264UL, 34363949184UL}, 0.96},
-     {{68729995264UL, 171802902528UL}, 0.96},
-     {{68729995264UL, 34363949057UL}, 0.96},
-     {{68729995264UL, 4432410460160UL}, 0.96},
-     {{10518529UL, 103083425792UL}, 0.96},
-     {{10518529UL, 34363949058UL}, 0.96},
-     {{10518529UL, 4432410460160UL}, 0.96},
-     {{4398057029632UL, 103083425792UL}, 0.96},
-     {{4398057029632UL, 34363949057UL}, 0.96},
-     {{4398057029632UL, 8830456971264UL}, 0.96},
-     {{10584064UL, 4341761UL}, 0.96},
-     {{10584064UL, 4210691UL}, 0.96},
-     {{10584064UL, 4398050721793UL}, 0.96},
-     {{278953984UL, 541081601UL}, 0.96},
-     {{278953984UL, 4210691UL}, 0.96},
-     {{278953984UL, 4398050721793UL}, 0.96},
-     {{10518656UL, 4210945UL}, 0.96},
-     {{10518656UL, 4210691UL}, 0.96},
-     {{10518656UL, 4398050721793UL}, 0.96},
-     {{34370256896UL, 68723687425UL}, 0.96},
-     {{34370256896UL, 4210691UL}, 0.96},
-     {{34370256896UL, 4398050721793UL}, 0.96},
-     {{10518530UL, 20987905UL}, 0.96},
-     {{10518530UL, 4276225UL}, 0.96},
-     {{10518530UL, 272646145UL}, 0.96},
-     {{10518530UL, 4210817UL}, 0.96},
-     {{10518530UL, 34363949057UL}, 0.96},
-     {{10518530UL, 4210693UL}, 0.96},
-     {{10518530UL, 4398050721793UL}, 0.96},
-     {{4398057029632UL, 4210691UL}, 0.96},
-     {{4398057029632UL, 8796097232897UL}, 0.96},
-     {{10584064UL, 4398050852864UL}, 0.96},
-     {{10584064UL, 13194143744000UL}, 0.96},
-     {{278953984UL, 4398587592704UL}, 0.96},
-     {{278953984UL, 13194143744000UL}, 0.96},
-     {{10518656UL, 4398050722048UL}, 0.96},
-     {{10518656UL, 13194143744000UL}, 0.96},
-     {{34370256896UL, 4466770198528UL}, 0.96},
-     {{34370256896UL, 13194143744000UL}, 0.96},
-     {{10518529UL, 4398050721794UL}, 0.96},
-     {{10518529UL, 13194143744000UL}, 0.96},
-     {{8796103540736UL, 4398067499008UL}, 0.96},
-     {{8796103540736UL, 4398050787328UL}, 0.96},
-     {{8796103540736UL, 4398319157248UL}, 0.96},
-     {{8796103540736UL, 4398050721920UL}, 0.96},
-     {{8796103540736UL, 4432410460160UL}, 0.96},
-     {{8796103540736UL, 4398050721793UL}, 0.96},
-     {{8796103540736UL, 21990236766208UL}, 0.96},
-     {{278986752UL, 21020672UL}, 0.96},
-     {{278986752UL, 4374528UL}, 0.96},
-     {{278986752UL, 541114368UL}, -0.96},
-     {{278986752UL, 4243584UL}, 0.96},
-     {{278986752UL, 34363981824UL}, 0.96},
-     {{278986752UL, 4243457UL}, 0.96},
-     {{278986752UL, 4398050754560UL}, 0.96},
-     {{815792128UL, 1077985280UL}, -0.96},
-     {{815792128UL, 4243584UL}, 0.96},
-     {{815792128UL, 34363981824UL}, 0.96},
-     {{815792128UL, 4243457UL}, 0.96},
-     {{815792128UL, 4398050754560UL}, 0.96},
-     {{278921344UL, 34363981824UL}, 0},
-     {{278921344UL, 4243457UL}, -0.96},
-     {{278921344UL, 4398050754560UL}, 0.96},
-     {{34638659584UL, 4398050754560UL}, -0.96},
-     {{278921217UL, 541114368UL}, -0.96},
-     {{278921217UL, 4243584UL}, 0.96},
-     {{278921217UL, 34363981824UL}, -0.96},
-     {{278921217UL, 4243458UL}, -0.96},
-     {{278921217UL, 4398050754560UL}, -0.96},
-     {{4398325432320UL, 34363981824UL}, -0.96},
-     {{295698432UL, 1614823424UL}, 0.96},
-     {{278953984UL, 1614823424UL}, 0.96},
-     {{1352663040UL, 541114368UL}, 0.96},
-     {{1352663040UL, 2688565248UL}, 0.96},
-     {{1352663040UL, 541081728UL}, 0.96},
-     {{1352663040UL, 34900819968UL}, 0.96},
-     {{1352663040UL, 541081601UL}, 0.96},
-     {{1352663040UL, 4398587592704UL}, 0.96},
-     {{278921344UL, 1614823424UL}, -0.96},
-     {{278921344UL, 34900819968UL}, 0.96},
-     {{278921344UL, 541081601UL}, 0.96},
-     {{278921344UL, 4398587592704UL}, 0.96},
-     {{34638659584UL, 4398587592704UL}, -0.96},
-     {{278921217UL, 1614823424UL}, -0.96},
-     {{278921217UL, 541081728UL}, 0.96},
-     {{278921217UL, 34900819968UL}, 0.96},
-     {{278921217UL, 541081602UL}, 0.96},
-     {{278921217UL, 4398587592704UL}, -0.96},
-     {{4398325432320UL, 34900819968UL}, 0.96},
-     {{815792128UL, 1077952640UL}, 0.96},
-     {{815792128UL, 4211072UL}, 0.96},
-     {{815792128UL, 34363949184UL}, 0.96},
-     {{815792128UL, 4210817UL}, 0.96},
-     {{815792128UL, 4398050721920UL}, 0.96},
-     {{278921472UL, 4243584UL}, 0.96},
-     {{278921472UL, 541081728UL}, 0.96},
-     {{278921472UL, 4211328UL}, 0.96},
-     {{278921472UL, 34363949184UL}, 0.96},
-     {{278921472UL, 4210817UL}, 0.96},
-     {{278921472UL, 4398050721920UL}, 0.96},
-     {{34638659584UL, 4398050721920UL}, 0.96},
-     {{278921217UL, 4211072UL}, 0.96},
-     {{278921217UL, 34363949184UL}, 0.96},
-     {{278921217UL, 4210818UL}, 0.96},
-     {{278921217UL, 4398050721920UL}, 0.96},
-     {{4398325432320UL, 34363949184UL}, 0.96},
-     {{815792128UL, 35437690880UL}, 0.96},
-     {{815792128UL, 103083425792UL}, 0.96},
-     {{815792128UL, 34363949057UL}, 0.96},
-     {{815792128UL, 4432410460160UL}, 0.96},
-     {{278921344UL, 34363949312UL}, 0.96},
-     {{278921344UL, 103083425792UL}, 0.96},
-     {{278921344UL, 34363949057UL}, 0.96},
-     {{278921344UL, 4432410460160UL}, 0.96},
-     {{68998397952UL, 34363981824UL}, 0.96},
-     {{68998397952UL, 34900819968UL}, 0.96},
-     {{68998397952UL, 34363949184UL}, 0.96},
-     {{68998397952UL, 171802902528UL}, 0.96},
-     {{68998397952UL, 34363949057UL}, 0.96},
-     {{68998397952UL, 4432410460160UL}, 0.96},
-     {{278921217UL, 103083425792UL}, 0.96},
-     {{278921217UL, 34363949058UL}, 0.96},
-     {{278921217UL, 4432410460160UL}, 0.96},
-     {{4398325432320UL, 103083425792UL}, 0},
-     {{4398325432320UL, 34363949057UL}, 0.96},
-     {{4398325432320UL, 8830456971264UL}, 0.96},
-     {{815792128UL, 1077952513UL}, 0.96},
-     {{815792128UL, 4210691UL}, 0.96},
-     {{815792128UL, 4398050721793UL}, 0.96},
-     {{278921344UL, 4210945UL}, 0.96},
-     {{278921344UL, 4210691UL}, 0.96},
-     {{278921344UL, 4398050721793UL}, 0.96},
-     {{34638659584UL, 4398050721793UL}, 0.96},
-     {{278921218UL, 4243457UL}, 0.96},
-     {{278921218UL, 541081601UL}, 0.96},
-     {{278921218UL, 4210817UL}, 0.96},
-     {{278921218UL, 34363949057UL}, 0.96},
-     {{278921218UL, 4210693UL}, 0.96},
-     {{278921218UL, 4398050721793UL}, 0.96},
-     {{815792128UL, 4399124463616UL}, 0.96},
-     {{815792128UL, 13194143744000UL}, 0.96},
-     {{278921344UL, 4398050722048UL}, 0.96},
-     {{278921344UL, 13194143744000UL}, 0.96},
-     {{34638659584UL, 4466770198528UL}, -0.96},
-     {{34638659584UL, 13194143744000UL}, 0.96},
-     {{278921217UL, 4398050721794UL}, 0.96},
-     {{278921217UL, 13194143744000UL}, 0.96},
-     {{8796371943424UL, 4398050754560UL}, -0.96},
-     {{8796371943424UL, 4398587592704UL}, 0.96},
-     {{8796371943424UL, 4398050721920UL}, 0.96},
-     {{8796371943424UL, 4432410460160UL}, 0.96},
-     {{8796371943424UL, 4398050721793UL}, 0.96},
-     {{8796371943424UL, 21990236766208UL}, 0.96},
-     {{10551424UL, 21020672UL}, -0.96},
-     {{10551424UL, 4374528UL}, 0.96},
-     {{10551424UL, 272678912UL}, 0.96},
-     {{10551424UL, 4243712UL}, -0.96},
-     {{10551424UL, 34363981824UL}, 0.96},
-     {{10551424UL, 4243457UL}, 0.96},
-     {{10551424UL, 4398050754560UL}, 0.96},
-     {{10486144UL, 272678912UL}, 0.96},
-     {{10486144UL, 4243968UL}, -0.96},
-     {{10486144UL, 34363981824UL}, 0.96},
-     {{10486144UL, 4243457UL}, 0.96},
-     {{10486144UL, 4398050754560UL}, 0.96},
-     {{34370224256UL, 272678912UL}, -0.96},
-     {{34370224256UL, 4243712UL}, -0.96},
-     {{34370224256UL, 68723720192UL}, -0.96},
-     {{34370224256UL, 4243457UL}, 0.96},
-     {{34370224256UL, 4398050754560UL}, -0.96},
-     {{10485889UL, 272678912UL}, 0.96},
-     {{10485889UL, 34363981824UL}, -0.96},
-     {{10485889UL, 4398050754560UL}, -0.96},
-     {{4398056996992UL, 272678912UL}, 0.96},
-     {{4398056996992UL, 4243712UL}, -0.96},
-     {{4398056996992UL, 34363981824UL}, -0.96},
-     {{4398056996992UL, 4243457UL}, 0.96},
-     {{4398056996992UL, 8796097265664UL}, 0.96},
-     {{10486144UL, 809517056UL}, 0.96},
-     {{10486144UL, 272646656UL}, 0.96},
-     {{10486144UL, 34632384512UL}, 0.96},
-     {{10486144UL, 272646145UL}, 0.96},
-     {{10486144UL, 4398319157248UL}, 0.96},
-     {{34370224256UL, 272646400UL}, 0.96},
-     {{34370224256UL, 272646145UL}, 0.96},
-     {{10485889UL, 809517056UL}, 0.96},
-     {{10485889UL, 272646400UL}, 0.96},
-     {{10485889UL, 34632384512UL}, 0.96},
-     {{10485889UL, 272646146UL}, 0.96},
-     {{10485889UL, 4398319157248UL}, 0.96},
-     {{4398056996992UL, 809517056UL}, 0.96},
-     {{4398056996992UL, 272646400UL}, 0.96},
-     {{4398056996992UL, 34632384512UL}, 0.96},
-     {{4398056996992UL, 272646145UL}, 0.96},
-     {{4398056996992UL, 8796365668352UL}, 0.96},
-     {{27263104UL, 4211456UL}, 0.96},
-     {{10518656UL, 4211456UL}, 0.96},
-     {{278921344UL, 4211456UL}, 0.96},
-     {{10486400UL, 4243712UL}, -0.96},
-     {{10486400UL, 272646400UL}, 0.96},
-     {{10486400UL, 4211968UL}, -0.96},
-     {{10486400UL, 34363949312UL}, 0.96},
-     {{10486400UL, 4210945UL}, 0.96},
-     {{10486400UL, 4398050722048UL}, 0},
-     {{34370224256UL, 4211456UL}, 0},
-     {{34370224256UL, 68723687680UL}, -0.96},
-     {{34370224256UL, 4210945UL}, 0.96},
-     {{34370224256UL, 4398050722048UL}, -0.96},
-     {{10485889UL, 4211456UL}, -0.96},
-     {{10485889UL, 34363949312UL}, -0.96},
-     {{10485889UL, 4398050722048UL}, -0.96},
-     {{4398056996992UL, 4211456UL}, 0.96},
-     {{4398056996992UL, 34363949312UL}, 0.96},
-     {{4398056996992UL, 4210945UL}, 0.96},
-     {{4398056996992UL, 8796097233152UL}, 0.96},
-     {{10486144UL, 34363949568UL}, 0.96},
-     {{10486144UL, 103083425792UL}, 0.96},
-     {{10486144UL, 34363949057UL}, 0.96},
-     {{10486144UL, 4432410460160UL}, 0.96},
-     {{68729962624UL, 34363981824UL}, 0},
-     {{68729962624UL, 34632384512UL}, 0.96},
-     {{68729962624UL, 34363949312UL}, 0.96},
-     {{68729962624UL, 171802902528UL}, 0.96},
-     {{68729962624UL, 34363949057UL}, 0.96},
-     {{68729962624UL, 4432410460160UL}, 0.96},
-     {{10485889UL, 103083425792UL}, 0.96},
-     {{10485889UL, 34363949058UL}, 0.96},
-     {{10485889UL, 4432410460160UL}, 0.96},
-     {{4398056996992UL, 103083425792UL}, -0.96},
-     {{4398056996992UL, 34363949057UL}, 0.96},
-     {{4398056996992UL, 8830456971264UL}, 0},
-     {{10486144UL, 4211201UL}, 0.96},
-     {{10486144UL, 4210691UL}, 0.96},
-     {{10486144UL, 4398050721793UL}, 0.96},
-     {{34370224256UL, 68723687425UL}, 0.96},
-     {{34370224256UL, 4210691UL}, 0.96},
-     {{34370224256UL, 4398050721793UL}, 0.96},
-     {{10485890UL, 4243457UL}, 0.96},
-     {{10485890UL, 272646145UL}, 0.96},
-     {{10485890UL, 4210945UL}, 0.96},
-     {{10485890UL, 34363949057UL}, 0.96},
-     {{10485890UL, 4210693UL}, 0.96},
-     {{10485890UL, 4398050721793UL}, 0.96},
-     {{4398056996992UL, 4210691UL}, 0.96},
-     {{4398056996992UL, 8796097232897UL}, 0.96},
-     {{10486144UL, 4398050722304UL}, 0.96},
-     {{10486144UL, 13194143744000UL}, 0.96},
-     {{34370224256UL, 4466770198528UL}, -0.96},
-     {{34370224256UL, 13194143744000UL}, 0},
-     {{10485889UL, 4398050721794UL}, 0.96},
-     {{10485889UL, 13194143744000UL}, 0.96},
-     {{8796103508096UL, 4398050754560UL}, -0.96},
-     {{8796103508096UL, 4398319157248UL}, 0.96},
-     {{8796103508096UL, 4398050722048UL}, 0.96},
-     {{8796103508096UL, 4432410460160UL}, 0.96},
-     {{8796103508096UL, 4398050721793UL}, 0.96},
-     {{8796103508096UL, 21990236766208UL}, 0.96},
-     {{34370289664UL, 21020672UL}, 0.96},
-     {{34370289664UL, 4374528UL}, 0.96},
-     {{34370289664UL, 272678912UL}, 0.96},
-     {{34370289664UL, 4243584UL}, 0.96},
-     {{34370289664UL, 68723720192UL}, 0.96},
-     {{34370289664UL, 4243457UL}, 0.96},
-     {{34370289664UL, 4398050754560UL}, 0.96},
-     {{103089700864UL, 4243584UL}, 0.96},
-     {{103089700864UL, 137443196928UL}, 0.96},
-     {{103089700864UL, 4243457UL}, 0.96},
-     {{103089700864UL, 4398050754560UL}, 0.96},
-     {{34370224129UL, 4243584UL}, 0.96},
-     {{34370224129UL, 68723720192UL}, -0.96},
-     {{34370224129UL, 4243458UL}, 0.96},
-     {{34370224129UL, 4398050754560UL}, -0.96},
-     {{34370224384UL, 4243584UL}, 0.96},
-     {{34370224384UL, 4211328UL}, 0.96},
-     {{34370224384UL, 68723687552UL}, 0.96},
-     {{34370224384UL, 4210817UL}, 0.96},
-     {{34370224384UL, 4398050721920UL}, 0.96},
-     {{103089700864UL, 4211072UL}, 0.96},
-     {{103089700864UL, 137443164288UL}, 0.96},
-     {{103089700864UL, 4210817UL}, 0.96},
-     {{103089700864UL, 4398050721920UL}, 0.96},
-     {{34370224129UL, 4211072UL}, 0.96},
-     {{34370224129UL, 68723687552UL}, 0.96},
-     {{34370224129UL, 4210818UL}, 0.96},
-     {{34370224129UL, 4398050721920UL}, 0.96},
-     {{34387001344UL, 206162640896UL}, 0.96},
-     {{34370256896UL, 206162640896UL}, 0.96},
-     {{34370224256UL, 206162640896UL}, -0.96},
-     {{171809177600UL, 68723720192UL}, 0.96},
-     {{171809177600UL, 68723687552UL}, 0.96},
-     {{171809177600UL, 343601594368UL}, 0},
-     {{171809177600UL, 68723687425UL}, 0.96},
-     {{171809177600UL, 4466770198528UL}, -0.96},
-     {{34370224129UL, 206162640896UL}, -0.96},
-     {{34370224129UL, 68723687426UL}, 0.96},
-     {{34370224129UL, 4466770198528UL}, -0.96},
-     {{103089700864UL, 137443164161UL}, 0.96},
-     {{103089700864UL, 4210691UL}, 0.96},
-     {{103089700864UL, 4398050721793UL}, 0.96},
-     {{34370224130UL, 4243457UL}, 0.96},
-     {{34370224130UL, 4210817UL}, 0.96},
-     {{34370224130UL, 68723687425UL}, 0.96},
-     {{34370224130UL, 4210693UL}, 0.96},
-     {{34370224130UL, 4398050721793UL}, 0.96},
-     {{103089700864UL, 4535489675264UL}, 0.96},
-     {{103089700864UL, 13194143744000UL}, 0.96},
-     {{34370224129UL, 4398050721794UL}, 0.96},
-     {{34370224129UL, 13194143744000UL}, 0.96},
-     {{8830463246336UL, 4398050754560UL}, -0.96},
-     {{8830463246336UL, 4398050721920UL}, 0.96},
-     {{8830463246336UL, 4466770198528UL}, 0},
-     {{8830463246336UL, 4398050721793UL}, 0.96},
-     {{8830463246336UL, 21990236766208UL}, 0.96},
-     {{10551297UL, 21020672UL}, -0.96},
-     {{10551297UL, 4374528UL}, -0.96},
-     {{10551297UL, 272678912UL}, 0.96},
-     {{10551297UL, 4243584UL}, 0.96},
-     {{10551297UL, 34363981824UL}, 0.96},
-     {{10551297UL, 4243458UL}, -0.96},
-     {{10551297UL, 4398050754560UL}, 0.96},
-     {{10485763UL, 272678912UL}, 0.96},
-     {{10485763UL, 4243584UL}, 0.96},
-     {{10485763UL, 34363981824UL}, 0.96},
-     {{10485763UL, 4243460UL}, -0.96},
-     {{10485763UL, 4398050754560UL}, 0.96},
-     {{4398056996865UL, 272678912UL}, -0.96},
-     {{4398056996865UL, 4243584UL}, 0.96},
-     {{4398056996865UL, 34363981824UL}, 0.96},
-     {{4398056996865UL, 4243458UL}, 0.96},
-     {{4398056996865UL, 8796097265664UL}, 0.96},
-     {{10485763UL, 809517056UL}, -0.96},
-     {{10485763UL, 272646272UL}, 0.96},
-     {{10485763UL, 34632384512UL}, 0.96},
-     {{10485763UL, 272646148UL}, 0.96},
-     {{10485763UL, 4398319157248UL}, 0.96},
-     {{4398056996865UL, 272646272UL}, 0.96},
-     {{4398056996865UL, 272646146UL}, 0.96},
-     {{10486017UL, 4243584UL}, 0.96},
-     {{10486017UL, 272646272UL}, 0.96},
-     {{10486017UL, 4211328UL}, 0.96},
-     {{10486017UL, 34363949184UL}, 0.96},
-     {{10486017UL, 4210818UL}, 0.96},
-     {{10486017UL, 4398050721920UL}, 0.96},
-     {{10485763UL, 4211072UL}, 0.96},
-     {{10485763UL, 34363949184UL}, 0.96},
-     {{10485763UL, 4210820UL}, 0.96},
-     {{10485763UL, 4398050721920UL}, 0.96},
-     {{4398056996865UL, 4211072UL}, 0.96},
-     {{4398056996865UL, 34363949184UL}, 0.96},
-     {{4398056996865UL, 4210818UL}, 0.96},
-     {{4398056996865UL, 8796097233024UL}, 0.96},
-     {{68729962497UL, 34363981824UL}, 0.96},
-     {{68729962497UL, 34632384512UL}, 0.96},
-     {{68729962497UL, 34363949184UL}, 0.96},
-     {{68729962497UL, 171802902528UL}, 0.96},
-     {{68729962497UL, 34363949058UL}, 0.96},
-     {{68729962497UL, 4432410460160UL}, 0.96},
-     {{10485763UL, 103083425792UL}, 0.96},
-     {{10485763UL, 34363949060UL}, 0.96},
-     {{10485763UL, 4432410460160UL}, 0.96},
-     {{4398056996865UL, 103083425792UL}, -0.96},
-     {{4398056996865UL, 34363949058UL}, 0.96},
-     {{4398056996865UL, 8830456971264UL}, 0.96},
-     {{27262977UL, 4210694UL}, 0.96},
-     {{10518529UL, 4210694UL}, 0.96},
-     {{278921217UL, 4210694UL}, 0.96},
-     {{10485889UL, 4210694UL}, 0.96},
-     {{34370224129UL, 4210694UL}, 0.96},
-     {{10485765UL, 4243458UL}, -0.96},
-     {{10485765UL, 272646146UL}, 0.96},
-     {{10485765UL, 4210818UL}, 0.96},
-     {{10485765UL, 34363949058UL}, 0.96},
-     {{10485765UL, 4210698UL}, 0.96},
-     {{10485765UL, 4398050721794UL}, 0.96},
-     {{4398056996865UL, 4210694UL}, 0.96},
-     {{4398056996865UL, 8796097232898UL}, 0.96},
-     {{10485763UL, 4398050721796UL}, 0.96},
-     {{10485763UL, 13194143744000UL}, 0.96},
-     {{8796103507969UL, 4398050754560UL}, -0.96},
-     {{8796103507969UL, 4398319157248UL}, 0.96},
-     {{8796103507969UL, 4398050721920UL}, 0.96},
-     {{8796103507969UL, 4432410460160UL}, 0.96},
-     {{8796103507969UL, 4398050721794UL}, 0.96},
-     {{8796103507969UL, 21990236766208UL}, 0.96},
-     {{4398057062400UL, 21020672UL}, 0.96},
-     {{4398057062400UL, 4374528UL}, 0.96},
-     {{4398057062400UL, 272678912UL}, 0.96},
-     {{4398057062400UL, 4243584UL}, 0.96},
-     {{4398057062400UL, 34363981824UL}, 0.96},
-     {{4398057062400UL, 4243457UL}, 0.96},
-     {{4398057062400UL, 8796097265664UL}, 0.96},
-     {{13194150019072UL, 4243584UL}, 0.96},
-     {{13194150019072UL, 34363981824UL}, 0},
-     {{13194150019072UL, 4243457UL}, 0.96},
-     {{13194150019072UL, 17592190287872UL}, 0.96},
-     {{4398056997120UL, 4243584UL}, 0.96},
-     {{4398056997120UL, 4211328UL}, 0.96},
-     {{4398056997120UL, 34363949184UL}, 0.96},
-     {{4398056997120UL, 4210817UL}, 0.96},
-     {{4398056997120UL, 8796097233024UL}, 0.96},
-     {{13194150019072UL, 4211072UL}, 0.96},
-     {{13194150019072UL, 34363949184UL}, 0.96},
-     {{13194150019072UL, 4210817UL}, 0.96},
-     {{13194150019072UL, 17592190255232UL}, 0.96},
-     {{4466776473600UL, 34363981824UL}, 0.96},
-     {{4466776473600UL, 34363949184UL}, 0.96},
-     {{4466776473600UL, 171802902528UL}, 0.96},
-     {{4466776473600UL, 34363949057UL}, 0.96},
-     {{4466776473600UL, 8830456971264UL}, 0.96},
-     {{13194150019072UL, 103083425792UL}, 0.96},
-     {{13194150019072UL, 34363949057UL}, 0.96},
-     {{13194150019072UL, 17626549993472UL}, 0.96},
-     {{4398056996866UL, 4243457UL}, 0.96},
-     {{4398056996866UL, 4210817UL}, 0.96},
-     {{4398056996866UL, 34363949057UL}, 0.96},
-     {{4398056996866UL, 4210693UL}, 0.96},
-     {{4398056996866UL, 8796097232897UL}, 0.96},
-     {{13194150019072UL, 4210691UL}, 0.96},
-     {{13194150019072UL, 17592190255105UL}, 0.96},
-     {{4398073774080UL, 26388283277312UL}, 0.96},
-     {{4398057029632UL, 26388283277312UL}, 0.96},
-     {{4398056996992UL, 26388283277312UL}, 0.96},
-     {{4398056996865UL, 26388283277312UL}, 0.96},
-     {{21990243041280UL, 8796097265664UL}, 0.96},
-     {{21990243041280UL, 8796097233024UL}, 0.96},
-     {{21990243041280UL, 8830456971264UL}, 0.96},
-     {{21990243041280UL, 8796097232897UL}, 0.96},
-     {{21990243041280UL, 43980469321728UL}, 0.96},
-     {{94371840UL, 37749120UL}, 0.96},
-     {{94371840UL, 34397487232UL}, 0.96},
-     {{94371840UL, 37748865UL}, 0.96},
-     {{94371840UL, 4398084259968UL}, 0.96},
-     {{27279360UL, 104857728UL}, 0.96},
-     {{27279360UL, 37781632UL}, 0.96},
-     {{27279360UL, 37749120UL}, 0.96},
-     {{27279360UL, 34397487232UL}, 0.96},
-     {{27279360UL, 37748865UL}, 0.96},
-     {{27279360UL, 4398084259968UL}, 0.96},
-     {{295698432UL, 104857728UL}, 0.96},
-     {{295698432UL, 574619776UL}, 0.96},
-     {{295698432UL, 37749120UL}, 0.96},
-     {{295698432UL, 37748865UL}, 0.96},
-     {{295698432UL, 4398084259968UL}, 0.96},
-     {{27263232UL, 104857728UL}, 0.96},
-     {{27263232UL, 37749376UL}, 0.96},
-     {{27263232UL, 34397487232UL}, 0.96},
-     {{27263232UL, 37748865UL}, 0.96},
-     {{27263232UL, 4398084259968UL}, 0.96},
-     {{34387001344UL, 104857728UL}, 0.96},
-     {{34387001344UL, 37749120UL}, 0.96},
-     {{34387001344UL, 68757225600UL}, 0.96},
-     {{34387001344UL, 37748865UL}, 0.96},
-     {{34387001344UL, 4398084259968UL}, 0.96},
-     {{27262977UL, 104857728UL}, 0.96},
-     {{27262977UL, 37749120UL}, 0.96},
-     {{27262977UL, 34397487232UL}, 0.96},
-     {{27262977UL, 37748866UL}, 0.96},
-     {{27262977UL, 4398084259968UL}, 0.96},
-     {{4398073774080UL, 104857728UL}, 0.96},
-     {{4398073774080UL, 37749120UL}, 0.96},
-     {{4398073774080UL, 37748865UL}, 0.96},
-     {{4398073774080UL, 8796130771072UL}, 0.96},
-     {{60817408UL, 71303552UL}, 0.96},
-     {{27279360UL, 4227456UL}, 0.96},
-     {{27279360UL, 34363933056UL}, 0.96},
-     {{27279360UL, 4194689UL}, 0.96},
-     {{27279360UL, 4398050705792UL}, 0.96},
-     {{295698432UL, 541065600UL}, 0.96},
-     {{295698432UL, 34363933056UL}, 0.96},
-     {{295698432UL, 4194689UL}, 0.96},
-     {{295698432UL, 4398050705792UL}, 0.96},
-     {{27263488UL, 37749120UL}, -0.96},
-     {{27263488UL, 4211072UL}, 0.96},
-     {{27263488UL, 272630144UL}, 0.96},
-     {{27263488UL, 4195712UL}, 0.96},
-     {{27263488UL, 34363933056UL}, 0.96},
-     {{27263488UL, 4194689UL}, 0.96},
-     {{27263488UL, 4398050705792UL}, 0.96},
-     {{34387001344UL, 68723671424UL}, 0.96},
-     {{34387001344UL, 4194689UL}, 0.96},
-     {{34387001344UL, 4398050705792UL}, 0.96},
-     {{27262977UL, 34363933056UL}, 0.96},
-     {{27262977UL, 4194690UL}, 0.96},
-     {{27262977UL, 4398050705792UL}, 0.96},
-     {{4398073774080UL, 34363933056UL}, 0.96},
-     {{4398073774080UL, 4194689UL}, 0.96},
-     {{4398073774080UL, 8796097216896UL}, 0.96},
-     {{60817408UL, 34431041664UL}, 0.96},
-     {{27279360UL, 34363965568UL}, 0.96},
-     {{27279360UL, 34363932801UL}, 0.96},
-     {{27279360UL, 4432410443904UL}, 0.96},
-     {{27263232UL, 34363933312UL}, 0.96},
-     {{27263232UL, 103083409536UL}, 0.96},
-     {{27263232UL, 34363932801UL}, 0.96},
-     {{27263232UL, 4432410443904UL}, 0.96},
-     {{27262977UL, 34363932802UL}, 0.96},
-     {{27262977UL, 4432410443904UL}, 0.96},
-     {{60817408UL, 71303297UL}, 0.96},
-     {{27279360UL, 4227201UL}, 0.96},
-     {{27279360UL, 4194435UL}, 0.96},
-     {{27279360UL, 4398050705537UL}, 0.96},
-     {{295698432UL, 541065345UL}, 0.96},
-     {{295698432UL, 4194435UL}, 0.96},
-     {{295698432UL, 4398050705537UL}, 0.96},
-     {{27263232UL, 4194945UL}, 0.96},
-     {{27263232UL, 4194435UL}, 0.96},
-     {{27263232UL, 4398050705537UL}, 0.96},
-     {{34387001344UL, 68723671169UL}, 0.96},
-     {{34387001344UL, 4194435UL}, 0.96},
-     {{34387001344UL, 4398050705537UL}, 0.96},
-     {{27262978UL, 37748865UL}, 0.96},
-     {{27262978UL, 4194689UL}, 0.96},
-     {{27262978UL, 34363932801UL}, 0.96},
-     {{27262978UL, 4194437UL}, 0.96},
-     {{27262978UL, 4398050705537UL}, 0.96},
-     {{4398073774080UL, 4194435UL}, 0.96},
-     {{4398073774080UL, 8796097216641UL}, 0.96},
-     {{60817408UL, 4398117814400UL}, 0.96},
-     {{27279360UL, 4398050738304UL}, 0.96},
-     {{27279360UL, 13194143727744UL}, 0.96},
-     {{295698432UL, 4398587576448UL}, 0.96},
-     {{295698432UL, 13194143727744UL}, 0.96},
-     {{27263232UL, 4398050706048UL}, 0.96},
-     {{27263232UL, 13194143727744UL}, 0.96},
-     {{34387001344UL, 4466770182272UL}, 0.96},
-     {{34387001344UL, 13194143727744UL}, 0.96},
-     {{27262977UL, 4398050705538UL}, 0.96},
-     {{27262977UL, 13194143727744UL}, 0.96},
-     {{8796120285184UL, 4398084259968UL}, 0.96},
-     {{8796120285184UL, 4398050705792UL}, 0.96},
-     {{8796120285184UL, 4398050705537UL}, 0.96},
-     {{8796120285184UL, 21990236749952UL}, 0.96},
-     {{27279360UL, 4292736UL}, 0.96},
-     {{10567680UL, 4358272UL}, 0.96},
-     {{10567680UL, 4227456UL}, 0.96},
-     {{10567680UL, 34363965568UL}, 0.96},
-     {{10567680UL, 4227201UL}, 0.96},
-     {{10567680UL, 4398050738304UL}, 0.96},
-     {{278937600UL, 34363965568UL}, 0.96},
-     {{10502400UL, 4292736UL}, 0.96},
-     {{10502400UL, 4227712UL}, 0.96},
-     {{10502400UL, 34363965568UL}, 0.96},
-     {{10502400UL, 4227201UL}, 0.96},
-     {{10502400UL, 4398050738304UL}, 0.96},
-     {{10502145UL, 4292736UL}, -0.96},
-     {{10502145UL, 34363965568UL}, -0.96},
-     {{10502145UL, 4398050738304UL}, 0.96},
-     {{4398057013248UL, 4292736UL}, -0.96},
-     {{4398057013248UL, 4227456UL}, -0.96},
-     {{4398057013248UL, 34363965568UL}, -0.96},
-     {{4398057013248UL, 4227201UL}, 0},
-     {{4398057013248UL, 8796097249408UL}, 0.96},
-     {{10534912UL, 4260224UL}, 0.96},
-     {{10534912UL, 34363933056UL}, 0.96},
-     {{10534912UL, 4194689UL}, 0.96},
-     {{10534912UL, 4398050705792UL}, 0.96},
-     {{278937600UL, 34363933056UL}, 0.96},
-     {{10502656UL, 20971904UL}, -0.96},
-     {{10502656UL, 4227456UL}, -0.96},
-     {{10502656UL, 272630144UL}, 0.96},
-     {{10502656UL, 4195712UL}, 0.96},
-     {{10502656UL, 34363933056UL}, 0.96},
-     {{10502656UL, 4194689UL}, 0.96},
-     {{10502656UL, 4398050705792UL}, 0.96},
-     {{10502145UL, 34363933056UL}, 0},
-     {{10502145UL, 4398050705792UL}, 0.96},
-     {{4398057013248UL, 34363933056UL}, 0.96},
-     {{4398057013248UL, 4194689UL}, 0.96},
-     {{4398057013248UL, 8796097216896UL}, 0.96},
-     {{10534912UL, 34363998336UL}, 0.96},
-     {{10534912UL, 103083409536UL}, 0.96},
-     {{10534912UL, 34363932801UL}, 0.96},
-     {{10534912UL, 4432410443904UL}, 0.96},
-     {{278937600UL, 34363932801UL}, 0.96},
-     {{10502400UL, 34363933312UL}, 0.96},
-     {{10502400UL, 103083409536UL}, 0.96},
-     {{10502400UL, 34363932801UL}, 0.96},
-     {{10502400UL, 4432410443904UL}, 0.96},
-     {{68729978880UL, 34363965568UL}, 0.96},
-     {{68729978880UL, 34363933056UL}, 0.96},
-     {{68729978880UL, 171802886272UL}, 0.96},
-     {{68729978880UL, 34363932801UL}, 0.96},
-     {{68729978880UL, 4432410443904UL}, 0.96},
-     {{10502145UL, 103083409536UL}, 0.96},
-     {{10502145UL, 34363932802UL}, 0.96},
-     {{10502145UL, 4432410443904UL}, 0.96},
-     {{4398057013248UL, 103083409536UL}, -0.96},
-     {{4398057013248UL, 34363932801UL}, 0.96},
-     {{4398057013248UL, 8830456955008UL}, -0.96},
-     {{10534912UL, 4259969UL}, 0.96},
-     {{10534912UL, 4194435UL}, 0.96},
-     {{10534912UL, 4398050705537UL}, 0.96},
-     {{10502400UL, 4194945UL}, 0.96},
-     {{10502400UL, 4194435UL}, 0.96},
-     {{10502400UL, 4398050705537UL}, 0.96},
-     {{10502146UL, 4227201UL}, 0.96},
-     {{10502146UL, 4194689UL}, 0.96},
-     {{10502146UL, 34363932801UL}, 0.96},
-     {{10502146UL, 4194437UL}, 0.96},
-     {{10502146UL, 4398050705537UL}, 0.96},
-     {{4398057013248UL, 4194435UL}, 0.96},
-     {{4398057013248UL, 8796097216641UL}, 0.96},
-     {{10534912UL, 4398050771072UL}, 0.96},
-     {{10534912UL, 13194143727744UL}, 0.96},
-     {{10502400UL, 4398050706048UL}, 0.96},
-     {{10502400UL, 13194143727744UL}, 0.96},
-     {{10502145UL, 4398050705538UL}, 0.96},
-     {{10502145UL, 13194143727744UL}, 0.96},
-     {{8796103524352UL, 4398050738304UL}, 0.96},
-     {{8796103524352UL, 4398050705792UL}, 0.96},
-     {{8796103524352UL, 4432410443904UL}, 0.96},
-     {{8796103524352UL, 4398050705537UL}, 0.96},
-     {{8796103524352UL, 21990236749952UL}, 0.96},
-     {{295698432UL, 1614807168UL}, 0.96},
-     {{1352663040UL, 2688548992UL}, 0.96},
-     {{1352663040UL, 541065600UL}, 0.96},
-     {{1352663040UL, 541065345UL}, 0.96},
-     {{1352663040UL, 4398587576448UL}, 0.96},
-     {{278921472UL, 1614807168UL}, 0.96},
-     {{278921472UL, 541065856UL}, 0.96},
-     {{278921472UL, 541065345UL}, 0.96},
-     {{278921472UL, 4398587576448UL}, 0.96},
-     {{278921217UL, 1614807168UL}, 0.96},
-     {{278921217UL, 541065600UL}, 0.96},
-     {{278921217UL, 541065346UL}, 0.96},
-     {{278921217UL, 4398587576448UL}, 0.96},
-     {{815792128UL, 1077936512UL}, 0.96},
-     {{815792128UL, 4194689UL}, 0.96},
-     {{815792128UL, 4398050705792UL}, 0.96},
-     {{278921728UL, 20971904UL}, 0.96},
-     {{278921728UL, 4211072UL}, 0.96},
-     {{278921728UL, 541065600UL}, 0.96},
-     {{278921728UL, 4195712UL}, 0.96},
-     {{278921728UL, 34363933056UL}, -0.96},
-     {{278921728UL, 4194689UL}, 0.96},
-     {{278921728UL, 4398050705792UL}, 0.96},
-     {{278921217UL, 4194690UL}, 0.96},
-     {{278921217UL, 4398050705792UL}, 0.96},
-     {{815792128UL, 1077936257UL}, 0.96},
-     {{815792128UL, 4194435UL}, 0.96},
-     {{815792128UL, 4398050705537UL}, 0.96},
-     {{278921472UL, 4194945UL}, 0.96},
-     {{278921472UL, 4194435UL}, 0.96},
-     {{278921472UL, 4398050705537UL}, 0.96},
-     {{278921218UL, 541065345UL}, 0.96},
-     {{278921218UL, 4194689UL}, 0.96},
-     {{278921218UL, 4194437UL}, 0.96},
-     {{278921218UL, 4398050705537UL}, 0.96},
-     {{815792128UL, 4399124447360UL}, 0.96},
-     {{815792128UL, 13194143727744UL}, 0.96},
-     {{278921472UL, 4398050706048UL}, 0.96},
-     {{278921472UL, 13194143727744UL}, 0.96},
-     {{278921217UL, 4398050705538UL}, 0.96},
-     {{278921217UL, 13194143727744UL}, 0.96},
-     {{8796371943424UL, 4398587576448UL}, 0.96},
-     {{8796371943424UL, 4398050705792UL}, 0.96},
-     {{8796371943424UL, 4398050705537UL}, 0.96},
-     {{8796371943424UL, 21990236749952UL}, 0.96},
-     {{10486528UL, 54526080UL}, 0.96},
-     {{10486528UL, 20988032UL}, 0.96},
-     {{10486528UL, 289407104UL}, 0.96},
-     {{10486528UL, 20972672UL}, 0.96},
-     {{10486528UL, 34380710016UL}, 0.96},
-     {{10486528UL, 20971649UL}, 0.96},
-     {{10486528UL, 4398067482752UL}, 0.96},
-     {{10486528UL, 4243584UL}, 0.96},
-     {{10486528UL, 272646272UL}, 0.96},
-     {{10486528UL, 4211840UL}, 0.96},
-     {{10486528UL, 34363949184UL}, 0.96},
-     {{10486528UL, 4210817UL}, 0.96},
-     {{10486528UL, 4398050721920UL}, 0.96},
-     {{10486528UL, 809500800UL}, 0.96},
-     {{10486528UL, 272630912UL}, 0.96},
-     {{10486528UL, 34632368256UL}, 0.96},
-     {{10486528UL, 272629889UL}, 0.96},
-     {{10486528UL, 4398319140992UL}, 0.96},
-     {{27263232UL, 4195968UL}, 0.96},
-     {{10502400UL, 4195968UL}, 0.96},
-     {{278921472UL, 4195968UL}, 0.96},
-     {{10487040UL, 20972160UL}, 0.96},
-     {{10487040UL, 4211328UL}, 0.96},
-     {{10487040UL, 272630400UL}, 0.96},
-     {{10487040UL, 4196992UL}, 0.96},
-     {{10487040UL, 34363933312UL}, 0.96},
-     {{10487040UL, 4194945UL}, 0.96},
-     {{10487040UL, 4398050706048UL}, 0.96},
-     {{34370224384UL, 4195968UL}, 0.96},
-     {{34370224384UL, 68723671680UL}, 0.96},
-     {{34370224384UL, 4194945UL}, 0.96},
-     {{34370224384UL, 4398050706048UL}, 0.96},
-     {{10486017UL, 4195968UL}, 0.96},
-     {{10486017UL, 34363933312UL}, 0.96},
-     {{10486017UL, 4194946UL}, 0.96},
-     {{10486017UL, 4398050706048UL}, 0.96},
-     {{4398056997120UL, 4195968UL}, 0.96},
-     {{4398056997120UL, 34363933312UL}, 0.96},
-     {{4398056997120UL, 4194945UL}, 0.96},
-     {{4398056997120UL, 8796097217152UL}, 0.96},
-     {{10486528UL, 34363933824UL}, 0.96},
-     {{10486528UL, 103083409536UL}, 0.96},
-     {{10486528UL, 34363932801UL}, 0.96},
-     {{10486528UL, 4432410443904UL}, 0.96},
-     {{68729962752UL, 34380710016UL}, 0.96},
-     {{68729962752UL, 34363949184UL}, 0.96},
-     {{68729962752UL, 34363933312UL}, 0.96},
-     {{68729962752UL, 34363932801UL}, 0.96},
-     {{10486017UL, 103083409536UL}, 0.96},
-     {{10486017UL, 34363932802UL}, 0.96},
-     {{10486017UL, 4432410443904UL}, 0.96},
-     {{4398056997120UL, 103083409536UL}, 0.96},
-     {{4398056997120UL, 34363932801UL}, 0.96},
-     {{4398056997120UL, 8830456955008UL}, 0.96},
-     {{10486528UL, 4195457UL}, 0.96},
-     {{10486528UL, 4194435UL}, 0.96},
-     {{10486528UL, 4398050705537UL}, 0.96},
-     {{34370224384UL, 68723671169UL}, 0.96},
-     {{34370224384UL, 4194435UL}, 0.96},
-     {{34370224384UL, 4398050705537UL}, 0.96},
-     {{10486018UL, 20971649UL}, 0.96},
-     {{10486018UL, 4210817UL}, 0.96},
-     {{10486018UL, 272629889UL}, 0.96},
-     {{10486018UL, 4194945UL}, 0.96},
-     {{10486018UL, 34363932801UL}, 0.96},
-     {{10486018UL, 4194437UL}, 0.96},
-     {{10486018UL, 4398050705537UL}, 0.96},
-     {{4398056997120UL, 4194435UL}, 0.96},
-     {{4398056997120UL, 8796097216641UL}, 0.96},
-     {{10486528UL, 4398050706560UL}, 0.96},
-     {{10486528UL, 13194143727744UL}, 0.96},
-     {{34370224384UL, 4466770182272UL}, 0.96},
-     {{34370224384UL, 13194143727744UL}, 0.96},
-     {{10486017UL, 4398050705538UL}, 0.96},
-     {{10486017UL, 13194143727744UL}, 0.96},
-     {{8796103508224UL, 4398067482752UL}, 0.96},
-     {{8796103508224UL, 4398050721920UL}, 0.96},
-     {{8796103508224UL, 4398319140992UL}, 0.96},
-     {{8796103508224UL, 4398050706048UL}, 0.96},
-     {{8796103508224UL, 4432410443904UL}, 0.96},
-     {{8796103508224UL, 4398050705537UL}, 0.96},
-     {{8796103508224UL, 21990236749952UL}, 0.96},
-     {{34370224640UL, 20971904UL}, 0.96},
-     {{34370224640UL, 4211072UL}, 0.96},
-     {{34370224640UL, 272630144UL}, -0.96},
-     {{34370224640UL, 4195712UL}, 0.96},
-     {{34370224640UL, 68723671424UL}, 0.96},
-     {{34370224640UL, 4194689UL}, 0.96},
-     {{34370224640UL, 4398050705792UL}, 0.96},
-     {{103089700864UL, 137443148160UL}, 0.96},
-     {{103089700864UL, 4194689UL}, 0.96},
-     {{103089700864UL, 4398050705792UL}, 0.96},
-     {{34370224129UL, 68723671424UL}, 0.96},
-     {{34370224129UL, 4194690UL}, 0.96},
-     {{34370224129UL, 4398050705792UL}, 0.96},
-     {{34387001344UL, 206162624640UL}, 0.96},
-     {{34370224384UL, 206162624640UL}, 0.96},
-     {{171809177600UL, 68723671424UL}, 0.96},
-     {{171809177600UL, 343601578112UL}, 0.96},
-     {{171809177600UL, 68723671169UL}, 0.96},
-     {{171809177600UL, 4466770182272UL}, 0.96},
-     {{34370224129UL, 206162624640UL}, 0.96},
-     {{34370224129UL, 68723671170UL}, 0.96},
-     {{34370224129UL, 4466770182272UL}, 0.96},
-     {{103089700864UL, 137443147905UL}, 0.96},
-     {{103089700864UL, 4194435UL}, 0.96},
-     {{103089700864UL, 4398050705537UL}, 0.96},
-     {{34370224130UL, 4194689UL}, 0.96},
-     {{34370224130UL, 68723671169UL}, 0.96},
-     {{34370224130UL, 4194437UL}, 0.96},
-     {{34370224130UL, 4398050705537UL}, 0.96},
-     {{103089700864UL, 4535489659008UL}, 0.96},
-     {{103089700864UL, 13194143727744UL}, 0.96},
-     {{34370224129UL, 4398050705538UL}, 0.96},
-     {{34370224129UL, 13194143727744UL}, 0.96},
-     {{8830463246336UL, 4398050705792UL}, 0.96},
-     {{8830463246336UL, 4466770182272UL}, 0.96},
-     {{8830463246336UL, 4398050705537UL}, 0.96},
-     {{8830463246336UL, 21990236749952UL}, 0.96},
-     {{10486273UL, 20971904UL}, 0},
-     {{10486273UL, 4211072UL}, 0.96},
-     {{10486273UL, 272630144UL}, -0.96},
-     {{10486273UL, 4195712UL}, 0},
-     {{10486273UL, 34363933056UL}, -0.96},
-     {{10486273UL, 4194690UL}, -0.96},
-     {{10486273UL, 4398050705792UL}, 0},
-     {{10485763UL, 34363933056UL}, 0.96},
-     {{10485763UL, 4194692UL}, 0.96},
-     {{10485763UL, 4398050705792UL}, 0.96},
-     {{4398056996865UL, 34363933056UL}, -0.96},
-     {{4398056996865UL, 4194690UL}, 0.96},
-     {{4398056996865UL, 8796097216896UL}, 0.96},
-     {{10485763UL, 103083409536UL}, 0.96},
-     {{10485763UL, 34363932804UL}, 0.96},
-     {{10485763UL, 4432410443904UL}, 0.96},
-     {{4398056996865UL, 34363932802UL}, 0.96},
-     {{27262977UL, 4194438UL}, 0.96},
-     {{10502145UL, 4194438UL}, 0.96},
-     {{278921217UL, 4194438UL}, 0.96},
-     {{10486017UL, 4194438UL}, 0.96},
-     {{34370224129UL, 4194438UL}, 0.96},
-     {{10485765UL, 4194690UL}, -0.96},
-     {{10485765UL, 34363932802UL}, 0.96},
-     {{10485765UL, 4194442UL}, 0.96},
-     {{10485765UL, 4398050705538UL}, 0.96},
-     {{4398056996865UL, 4194438UL}, 0.96},
-     {{4398056996865UL, 8796097216642UL}, 0.96},
-     {{10485763UL, 4398050705540UL}, 0.96},
-     {{10485763UL, 13194143727744UL}, 0.96},
-     {{8796103507969UL, 4398050705792UL}, 0.96},
-     {{8796103507969UL, 4432410443904UL}, 0.96},
-     {{8796103507969UL, 4398050705538UL}, 0.96},
-     {{8796103507969UL, 21990236749952UL}, 0.96},
-     {{4398056997376UL, 20971904UL}, -0.96},
-     {{4398056997376UL, 4211072UL}, 0.96},
-     {{4398056997376UL, 272630144UL}, -0.96},
-     {{4398056997376UL, 4195712UL}, 0.96},
-     {{4398056997376UL, 34363933056UL}, -0.96},
-     {{4398056997376UL, 4194689UL}, 0.96},
-     {{4398056997376UL, 8796097216896UL}, 0.96},
-     {{13194150019072UL, 4194689UL}, 0.96},
-     {{13194150019072UL, 17592190239104UL}, 0.96},
-     {{4398056996866UL, 4194689UL}, 0.96},
-     {{4398056996866UL, 4194437UL}, 0.96},
-     {{4398056996866UL, 8796097216641UL}, 0.96},
-     {{13194150019072UL, 4194435UL}, 0.96},
-     {{13194150019072UL, 17592190238849UL}, 0.96},
-     {{4398073774080UL, 26388283261056UL}, 0.96},
-     {{4398057013248UL, 26388283261056UL}, 0.96},
-     {{4398056997120UL, 26388283261056UL}, 0.96},
-     {{4398056996865UL, 26388283261056UL}, 0.96},
-     {{21990243041280UL, 8796097216896UL}, 0.96},
-     {{21990243041280UL, 8796097216641UL}, 0.96},
-     {{21990243041280UL, 43980469305472UL}, 0.96},
-     {{94371840UL, 37748739UL}, 0.96},
-     {{94371840UL, 4398084259841UL}, 0.96},
-     {{27279360UL, 104857601UL}, 0.96},
-     {{27279360UL, 37781505UL}, 0.96},
-     {{27279360UL, 37748739UL}, 0.96},
-     {{27279360UL, 4398084259841UL}, 0.96},
-     {{295698432UL, 104857601UL}, 0.96},
-     {{295698432UL, 574619649UL}, 0.96},
-     {{295698432UL, 37748739UL}, 0.96},
-     {{27263104UL, 104857601UL}, 0.96},
-     {{27263104UL, 37748993UL}, 0.96},
-     {{27263104UL, 37748739UL}, 0.96},
-     {{27263104UL, 4398084259841UL}, 0.96},
-     {{34387001344UL, 104857601UL}, 0.96},
-     {{34387001344UL, 68757225473UL}, 0.96},
-     {{34387001344UL, 37748739UL}, 0.96},
-     {{27262978UL, 104857601UL}, 0.96},
-     {{27262978UL, 37748741UL}, 0.96},
-     {{27262978UL, 4398084259841UL}, 0.96},
-     {{4398073774080UL, 104857601UL}, 0.96},
-     {{4398073774080UL, 37748739UL}, 0.96},
-     {{4398073774080UL, 8796130770945UL}, 0.96},
-     {{60817408UL, 71303171UL}, 0.96},
-     {{27279360UL, 4227075UL}, 0.96},
-     {{27279360UL, 4398050705411UL}, 0.96},
-     {{295698432UL, 541065219UL}, 0.96},
-     {{295698432UL, 4398050705411UL}, 0.96},
-     {{27263104UL, 4194563UL}, 0.96},
-     {{27263104UL, 4398050705411UL}, 0.96},
-     {{34387001344UL, 68723671043UL}, 0.96},
-     {{34387001344UL, 4398050705411UL}, 0.96},
-     {{27262980UL, 37748739UL}, 0.96},
-     {{27262980UL, 4210691UL}, 0.96},
-     {{27262980UL, 272629763UL}, 0.96},
-     {{27262980UL, 4194435UL}, 0.96},
-     {{27262980UL, 34363932675UL}, 0.96},
-     {{27262980UL, 4194315UL}, 0.96},
-     {{27262980UL, 4398050705411UL}, 0.96},
-     {{4398073774080UL, 8796097216515UL}, 0.96},
-     {{60817408UL, 4398117814273UL}, 0.96},
-     {{27279360UL, 4398050738177UL}, 0.96},
-     {{27263104UL, 4398050705665UL}, 0.96},
-     {{27262978UL, 4398050705413UL}, 0.96},
-     {{27262978UL, 13194143727617UL}, 0.96},
-     {{27279360UL, 4292609UL}, 0.96},
-     {{10567680UL, 4358145UL}, 0.96},
-     {{10567680UL, 4227075UL}, 0.96},
-     {{10567680UL, 4398050738177UL}, 0.96},
-     {{10502146UL, 4292609UL}, 0.96},
-     {{10502146UL, 4227077UL}, 0.96},
-     {{10502146UL, 4398050738177UL}, 0.96},
-     {{4398057013248UL, 4292609UL}, 0.96},
-     {{4398057013248UL, 4227075UL}, 0.96},
-     {{4398057013248UL, 8796097249281UL}, 0.96},
-     {{10534912UL, 4259843UL}, 0.96},
-     {{10534912UL, 4398050705411UL}, 0.96},
-     {{10502148UL, 20971523UL}, 0.96},
-     {{10502148UL, 4227075UL}, 0.96},
-     {{10502148UL, 272629763UL}, 0.96},
-     {{10502148UL, 4194435UL}, 0.96},
-     {{10502148UL, 34363932675UL}, 0.96},
-     {{10502148UL, 4194315UL}, 0.96},
-     {{10502148UL, 4398050705411UL}, 0.96},
-     {{4398057013248UL, 8796097216515UL}, 0.96},
-     {{10534912UL, 4398050770945UL}, 0.96},
-     {{10534912UL, 13194143727617UL}, 0.96},
-     {{10502146UL, 4398050705413UL}, 0.96},
-     {{10502146UL, 13194143727617UL}, 0.96},
-     {{8796103524352UL, 4398050738177UL}, 0.96},
-     {{8796103524352UL, 4398050705411UL}, 0.96},
-     {{8796103524352UL, 21990236749825UL}, 0.96},
-     {{295698432UL, 1614807041UL}, 0.96},
-     {{1352663040UL, 2688548865UL}, 0.96},
-     {{1352663040UL, 541065219UL}, 0.96},
-     {{278921218UL, 1614807041UL}, 0.96},
-     {{278921218UL, 541065221UL}, 0.96},
-     {{815792128UL, 1077936131UL}, 0.96},
-     {{278921220UL, 20971523UL}, 0.96},
-     {{278921220UL, 4210691UL}, 0.96},
-     {{278921220UL, 541065219UL}, 0.96},
-     {{278921220UL, 4194435UL}, 0.96},
-     {{278921220UL, 34363932675UL}, 0.96},
-     {{278921220UL, 4194315UL}, 0.96},
-     {{278921220UL, 4398050705411UL}, 0.96},
-     {{27263104UL, 4195073UL}, 0.96},
-     {{10486400UL, 4195585UL}, 0.96},
-     {{10486400UL, 4194563UL}, 0.96},
-     {{10486400UL, 4398050705665UL}, 0.96},
-     {{34370224256UL, 4195073UL}, 0.96},
-     {{34370224256UL, 68723671297UL}, 0.96},
-     {{34370224256UL, 4194563UL}, 0.96},
-     {{34370224256UL, 4398050705665UL}, 0.96},
-     {{10485890UL, 4195073UL}, 0.96},
-     {{10485890UL, 4194565UL}, 0.96},
-     {{10485890UL, 4398050705665UL}, 0.96},
-     {{4398056996992UL, 4195073UL}, 0.96},
-     {{4398056996992UL, 4194563UL}, 0.96},
-     {{4398056996992UL, 8796097216769UL}, 0.96},
-     {{10486144UL, 4194819UL}, 0.96},
-     {{10486144UL, 4398050705411UL}, 0.96},
-     {{34370224256UL, 68723671043UL}, 0.96},
-     {{34370224256UL, 4398050705411UL}, 0.96},
-     {{10485892UL, 20971523UL}, 0},
-     {{10485892UL, 4210691UL}, 0.96},
-     {{10485892UL, 272629763UL}, 0.96},
-     {{10485892UL, 4194563UL}, 0.96},
-     {{10485892UL, 34363932675UL}, 0.96},
-     {{10485892UL, 4194315UL}, 0.96},
-     {{10485892UL, 4398050705411UL}, 0.96},
-     {{4398056996992UL, 8796097216515UL}, 0.96},
-     {{10486144UL, 4398050705921UL}, 0.96},
-     {{10486144UL, 13194143727617UL}, 0.96},
-     {{10485890UL, 4398050705413UL}, 0.96},
-     {{10485890UL, 13194143727617UL}, 0.96},
-     {{8796103508096UL, 4398050705665UL}, 0.96},
-     {{8796103508096UL, 4398050705411UL}, 0.96},
-     {{8796103508096UL, 21990236749825UL}, 0.96},
-     {{34387001344UL, 206162624513UL}, 0.96},
-     {{34370224256UL, 206162624513UL}, 0.96},
-     {{171809177600UL, 343601577985UL}, 0.96},
-     {{171809177600UL, 68723671043UL}, 0.96},
-     {{34370224130UL, 206162624513UL}, 0.96},
-     {{34370224130UL, 68723671045UL}, 0.96},
-     {{103089700864UL, 137443147779UL}, 0.96},
-     {{34370224132UL, 20971523UL}, 0.96},
-     {{34370224132UL, 4210691UL}, 0.96},
-     {{34370224132UL, 272629763UL}, 0.96},
-     {{34370224132UL, 4194435UL}, 0.96},
-     {{34370224132UL, 68723671043UL}, 0.96},
-     {{34370224132UL, 4194315UL}, 0.96},
-     {{34370224132UL, 4398050705411UL}, 0.96},
-     {{10485766UL, 54525953UL}, 0.96},
-     {{10485766UL, 20987905UL}, 0},
-     {{10485766UL, 289406977UL}, 0.96},
-     {{10485766UL, 20971649UL}, 0.96},
-     {{10485766UL, 34380709889UL}, 0},
-     {{10485766UL, 20971529UL}, 0.96},
-     {{10485766UL, 4398067482625UL}, 0},
-     {{10485766UL, 4243457UL}, 0.96},
-     {{10485766UL, 272646145UL}, 0.96},
-     {{10485766UL, 4210817UL}, 0.96},
-     {{10485766UL, 34363949057UL}, 0.96},
-     {{10485766UL, 4210697UL}, 0.96},
-     {{10485766UL, 4398050721793UL}, 0.96},
-     {{10485766UL, 809500673UL}, -0.96},
-     {{10485766UL, 272629889UL}, 0.96},
-     {{10485766UL, 34632368129UL}, 0.96},
-     {{10485766UL, 272629769UL}, 0.96},
-     {{10485766UL, 4398319140865UL}, 0.96},
-     {{10485766UL, 4194689UL}, 0.96},
-     {{10485766UL, 34363932801UL}, 0.96},
-     {{10485766UL, 4194441UL}, 0.96},
-     {{10485766UL, 4398050705537UL}, 0.96},
-     {{10485766UL, 103083409409UL}, 0.96},
-     {{10485766UL, 34363932681UL}, 0.96},
-     {{10485766UL, 4432410443777UL}, 0.96},
-     {{27262978UL, 4194317UL}, 0.96},
-     {{10502146UL, 4194317UL}, 0.96},
-     {{278921218UL, 4194317UL}, 0.96},
-     {{10485890UL, 4194317UL}, 0.96},
-     {{34370224130UL, 4194317UL}, 0.96},
-     {{10485770UL, 20971525UL}, 0},
-     {{10485770UL, 4210693UL}, 0.96},
-     {{10485770UL, 272629765UL}, 0},
-     {{10485770UL, 4194437UL}, 0.96},
-     {{10485770UL, 34363932677UL}, 0.96},
-     {{10485770UL, 4194325UL}, 0.96},
-     {{10485770UL, 4398050705413UL}, 0.96},
-     {{4398056996866UL, 4194317UL}, 0.96},
-     {{4398056996866UL, 8796097216517UL}, 0.96},
-     {{10485766UL, 4398050705417UL}, 0.96},
-     {{10485766UL, 13194143727617UL}, 0.96},
-     {{8796103507970UL, 4398067482625UL}, 0},
-     {{8796103507970UL, 4398050721793UL}, 0.96},
-     {{8796103507970UL, 4398050705537UL}, 0.96},
-     {{8796103507970UL, 4398050705413UL}, 0.96},
-     {{4398056996868UL, 20971523UL}, 0.96},
-     {{4398056996868UL, 4210691UL}, 0.96},
-     {{4398056996868UL, 272629763UL}, 0.96},
-     {{4398056996868UL, 4194435UL}, 0.96},
-     {{4398056996868UL, 34363932675UL}, 0.96},
-     {{4398056996868UL, 4194315UL}, 0.96},
-     {{4398056996868UL, 8796097216515UL}, 0.96},
-     {{13194150019072UL, 17592190238723UL}, 0.96},
-     {{4398073774080UL, 26388283260929UL}, 0.96},
-     {{4398057013248UL, 26388283260929UL}, 0.96},
-     {{4398056996992UL, 26388283260929UL}, 0.96},
-     {{4398056996866UL, 26388283260929UL}, 0.96},
-     {{21990243041280UL, 8796097216515UL}, 0.96},
-     {{21990243041280UL, 43980469305345UL}, 0.96},
-     {{85999616UL, 46170112UL}, 0.96},
-     {{85999616UL, 314572800UL}, -0.96},
-     {{85999616UL, 46137472UL}, -0.96},
-     {{85999616UL, 34405875712UL}, 0.96},
-     {{85999616UL, 46137345UL}, 0.96},
-     {{85999616UL, 4398092648448UL}, 0.96},
-     {{18923520UL, 113246208UL}, 0.96},
-     {{18923520UL, 46202880UL}, 0.96},
-     {{18923520UL, 314572800UL}, 0.96},
-     {{18923520UL, 46137472UL}, 0},
-     {{18923520UL, 34405875712UL}, 0.96},
-     {{18923520UL, 46137345UL}, 0.96},
-     {{18923520UL, 4398092648448UL}, 0.96},
-     {{34378629120UL, 314572800UL}, -0.96},
-     {{18890753UL, 46137472UL}, -0.96},
-     {{4398065401856UL, 113246208UL}, 0.96},
-     {{4398065401856UL, 46170112UL}, 0.96},
-     {{4398065401856UL, 314572800UL}, -0.96},
-     {{4398065401856UL, 46137472UL}, -0.96},
-     {{4398065401856UL, 34405875712UL}, 0.96},
-     {{4398065401856UL, 46137345UL}, 0.96},
-     {{4398065401856UL, 8796139159552UL}, 0.96},
-     {{52445184UL, 79724544UL}, 0.96},
-     {{52445184UL, 12681216UL}, 0.96},
-     {{52445184UL, 281051136UL}, -0.96},
-     {{52445184UL, 12615808UL}, -0.96},
-     {{52445184UL, 34372354048UL}, 0.96},
-     {{52445184UL, 12615681UL}, 0.96},
-     {{52445184UL, 4398059126784UL}, 0.96},
-     {{18956288UL, 46170112UL}, 0.96},
-     {{18956288UL, 12746752UL}, 0.96},
-     {{18956288UL, 281051136UL}, 0.96},
-     {{18956288UL, 12615808UL}, 0},
-     {{18956288UL, 34372354048UL}, 0.96},
-     {{18956288UL, 12615681UL}, 0.96},
-     {{18956288UL, 4398059126784UL}, 0.96},
-     {{34378629120UL, 281051136UL}, -0.96},
-     {{18890753UL, 12615808UL}, -0.96},
-     {{4398065401856UL, 12681216UL}, 0.96},
-     {{4398065401856UL, 281051136UL}, -0.96},
-     {{4398065401856UL, 12615808UL}, -0.96},
-     {{4398065401856UL, 34372354048UL}, 0.96},
-     {{4398065401856UL, 12615681UL}, 0.96},
-     {{4398065401856UL, 8796105637888UL}, 0.96},
-     {{52445184UL, 348127232UL}, -0.96},
-     {{52445184UL, 817889280UL}, -0.96},
-     {{52445184UL, 281018496UL}, -0.96},
-     {{52445184UL, 34640756736UL}, 0.96},
-     {{52445184UL, 281018369UL}, 0.96},
-     {{52445184UL, 4398327529472UL}, 0.96},
-     {{18923520UL, 281083904UL}, -0.96},
-     {{18923520UL, 817889280UL}, 0.96},
-     {{18923520UL, 281018496UL}, 0},
-     {{18923520UL, 34640756736UL}, 0.96},
-     {{18923520UL, 281018369UL}, 0.96},
-     {{18923520UL, 4398327529472UL}, 0.96},
-     {{555761664UL, 314572800UL}, -0.96},
-     {{555761664UL, 281051136UL}, 0},
-     {{555761664UL, 1354760192UL}, 0},
-     {{555761664UL, 281018496UL}, -0.96},
-     {{555761664UL, 34640756736UL}, 0.96},
-     {{555761664UL, 281018369UL}, -0.96},
-     {{555761664UL, 4398327529472UL}, 0.96},
-     {{18890880UL, 281018369UL}, -0.96},
-     {{34378629120UL, 817889280UL}, -0.96},
-     {{34378629120UL, 281018496UL}, -0.96},
-     {{34378629120UL, 69000495104UL}, -0.96},
-     {{34378629120UL, 281018369UL}, -0.96},
-     {{34378629120UL, 4398327529472UL}, -0.96},
-     {{18890753UL, 281018496UL}, -0.96},
-     {{4398065401856UL, 817889280UL}, -0.96},
-     {{4398065401856UL, 281018496UL}, -0.96},
-     {{4398065401856UL, 34640756736UL}, 0},
-     {{4398065401856UL, 281018369UL}, -0.96},
-     {{4398065401856UL, 8796374040576UL}, -0.96},
-     {{52445184UL, 79691904UL}, 0},
-     {{52445184UL, 12583296UL}, -0.96},
-     {{52445184UL, 34372321408UL}, -0.96},
-     {{52445184UL, 12583041UL}, 0.96},
-     {{52445184UL, 4398059094144UL}, 0},
-     {{18923520UL, 12648576UL}, -0.96},
-     {{18923520UL, 12583296UL}, 0.96},
-     {{18923520UL, 34372321408UL}, -0.96},
-     {{18923520UL, 12583041UL}, 0.96},
-     {{18923520UL, 4398059094144UL}, 0.96},
-     {{287326208UL, 34372321408UL}, -0.96},
-     {{18891008UL, 46137472UL}, -0.96},
-     {{18891008UL, 12615808UL}, 0},
-     {{18891008UL, 281018496UL}, -0.96},
-     {{18891008UL, 12583552UL}, 0.96},
-     {{18891008UL, 34372321408UL}, 0.96},
-     {{18891008UL, 12583041UL}, -0.96},
-     {{18891008UL, 4398059094144UL}, 0.96},
-     {{18890753UL, 12583296UL}, -0.96},
-     {{18890753UL, 34372321408UL}, 0.96},
-     {{18890753UL, 12583042UL}, 0.96},
-     {{18890753UL, 4398059094144UL}, 0.96},
-     {{4398065401856UL, 12583296UL}, -0.96},
-     {{4398065401856UL, 34372321408UL}, -0.96},
-     {{4398065401856UL, 12583041UL}, 0},
-     {{4398065401856UL, 8796105605248UL}, -0.96},
-     {{52445184UL, 34439430144UL}, 0.96},
-     {{52445184UL, 103091798016UL}, 0.96},
-     {{52445184UL, 34372321281UL}, 0.96},
-     {{52445184UL, 4432418832384UL}, 0.96},
-     {{18923520UL, 34372386816UL}, 0.96},
-     {{18923520UL, 103091798016UL}, 0.96},
-     {{18923520UL, 34372321281UL}, 0.96},
-     {{18923520UL, 4432418832384UL}, 0.96},
-     {{68738367488UL, 34405875712UL}, 0.96},
-     {{68738367488UL, 34372354048UL}, 0.96},
-     {{68738367488UL, 34640756736UL}, 0.96},
-     {{68738367488UL, 34372321408UL}, -0.96},
-     {{68738367488UL, 171811274752UL}, 0.96},
-     {{68738367488UL, 34372321281UL}, 0.96},
-     {{68738367488UL, 4432418832384UL}, 0.96},
-     {{4398065401856UL, 103091798016UL}, 0.96},
-     {{4398065401856UL, 34372321281UL}, -0.96},
-     {{4398065401856UL, 8830465343488UL}, 0.96},
-     {{52445184UL, 79691777UL}, 0.96},
-     {{52445184UL, 12582915UL}, 0.96},
-     {{52445184UL, 4398059094017UL}, 0.96},
-     {{18923520UL, 12648449UL}, 0.96},
-     {{18923520UL, 12582915UL}, 0.96},
-     {{18923520UL, 4398059094017UL}, 0.96},
-     {{18890754UL, 46137345UL}, 0.96},
-     {{18890754UL, 12615681UL}, 0.96},
-     {{18890754UL, 281018369UL}, -0.96},
-     {{18890754UL, 12583041UL}, -0.96},
-     {{18890754UL, 34372321281UL}, 0},
-     {{18890754UL, 12582917UL}, 0.96},
-     {{18890754UL, 4398059094017UL}, 0.96},
-     {{4398065401856UL, 12582915UL}, 0.96},
-     {{4398065401856UL, 8796105605121UL}, 0.96},
-     {{52445184UL, 4398126202880UL}, 0.96},
-     {{52445184UL, 13194152116224UL}, 0.96},
-     {{18923520UL, 4398059159552UL}, 0.96},
-     {{18923520UL, 13194152116224UL}, 0.96},
-     {{8796111912960UL, 4398092648448UL}, 0.96},
-     {{8796111912960UL, 4398059126784UL}, 0.96},
-     {{8796111912960UL, 4398327529472UL}, 0.96},
-     {{8796111912960UL, 4398059094144UL}, -0.96},
-     {{8796111912960UL, 4432418832384UL}, 0.96},
-     {{8796111912960UL, 4398059094017UL}, 0.96},
-     {{8796111912960UL, 21990245138432UL}, 0.96},
-     {{35700736UL, 96468992UL}, 0.96},
-     {{35700736UL, 29425664UL}, 0.96},
-     {{35700736UL, 297795584UL}, -0.96},
-     {{35700736UL, 29360256UL}, -0.96},
-     {{35700736UL, 34389098496UL}, 0.96},
-     {{35700736UL, 29360129UL}, 0.96},
-     {{35700736UL, 4398075871232UL}, 0.96},
-     {{18923520UL, 12779520UL}, 0.96},
-     {{2277376UL, 12910592UL}, 0.96},
-     {{2277376UL, 281083904UL}, -0.96},
-     {{2277376UL, 12648576UL}, -0.96},
-     {{2277376UL, 34372386816UL}, 0.96},
-     {{2277376UL, 12648449UL}, 0.96},
-     {{2277376UL, 4398059159552UL}, 0.96},
-     {{34361884672UL, 281083904UL}, -0.96},
-     {{2146305UL, 12648576UL}, -0.96},
-     {{4398048657408UL, 12779520UL}, 0.96},
-     {{4398048657408UL, 281083904UL}, -0.96},
-     {{4398048657408UL, 12648576UL}, -0.96},
-     {{4398048657408UL, 34372386816UL}, 0.96},
-     {{4398048657408UL, 12648449UL}, 0.96},
-     {{4398048657408UL, 8796105670656UL}, 0.96},
-     {{2211840UL, 281149440UL}, -0.96},
-     {{539017216UL, 281083904UL}, -0.96},
-     {{539017216UL, 1354760192UL}, 0.96},
-     {{539017216UL, 281018496UL}, 0},
-     {{539017216UL, 34640756736UL}, 0.96},
-     {{539017216UL, 281018369UL}, -0.96},
-     {{539017216UL, 4398327529472UL}, 0.96},
-     {{2146432UL, 281018369UL}, -0.96},
-     {{34361884672UL, 817889280UL}, -0.96},
-     {{34361884672UL, 281018496UL}, -0.96},
-     {{34361884672UL, 69000495104UL}, -0.96},
-     {{34361884672UL, 281018369UL}, -0.96},
-     {{34361884672UL, 4398327529472UL}, 0.96},
-     {{2146305UL, 281018496UL}, -0.96},
-     {{4398048657408UL, 817889280UL}, -0.96},
-     {{4398048657408UL, 281018496UL}, -0.96},
-     {{4398048657408UL, 34640756736UL}, -0.96},
-     {{4398048657408UL, 281018369UL}, -0.96},
-     {{4398048657408UL, 8796374040576UL}, -0.96},
-     {{2211840UL, 12714112UL}, -0.96},
-     {{270581760UL, 34372321408UL}, -0.96},
-     {{2146560UL, 12648576UL}, -0.96},
-     {{2146560UL, 281018496UL}, 0},
-     {{2146560UL, 12583552UL}, 0.96},
-     {{2146560UL, 34372321408UL}, -0.96},
-     {{2146560UL, 12583041UL}, 0},
-     {{2146560UL, 4398059094144UL}, 0.96},
-     {{2146305UL, 12583296UL}, -0.96},
-     {{2146305UL, 34372321408UL}, -0.96},
-     {{2146305UL, 12583042UL}, -0.96},
-     {{2146305UL, 4398059094144UL}, 0.96},
-     {{4398048657408UL, 12583296UL}, -0.96},
-     {{4398048657408UL, 34372321408UL}, -0.96},
-     {{4398048657408UL, 12583041UL}, 0},
-     {{4398048657408UL, 8796105605248UL}, -0.96},
-     {{2211840UL, 34372452352UL}, 0.96},
-     {{68721623040UL, 34372386816UL}, 0.96},
-     {{68721623040UL, 34640756736UL}, -0.96},
-     {{68721623040UL, 34372321408UL}, -0.96},
-     {{68721623040UL, 171811274752UL}, 0.96},
-     {{68721623040UL, 34372321281UL}, 0.96},
-     {{68721623040UL, 4432418832384UL}, 0.96},
-     {{4398048657408UL, 103091798016UL}, 0.96},
-     {{4398048657408UL, 34372321281UL}, -0.96},
-     {{4398048657408UL, 8830465343488UL}, 0.96},
-     {{2211840UL, 12713985UL}, 0.96},
-     {{2146306UL, 12648449UL}, 0.96},
-     {{2146306UL, 281018369UL}, -0.96},
-     {{2146306UL, 12583041UL}, -0.96},
-     {{2146306UL, 34372321281UL}, -0.96},
-     {{2146306UL, 12582917UL}, 0.96},
-     {{2146306UL, 4398059094017UL}, 0.96},
-     {{4398048657408UL, 12582915UL}, 0.96},
-     {{4398048657408UL, 8796105605121UL}, 0.96},
-     {{2211840UL, 4398059225088UL}, 0.96},
-     {{8796095168512UL, 4398059159552UL}, 0.96},
-     {{8796095168512UL, 4398327529472UL}, 0},
-     {{8796095168512UL, 4398059094144UL}, 0},
-     {{8796095168512UL, 4432418832384UL}, 0.96},
-     {{8796095168512UL, 4398059094017UL}, 0.96},
-     {{8796095168512UL, 21990245138432UL}, 0.96},
-     {{270549248UL, 34372321408UL}, -0.96},
-     {{270548993UL, 34372321408UL}, -0.96},
-     {{538984576UL, 281018369UL}, -0.96},
-     {{2113920UL, 281018369UL}, -0.96},
-     {{34361852032UL, 281018369UL}, -0.96},
-     {{4398048624768UL, 281018369UL}, -0.96},
-     {{2113666UL, 281018369UL}, -0.96},
-     {{34361917440UL, 281051136UL}, -0.96},
-     {{103081328640UL, 281051136UL}, -0.96},
-     {{4432408363008UL, 281051136UL}, -0.96},
-     {{34898722816UL, 281051136UL}, -0.96},
-     {{34898722816UL, 1354760192UL}, -0.96},
-     {{34898722816UL, 281018496UL}, -0.96},
-     {{34898722816UL, 69000495104UL}, -0.96},
-     {{34898722816UL, 281018369UL}, -0.96},
-     {{34898722816UL, 4398327529472UL}, -0.96},
-     {{103081328640UL, 817889280UL}, -0.96},
-     {{103081328640UL, 281018496UL}, -0.96},
-     {{103081328640UL, 137719971840UL}, -0.96},
-     {{103081328640UL, 281018369UL}, -0.96},
-     {{103081328640UL, 4398327529472UL}, -0.96},
-     {{34361851905UL, 281018496UL}, -0.96},
-     {{4432408363008UL, 817889280UL}, -0.96},
-     {{4432408363008UL, 281018496UL}, -0.96},
-     {{4432408363008UL, 69000495104UL}, -0.96},
-     {{4432408363008UL, 281018369UL}, -0.96},
-     {{4432408363008UL, 8796374040576UL}, -0.96},
-     {{34361852160UL, 281018496UL}, -0.96},
-     {{171800805376UL, 69000495104UL}, -0.96},
-     {{34361851906UL, 281018369UL}, -0.96},
-     {{8830454874112UL, 4398327529472UL}, -0.96},
-     {{2179073UL, 12615808UL}, -0.96},
-     {{2113539UL, 12615808UL}, -0.96},
-     {{4398048624641UL, 12615808UL}, -0.96},
-     {{538984449UL, 281018496UL}, -0.96},
-     {{2113539UL, 281018496UL}, -0.96},
-     {{4398048624641UL, 281018496UL}, -0.96},
-     {{2113793UL, 12615808UL}, -0.96},
-     {{2113793UL, 281018496UL}, -0.96},
-     {{2113793UL, 12583552UL}, 0.96},
-     {{2113793UL, 34372321408UL}, 0.96},
-     {{2113793UL, 12583042UL}, 0.96},
-     {{2113793UL, 4398059094144UL}, 0.96},
-     {{2113539UL, 12583296UL}, -0.96},
-     {{2113539UL, 34372321408UL}, -0.96},
-     {{2113539UL, 12583044UL}, -0.96},
-     {{2113539UL, 4398059094144UL}, -0.96},
-     {{4398048624641UL, 12583296UL}, -0.96},
-     {{4398048624641UL, 34372321408UL}, -0.96},
-     {{4398048624641UL, 12583042UL}, -0.96},
-     {{4398048624641UL, 8796105605248UL}, -0.96},
-     {{68721590273UL, 34372321408UL}, -0.96},
-     {{2113541UL, 12583042UL}, -0.96},
-     {{8796095135745UL, 4398059094144UL}, -0.96},
-     {{4398082179072UL, 96468992UL}, 0.96},
-     {{4398082179072UL, 29392896UL}, 0.96},
-     {{4398082179072UL, 297795584UL}, -0.96},
-     {{4398082179072UL, 29360256UL}, -0.96},
-     {{4398082179072UL, 34389098496UL}, 0.96},
-     {{4398082179072UL, 29360129UL}, 0.96},
-     {{4398082179072UL, 8796122382336UL}, 0.96},
-     {{4398048690176UL, 12746752UL}, 0.96},
-     {{4398048690176UL, 281051136UL}, -0.96},
-     {{4398048690176UL, 12615808UL}, -0.96},
-     {{4398048690176UL, 34372354048UL}, 0.96},
-     {{4398048690176UL, 12615681UL}, 0.96},
-     {{4398048690176UL, 8796105637888UL}, 0.96},
-     {{13194141646848UL, 12681216UL}, 0.96},
-     {{13194141646848UL, 281051136UL}, -0.96},
-     {{13194141646848UL, 12615808UL}, -0.96},
-     {{13194141646848UL, 34372354048UL}, 0.96},
-     {{13194141646848UL, 12615681UL}, 0.96},
-     {{13194141646848UL, 17592198660096UL}, 0.96},
-     {{4398585495552UL, 281051136UL}, -0.96},
-     {{4398585495552UL, 1354760192UL}, -0.96},
-     {{4398585495552UL, 281018496UL}, -0.96},
-     {{4398585495552UL, 34640756736UL}, -0.96},
-     {{4398585495552UL, 281018369UL}, -0.96},
-     {{4398585495552UL, 8796374040576UL}, -0.96},
-     {{13194141646848UL, 817889280UL}, -0.96},
-     {{13194141646848UL, 281018496UL}, -0.96},
-     {{13194141646848UL, 34640756736UL}, -0.96},
-     {{13194141646848UL, 281018369UL}, -0.96},
-     {{13194141646848UL, 17592467062784UL}, -0.96},
-     {{4398048624896UL, 12615808UL}, -0.96},
-     {{4398048624896UL, 281018496UL}, -0.96},
-     {{4398048624896UL, 12583552UL}, -0.96},
-     {{4398048624896UL, 34372321408UL}, -0.96},
-     {{4398048624896UL, 12583041UL}, -0.96},
-     {{4398048624896UL, 8796105605248UL}, -0.96},
-     {{13194141646848UL, 12583296UL}, -0.96},
-     {{13194141646848UL, 34372321408UL}, -0.96},
-     {{13194141646848UL, 12583041UL}, -0.96},
-     {{13194141646848UL, 17592198627456UL}, -0.96},
-     {{4466768101376UL, 34372354048UL}, 0.96},
-     {{4466768101376UL, 34640756736UL}, 0},
-     {{4466768101376UL, 34372321408UL}, -0.96},
-     {{4466768101376UL, 171811274752UL}, 0.96},
-     {{4466768101376UL, 34372321281UL}, -0.96},
-     {{4466768101376UL, 8830465343488UL}, 0.96},
-     {{13194141646848UL, 103091798016UL}, 0.96},
-     {{13194141646848UL, 34372321281UL}, -0.96},
-     {{13194141646848UL, 17626558365696UL}, 0.96},
-     {{4398048624642UL, 12615681UL}, 0.96},
-     {{4398048624642UL, 281018369UL}, -0.96},
-     {{4398048624642UL, 12583041UL}, -0.96},
-     {{4398048624642UL, 34372321281UL}, -0.96},
-     {{4398048624642UL, 12582917UL}, 0.96},
-     {{4398048624642UL, 8796105605121UL}, 0.96},
-     {{13194141646848UL, 12582915UL}, 0.96},
-     {{13194141646848UL, 17592198627329UL}, 0.96},
-     {{4398065401856UL, 26388291649536UL}, 0.96},
-     {{4398048657408UL, 26388291649536UL}, 0.96},
-     {{21990234669056UL, 8796105637888UL}, 0.96},
-     {{21990234669056UL, 8796374040576UL}, -0.96},
-     {{21990234669056UL, 8796105605248UL}, -0.96},
-     {{21990234669056UL, 8830465343488UL}, 0.96},
-     {{21990234669056UL, 8796105605121UL}, 0.96},
-     {{21990234669056UL, 43980477693952UL}, 0.96},
-     {{27279360UL, 37847040UL}, 0.96},
-     {{10633216UL, 21069824UL}, 0.96},
-     {{10633216UL, 4554752UL}, 0.96},
-     {{10633216UL, 272728064UL}, 0.96},
-     {{10633216UL, 4292736UL}, 0.96},
-     {{10633216UL, 34364030976UL}, 0.96},
-     {{10633216UL, 4292609UL}, 0.96},
-     {{10633216UL, 4398050803712UL}, 0.96},
-     {{4398057013248UL, 8796097314816UL}, 0.96},
-     {{2310144UL, 12877824UL}, 0.96},
-     {{2310144UL, 281051136UL}, 0.96},
-     {{2310144UL, 12615808UL}, -0.96},
-     {{2310144UL, 34372354048UL}, 0.96},
-     {{2310144UL, 12615681UL}, 0.96},
-     {{2310144UL, 4398059126784UL}, 0.96},
-     {{10567680UL, 4620288UL}, 0.96},
-     {{2441216UL, 12746752UL}, 0.96},
-     {{2441216UL, 4882432UL}, 0.96},
-     {{2441216UL, 272793600UL}, 0.96},
-     {{2441216UL, 4358272UL}, 0},
-     {{2441216UL, 34364096512UL}, 0.96},
-     {{2441216UL, 4358145UL}, 0.96},
-     {{2441216UL, 4398050869248UL}, 0.96},
-     {{34361917440UL, 272793600UL}, -0.96},
-     {{2179073UL, 4358272UL}, -0.96},
-     {{4398048690176UL, 4620288UL}, 0.96},
-     {{4398048690176UL, 272793600UL}, -0.96},
-     {{4398048690176UL, 4358272UL}, -0.96},
-     {{4398048690176UL, 34364096512UL}, 0.96},
-     {{4398048690176UL, 4358145UL}, 0.96},
-     {{4398048690176UL, 8796097380352UL}, 0.96},
-     {{2310144UL, 272924672UL}, 0.96},
-     {{2310144UL, 809533440UL}, 0.96},
-     {{2310144UL, 272662656UL}, 0.96},
-     {{2310144UL, 34632400896UL}, 0.96},
-     {{2310144UL, 272662529UL}, 0},
-     {{2310144UL, 4398319173632UL}, 0.96},
-     {{539049984UL, 281051136UL}, 0},
-     {{539049984UL, 272793600UL}, 0.96},
-     {{539049984UL, 1346404352UL}, 0.96},
-     {{539049984UL, 272662656UL}, 0.96},
-     {{539049984UL, 34632400896UL}, 0.96},
-     {{539049984UL, 272662529UL}, 0.96},
-     {{539049984UL, 4398319173632UL}, 0.96},
-     {{2179200UL, 272662529UL}, 0.96},
-     {{34361917440UL, 272662656UL}, -0.96},
-     {{34361917440UL, 272662529UL}, -0.96},
-     {{34361917440UL, 4398319173632UL}, 0.96},
-     {{2179073UL, 272662656UL}, 0.96},
-     {{4398048690176UL, 809533440UL}, -0.96},
-     {{4398048690176UL, 272662656UL}, 0.96},
-     {{4398048690176UL, 34632400896UL}, 0.96},
-     {{4398048690176UL, 272662529UL}, -0.96},
-     {{4398048690176UL, 8796365684736UL}, 0.96},
-     {{2310144UL, 4489344UL}, 0.96},
-     {{2310144UL, 4227456UL}, -0.96},
-     {{2310144UL, 34363965568UL}, 0.96},
-     {{2310144UL, 4227201UL}, 0.96},
-     {{2310144UL, 4398050738304UL}, 0.96},
-     {{270614528UL, 34363965568UL}, -0.96},
-     {{2179328UL, 12615808UL}, 0},
-     {{2179328UL, 4358272UL}, 0.96},
-     {{2179328UL, 272662656UL}, 0.96},
-     {{2179328UL, 4227712UL}, 0.96},
-     {{2179328UL, 34363965568UL}, 0.96},
-     {{2179328UL, 4227201UL}, 0.96},
-     {{2179328UL, 4398050738304UL}, 0.96},
-     {{2179073UL, 34363965568UL}, 0},
-     {{2179073UL, 4398050738304UL}, 0.96},
-     {{4398048690176UL, 4227456UL}, -0.96},
-     {{4398048690176UL, 34363965568UL}, -0.96},
-     {{4398048690176UL, 4227201UL}, -0.96},
-     {{4398048690176UL, 8796097249408UL}, 0.96},
-     {{2310144UL, 34364227584UL}, 0.96},
-     {{2310144UL, 103083442176UL}, 0.96},
-     {{2310144UL, 34363965441UL}, 0.96},
-     {{2310144UL, 4432410476544UL}, 0.96},
-     {{68721655808UL, 34372354048UL}, 0.96},
-     {{68721655808UL, 34364096512UL}, 0.96},
-     {{68721655808UL, 34632400896UL}, 0.96},
-     {{68721655808UL, 34363965568UL}, 0.96},
-     {{68721655808UL, 171802918912UL}, 0.96},
-     {{68721655808UL, 34363965441UL}, 0.96},
-     {{68721655808UL, 4432410476544UL}, 0.96},
-     {{4398048690176UL, 103083442176UL}, 0.96},
-     {{4398048690176UL, 34363965441UL}, 0},
-     {{4398048690176UL, 8830456987648UL}, 0.96},
-     {{2310144UL, 4489217UL}, 0.96},
-     {{2310144UL, 4227075UL}, 0.96},
-     {{2310144UL, 4398050738177UL}, 0.96},
-     {{2179074UL, 12615681UL}, 0.96},
-     {{2179074UL, 4358145UL}, 0.96},
-     {{2179074UL, 272662529UL}, -0.96},
-     {{2179074UL, 4227201UL}, 0.96},
-     {{2179074UL, 34363965441UL}, 0.96},
-     {{2179074UL, 4227077UL}, 0.96},
-     {{2179074UL, 4398050738177UL}, 0.96},
-     {{4398048690176UL, 4227075UL}, 0.96},
-     {{4398048690176UL, 8796097249281UL}, 0.96},
-     {{2310144UL, 4398051000320UL}, 0.96},
-     {{2310144UL, 13194143760384UL}, 0.96},
-     {{8796095201280UL, 4398059126784UL}, 0.96},
-     {{8796095201280UL, 4398050869248UL}, 0.96},
-     {{8796095201280UL, 4398319173632UL}, 0.96},
-     {{8796095201280UL, 4398050738304UL}, 0.96},
-     {{8796095201280UL, 4432410476544UL}, 0.96},
-     {{8796095201280UL, 4398050738177UL}, 0.96},
-     {{8796095201280UL, 21990236782592UL}, 0.96},
-     {{807419904UL, 34363965568UL}, 0.96},
-     {{270549248UL, 34363965568UL}, -0.96},
-     {{270548993UL, 34363965568UL}, -0.96},
-     {{4398317060096UL, 34363965568UL}, -0.96},
-     {{68990025728UL, 34363965568UL}, -0.96},
-     {{538984576UL, 272662529UL}, 0},
-     {{2113920UL, 272662529UL}, 0.96},
-     {{34361852032UL, 272662529UL}, -0.96},
-     {{4398048624768UL, 272662529UL}, -0.96},
-     {{2113666UL, 272662529UL}, -0.96},
-     {{34361982976UL, 272728064UL}, -0.96},
-     {{103081328640UL, 272728064UL}, -0.96},
-     {{4432408363008UL, 272728064UL}, -0.96},
-     {{34898722816UL, 272728064UL}, -0.96},
-     {{34898722816UL, 1346404352UL}, -0.96},
-     {{34898722816UL, 272662656UL}, 0.96},
-     {{34898722816UL, 68992139264UL}, 0.96},
-     {{34898722816UL, 272662529UL}, 0},
-     {{34898722816UL, 4398319173632UL}, 0.96},
-     {{103081328640UL, 809533440UL}, -0.96},
-     {{103081328640UL, 272662656UL}, -0.96},
-     {{103081328640UL, 137711616000UL}, -0.96},
-     {{103081328640UL, 272662529UL}, 0.96},
-     {{103081328640UL, 4398319173632UL}, 0.96},
-     {{34361851905UL, 272662656UL}, -0.96},
-     {{4432408363008UL, 272662656UL}, -0.96},
-     {{4432408363008UL, 272662529UL}, -0.96},
-     {{4432408363008UL, 8796365684736UL}, -0.96},
-     {{34361852160UL, 272662656UL}, -0.96},
-     {{34361851906UL, 272662529UL}, -0.96},
-     {{8830454874112UL, 4398319173632UL}, -0.96},
-     {{2113539UL, 4292736UL}, -0.96},
-     {{4398048624641UL, 4292736UL}, -0.96},
-     {{538984449UL, 272662656UL}, 0.96},
-     {{2113539UL, 272662656UL}, -0.96},
-     {{4398048624641UL, 272662656UL}, -0.96},
-     {{2113793UL, 4292736UL}, -0.96},
-     {{2113793UL, 272662656UL}, 0.96},
-     {{2113793UL, 4227712UL}, -0.96},
-     {{2113793UL, 34363965568UL}, 0},
-     {{2113793UL, 4227202UL}, 0.96},
-     {{2113793UL, 4398050738304UL}, 0.96},
-     {{2113539UL, 4227456UL}, -0.96},
-     {{2113539UL, 34363965568UL}, -0.96},
-     {{2113539UL, 4227204UL}, -0.96},
-     {{2113539UL, 4398050738304UL}, -0.96},
-     {{4398048624641UL, 34363965568UL}, -0.96},
-     {{4398048624641UL, 8796097249408UL}, -0.96},
-     {{68721590273UL, 34363965568UL}, -0.96},
-     {{8796095135745UL, 4398050738304UL}, -0.96},
-     {{4398048755712UL, 12681216UL}, 0.96},
-     {{4398048755712UL, 4554752UL}, 0.96},
-     {{4398048755712UL, 272728064UL}, -0.96},
-     {{4398048755712UL, 4292736UL}, -0.96},
-     {{4398048755712UL, 34364030976UL}, 0.96},
-     {{4398048755712UL, 4292609UL}, 0.96},
-     {{4398048755712UL, 8796097314816UL}, 0.96},
-     {{13194141646848UL, 272728064UL}, -0.96},
-     {{13194141646848UL, 4292736UL}, -0.96},
-     {{13194141646848UL, 34364030976UL}, 0.96},
-     {{13194141646848UL, 4292609UL}, 0.96},
-     {{13194141646848UL, 17592190337024UL}, 0.96},
-     {{4398585495552UL, 272728064UL}, -0.96},
-     {{4398585495552UL, 1346404352UL}, -0.96},
-     {{4398585495552UL, 272662656UL}, 0.96},
-     {{4398585495552UL, 34632400896UL}, 0.96},
-     {{4398585495552UL, 272662529UL}, -0.96},
-     {{4398585495552UL, 8796365684736UL}, 0.96},
-     {{13194141646848UL, 809533440UL}, -0.96},
-     {{13194141646848UL, 272662656UL}, -0.96},
-     {{13194141646848UL, 34632400896UL}, -0.96},
-     {{13194141646848UL, 272662529UL}, -0.96},
-     {{13194141646848UL, 17592458706944UL}, -0.96},
-     {{4398048624896UL, 4292736UL}, -0.96},
-     {{4398048624896UL, 272662656UL}, -0.96},
-     {{4398048624896UL, 4227712UL}, -0.96},
-     {{4398048624896UL, 34363965568UL}, -0.96},
-     {{4398048624896UL, 4227201UL}, 0},
-     {{4398048624896UL, 8796097249408UL}, 0.96},
-     {{13194141646848UL, 4227456UL}, -0.96},
-     {{13194141646848UL, 34363965568UL}, -0.96},
-     {{13194141646848UL, 4227201UL}, -0.96},
-     {{13194141646848UL, 17592190271616UL}, -0.96},
-     {{4466768101376UL, 34364030976UL}, 0.96},
-     {{4466768101376UL, 34632400896UL}, 0.96},
-     {{4466768101376UL, 34363965568UL}, -0.96},
-     {{4466768101376UL, 171802918912UL}, 0.96},
-     {{4466768101376UL, 34363965441UL}, 0.96},
-     {{4466768101376UL, 8830456987648UL}, 0.96},
-     {{13194141646848UL, 103083442176UL}, 0.96},
-     {{13194141646848UL, 34363965441UL}, -0.96},
-     {{13194141646848UL, 17626550009856UL}, 0.96},
-     {{4398048624642UL, 4292609UL}, 0.96},
-     {{4398048624642UL, 272662529UL}, -0.96},
-     {{4398048624642UL, 4227201UL}, -0.96},
-     {{4398048624642UL, 34363965441UL}, -0.96},
-     {{4398048624642UL, 4227077UL}, 0.96},
-     {{4398048624642UL, 8796097249281UL}, 0.96},
-     {{13194141646848UL, 4227075UL}, 0.96},
-     {{13194141646848UL, 17592190271489UL}, 0.96},
-     {{4398057013248UL, 26388283293696UL}, 0.96},
-     {{4398048690176UL, 26388283293696UL}, 0.96},
-     {{21990234669056UL, 8796097314816UL}, 0.96},
-     {{21990234669056UL, 8796365684736UL}, -0.96},
-     {{21990234669056UL, 8796097249408UL}, -0.96},
-     {{21990234669056UL, 8830456987648UL}, 0.96},
-     {{21990234669056UL, 8796097249281UL}, 0.96},
-     {{21990234669056UL, 43980469338112UL}, 0.96},
-     {{10534912UL, 272826368UL}, -0.96},
-     {{2277376UL, 272957440UL}, -0.96},
-     {{2277376UL, 809566208UL}, -0.96},
-     {{2277376UL, 272695424UL}, -0.96},
-     {{2277376UL, 34632433664UL}, -0.96},
-     {{2277376UL, 272695297UL}, -0.96},
-     {{2277376UL, 4398319206400UL}, -0.96},
-     {{539017216UL, 272826368UL}, -0.96},
-     {{539017216UL, 1346437120UL}, -0.96},
-     {{539017216UL, 272695424UL}, -0.96},
-     {{539017216UL, 34632433664UL}, -0.96},
-     {{539017216UL, 272695297UL}, 0.96},
-     {{539017216UL, 4398319206400UL}, 0.96},
-     {{2146432UL, 272695297UL}, -0.96},
-     {{34361884672UL, 272826368UL}, -0.96},
-     {{34361884672UL, 809566208UL}, -0.96},
-     {{34361884672UL, 272695424UL}, -0.96},
-     {{34361884672UL, 68992172032UL}, -0.96},
-     {{34361884672UL, 272695297UL}, -0.96},
-     {{34361884672UL, 4398319206400UL}, -0.96},
-     {{2146305UL, 272695424UL}, -0.96},
-     {{4398048657408UL, 272826368UL}, -0.96},
-     {{4398048657408UL, 809566208UL}, -0.96},
-     {{4398048657408UL, 272695424UL}, -0.96},
-     {{4398048657408UL, 34632433664UL}, -0.96},
-     {{4398048657408UL, 272695297UL}, -0.96},
-     {{4398048657408UL, 8796365717504UL}, -0.96},
-     {{2211840UL, 809631744UL}, 0.96},
-     {{1075888128UL, 817889280UL}, -0.96},
-     {{1075888128UL, 809566208UL}, -0.96},
-     {{1075888128UL, 2956984320UL}, 0.96},
-     {{1075888128UL, 809500800UL}, 0.96},
-     {{1075888128UL, 35169239040UL}, 0.96},
-     {{1075888128UL, 809500673UL}, 0.96},
-     {{1075888128UL, 4398856011776UL}, 0.96},
-     {{2146432UL, 809500673UL}, 0.96},
-     {{34361884672UL, 809500800UL}, 0.96},
-     {{34361884672UL, 69528977408UL}, 0.96},
-     {{34361884672UL, 809500673UL}, 0.96},
-     {{34361884672UL, 4398856011776UL}, 0.96},
-     {{2146305UL, 809500800UL}, 0.96},
-     {{4398048657408UL, 809500800UL}, 0.96},
-     {{4398048657408UL, 35169239040UL}, 0.96},
-     {{4398048657408UL, 809500673UL}, 0.96},
-     {{4398048657408UL, 8796902522880UL}, 0.96},
-     {{2211840UL, 272760960UL}, 0.96},
-     {{539017216UL, 1346371712UL}, 0.96},
-     {{539017216UL, 272630144UL}, 0.96},
-     {{539017216UL, 34632368256UL}, 0.96},
-     {{539017216UL, 272629889UL}, 0.96},
-     {{539017216UL, 4398319140992UL}, 0.96},
-     {{2146560UL, 272695424UL}, -0.96},
-     {{2146560UL, 809500800UL}, 0.96},
-     {{2146560UL, 272630400UL}, 0.96},
-     {{2146560UL, 34632368256UL}, 0.96},
-     {{2146560UL, 272629889UL}, 0.96},
-     {{2146560UL, 4398319140992UL}, 0.96},
-     {{34361884672UL, 272630144UL}, 0.96},
-     {{34361884672UL, 68992106624UL}, 0.96},
-     {{34361884672UL, 272629889UL}, 0.96},
-     {{34361884672UL, 4398319140992UL}, 0.96},
-     {{2146305UL, 272630144UL}, 0},
-     {{2146305UL, 34632368256UL}, 0.96},
-     {{2146305UL, 272629890UL}, 0.96},
-     {{2146305UL, 4398319140992UL}, 0.96},
-     {{4398048657408UL, 272630144UL}, 0.96},
-     {{4398048657408UL, 34632368256UL}, 0.96},
-     {{4398048657408UL, 272629889UL}, 0.96},
-     {{4398048657408UL, 8796365652096UL}, 0.96},
-     {{2211840UL, 34632499200UL}, 0.96},
-     {{539017216UL, 35706109952UL}, 0.96},
-     {{539017216UL, 103351844864UL}, 0.96},
-     {{539017216UL, 34632368129UL}, 0.96},
-     {{539017216UL, 4432678879232UL}, 0.96},
-     {{2146432UL, 34632368129UL}, 0.96},
-     {{68721623040UL, 34632433664UL}, 0.96},
-     {{68721623040UL, 35169239040UL}, 0.96},
-     {{68721623040UL, 34632368256UL}, 0.96},
-     {{68721623040UL, 172071321600UL}, 0.96},
-     {{68721623040UL, 34632368129UL}, 0.96},
-     {{68721623040UL, 4432678879232UL}, 0.96},
-     {{4398048657408UL, 103351844864UL}, 0.96},
-     {{4398048657408UL, 34632368129UL}, 0.96},
-     {{4398048657408UL, 8830725390336UL}, 0.96},
-     {{2211840UL, 272760833UL}, 0.96},
-     {{539017216UL, 1346371585UL}, 0.96},
-     {{539017216UL, 272629763UL}, 0.96},
-     {{539017216UL, 4398319140865UL}, 0.96},
-     {{2146432UL, 272630017UL}, 0.96},
-     {{2146432UL, 272629763UL}, 0.96},
-     {{2146432UL, 4398319140865UL}, 0.96},
-     {{34361884672UL, 68992106497UL}, 0.96},
-     {{34361884672UL, 272629763UL}, 0.96},
-     {{34361884672UL, 4398319140865UL}, 0.96},
-     {{2146306UL, 272695297UL}, -0.96},
-     {{2146306UL, 809500673UL}, 0.96},
-     {{2146306UL, 272629889UL}, 0.96},
-     {{2146306UL, 34632368129UL}, 0.96},
-     {{2146306UL, 272629765UL}, 0.96},
-     {{2146306UL, 4398319140865UL}, 0.96},
-     {{4398048657408UL, 272629763UL}, 0.96},
-     {{4398048657408UL, 8796365651969UL}, 0.96},
-     {{2211840UL, 4398319271936UL}, 0.96},
-     {{539017216UL, 4399392882688UL}, 0.96},
-     {{539017216UL, 13194412163072UL}, 0.96},
-     {{34361884672UL, 4467038617600UL}, 0},
-     {{34361884672UL, 13194412163072UL}, 0.96},
-     {{8796095168512UL, 4398319206400UL}, -0.96},
-     {{8796095168512UL, 4398856011776UL}, 0.96},
-     {{8796095168512UL, 4398319140992UL}, 0.96},
-     {{8796095168512UL, 4432678879232UL}, 0.96},
-     {{8796095168512UL, 4398319140865UL}, 0.96},
-     {{8796095168512UL, 21990505185280UL}, 0.96},
-     {{1612726272UL, 281051136UL}, -0.96},
-     {{1612726272UL, 2428502016UL}, -0.96},
-     {{1612726272UL, 281018496UL}, -0.96},
-     {{1612726272UL, 34640756736UL}, 0.96},
-     {{1612726272UL, 281018369UL}, -0.96},
-     {{1612726272UL, 4398327529472UL}, 0.96},
-     {{1612726272UL, 272728064UL}, 0.96},
-     {{1612726272UL, 2420146176UL}, 0.96},
-     {{1612726272UL, 272662656UL}, 0.96},
-     {{1612726272UL, 34632400896UL}, 0.96},
-     {{1612726272UL, 272662529UL}, 0.96},
-     {{1612726272UL, 4398319173632UL}, 0.96},
-     {{539017216UL, 3493855232UL}, 0},
-     {{2686468096UL, 1354760192UL}, 0},
-     {{2686468096UL, 1346404352UL}, 0},
-     {{2686468096UL, 5641338880UL}, 0.96},
-     {{2686468096UL, 1346371712UL}, -0.96},
-     {{2686468096UL, 35706109952UL}, 0.96},
-     {{2686468096UL, 1346371585UL}, 0},
-     {{2686468096UL, 4399392882688UL}, 0.96},
-     {{538984576UL, 1346371585UL}, -0.96},
-     {{34898722816UL, 3493855232UL}, -0.96},
-     {{34898722816UL, 1346371712UL}, -0.96},
-     {{34898722816UL, 70065848320UL}, -0.96},
-     {{34898722816UL, 1346371585UL}, -0.96},
-     {{34898722816UL, 4399392882688UL}, 0},
-     {{538984449UL, 1346371712UL}, -0.96},
-     {{4398585495552UL, 3493855232UL}, -0.96},
-     {{4398585495552UL, 1346371712UL}, -0.96},
-     {{4398585495552UL, 35706109952UL}, 0},
-     {{4398585495552UL, 1346371585UL}, -0.96},
-     {{4398585495552UL, 8797439393792UL}, -0.96},
-     {{1612726272UL, 2420113536UL}, 0.96},
-     {{1612726272UL, 272630144UL}, 0},
-     {{1612726272UL, 34632368256UL}, 0.96},
-     {{1612726272UL, 272629889UL}, 0.96},
-     {{1612726272UL, 4398319140992UL}, 0.96},
-     {{538984704UL, 281018496UL}, -0.96},
-     {{538984704UL, 272662656UL}, 0.96},
-     {{538984704UL, 1346371712UL}, -0.96},
-     {{538984704UL, 272630400UL}, 0},
-     {{538984704UL, 34632368256UL}, 0.96},
-     {{538984704UL, 272629889UL}, 0.96},
-     {{538984704UL, 4398319140992UL}, 0.96},
-     {{34898722816UL, 272630144UL}, -0.96},
-     {{34898722816UL, 68992106624UL}, 0.96},
-     {{34898722816UL, 272629889UL}, 0.96},
-     {{34898722816UL, 4398319140992UL}, 0.96},
-     {{538984449UL, 272630144UL}, 0},
-     {{538984449UL, 34632368256UL}, 0.96},
-     {{538984449UL, 272629890UL}, 0},
-     {{538984449UL, 4398319140992UL}, 0.96},
-     {{4398585495552UL, 272630144UL}, -0.96},
-     {{4398585495552UL, 34632368256UL}, 0},
-     {{4398585495552UL, 272629889UL}, 0.96},
-     {{4398585495552UL, 8796365652096UL}, 0.96},
-     {{1612726272UL, 36779851776UL}, 0.96},
-     {{1612726272UL, 103351844864UL}, 0.96},
-     {{1612726272UL, 34632368129UL}, 0.96},
-     {{1612726272UL, 4432678879232UL}, 0.96},
-     {{538984576UL, 34632368129UL}, 0.96},
-     {{69258461184UL, 34640756736UL}, -0.96},
-     {{69258461184UL, 34632400896UL}, 0.96},
-     {{69258461184UL, 35706109952UL}, -0.96},
-     {{69258461184UL, 34632368256UL}, 0.96},
-     {{69258461184UL, 172071321600UL}, -0.96},
-     {{69258461184UL, 34632368129UL}, 0.96},
-     {{69258461184UL, 4432678879232UL}, 0.96},
-     {{4398585495552UL, 103351844864UL}, 0.96},
-     {{4398585495552UL, 34632368129UL}, 0.96},
-     {{4398585495552UL, 8830725390336UL}, 0.96},
-     {{1612726272UL, 2420113409UL}, 0.96},
-     {{1612726272UL, 272629763UL}, 0.96},
-     {{1612726272UL, 4398319140865UL}, 0.96},
-     {{538984576UL, 272630017UL}, -0.96},
-     {{538984576UL, 272629763UL}, 0.96},
-     {{538984576UL, 4398319140865UL}, 0.96},
-     {{34898722816UL, 68992106497UL}, 0.96},
-     {{34898722816UL, 272629763UL}, 0.96},
-     {{34898722816UL, 4398319140865UL}, 0.96},
-     {{538984450UL, 281018369UL}, -0.96},
-     {{538984450UL, 272662529UL}, 0.96},
-     {{538984450UL, 1346371585UL}, 0},
-     {{538984450UL, 272629889UL}, 0.96},
-     {{538984450UL, 34632368129UL}, 0.96},
-     {{538984450UL, 272629765UL}, 0.96},
-     {{538984450UL, 4398319140865UL}, 0.96},
-     {{4398585495552UL, 272629763UL}, 0.96},
-     {{4398585495552UL, 8796365651969UL}, 0.96},
-     {{1612726272UL, 4400466624512UL}, 0.96},
-     {{1612726272UL, 13194412163072UL}, 0.96},
-     {{34898722816UL, 4467038617600UL}, 0.96},
-     {{34898722816UL, 13194412163072UL}, 0.96},
-     {{8796632006656UL, 4398327529472UL}, -0.96},
-     {{8796632006656UL, 4398319173632UL}, 0.96},
-     {{8796632006656UL, 4399392882688UL}, -0.96},
-     {{8796632006656UL, 4398319140992UL}, 0.96},
-     {{8796632006656UL, 4432678879232UL}, 0.96},
-     {{8796632006656UL, 4398319140865UL}, 0.96},
-     {{8796632006656UL, 21990505185280UL}, 0.96},
-     {{1075855488UL, 809500673UL}, -0.96},
-     {{2113920UL, 809500673UL}, 0.96},
-     {{34361852032UL, 809500673UL}, -0.96},
-     {{4398048624768UL, 809500673UL}, -0.96},
-     {{2114176UL, 272630017UL}, -0.96},
-     {{34361852032UL, 272630017UL}, -0.96},
-     {{4398048624768UL, 272630017UL}, -0.96},
-     {{2113920UL, 34632368129UL}, 0.96},
-     {{68721590400UL, 34632368129UL}, 0},
-     {{4398048624768UL, 34632368129UL}, -0.96},
-     {{2113920UL, 272630273UL}, -0.96},
-     {{2113920UL, 272629763UL}, 0.96},
-     {{2113920UL, 4398319140865UL}, 0.96},
-     {{34361852032UL, 68992106497UL}, -0.96},
-     {{34361852032UL, 272629763UL}, -0.96},
-     {{34361852032UL, 4398319140865UL}, -0.96},
-     {{2113666UL, 809500673UL}, -0.96},
-     {{2113666UL, 272630017UL}, -0.96},
-     {{2113666UL, 34632368129UL}, -0.96},
-     {{2113666UL, 272629765UL}, -0.96},
-     {{2113666UL, 4398319140865UL}, 0},
-     {{4398048624768UL, 272629763UL}, -0.96},
-     {{4398048624768UL, 8796365651969UL}, -0.96},
-     {{8796095135872UL, 4398319140865UL}, -0.96},
-     {{35435593728UL, 817889280UL}, -0.96},
-     {{35435593728UL, 2956984320UL}, -0.96},
-     {{35435593728UL, 809500800UL}, -0.96},
-     {{35435593728UL, 809500673UL}, 0.96},
-     {{35435593728UL, 4398856011776UL}, 0.96},
-     {{103081328640UL, 809500800UL}, -0.96},
-     {{103081328640UL, 138248454144UL}, -0.96},
-     {{103081328640UL, 809500673UL}, 0.96},
-     {{103081328640UL, 4398856011776UL}, 0.96},
-     {{34361851905UL, 809500800UL}, -0.96},
-     {{4432408363008UL, 809500800UL}, -0.96},
-     {{4432408363008UL, 809500673UL}, -0.96},
-     {{34361852160UL, 809500800UL}, -0.96},
-     {{34361852160UL, 272630400UL}, -0.96},
-     {{34361852160UL, 68992106624UL}, -0.96},
-     {{34361852160UL, 272629889UL}, 0.96},
-     {{34361852160UL, 4398319140992UL}, 0.96},
-     {{103081328640UL, 272630144UL}, -0.96},
-     {{103081328640UL, 137711583360UL}, -0.96},
-     {{103081328640UL, 272629889UL}, 0.96},
-     {{103081328640UL, 4398319140992UL}, 0.96},
-     {{34361851905UL, 272630144UL}, -0.96},
-     {{34361851905UL, 68992106624UL}, -0.96},
-     {{34361851905UL, 272629890UL}, -0.96},
-     {{34361851905UL, 4398319140992UL}, -0.96},
-     {{4432408363008UL, 272630144UL}, -0.96},
-     {{4432408363008UL, 68992106624UL}, -0.96},
-     {{4432408363008UL, 272629889UL}, -0.96},
-     {{4432408363008UL, 8796365652096UL}, -0.96},
-     {{34361884672UL, 206431059968UL}, -0.96},
-     {{34898722816UL, 206431059968UL}, 0.96},
-     {{171800805376UL, 68992106624UL}, -0.96},
-     {{171800805376UL, 343870013440UL}, -0.96},
-     {{171800805376UL, 68992106497UL}, -0.96},
-     {{171800805376UL, 4467038617600UL}, -0.96},
-     {{4432408363008UL, 206431059968UL}, -0.96},
-     {{4432408363008UL, 68992106497UL}, -0.96},
-     {{103081328640UL, 137711583233UL}, -0.96},
-     {{103081328640UL, 272629763UL}, 0.96},
-     {{103081328640UL, 4398319140865UL}, 0.96},
-     {{34361851906UL, 809500673UL}, -0.96},
-     {{34361851906UL, 272629889UL}, 0.96},
-     {{34361851906UL, 68992106497UL}, -0.96},
-     {{34361851906UL, 272629765UL}, 0},
-     {{34361851906UL, 4398319140865UL}, -0.96},
-     {{4432408363008UL, 272629763UL}, -0.96},
-     {{4432408363008UL, 8796365651969UL}, -0.96},
-     {{103081328640UL, 4535758094336UL}, -0.96},
-     {{103081328640UL, 13194412163072UL}, 0.96},
-     {{8830454874112UL, 4398856011776UL}, -0.96},
-     {{8830454874112UL, 4398319140992UL}, -0.96},
-     {{8830454874112UL, 4467038617600UL}, -0.96},
-     {{8830454874112UL, 4398319140865UL}, 0.96},
-     {{8830454874112UL, 21990505185280UL}, 0},
-     {{1075855361UL, 809500800UL}, -0.96},
-     {{2113539UL, 809500800UL}, -0.96},
-     {{4398048624641UL, 809500800UL}, -0.96},
-     {{2113793UL, 809500800UL}, -0.96},
-     {{2113793UL, 272630400UL}, -0.96},
-     {{2113793UL, 34632368256UL}, 0.96},
-     {{2113793UL, 272629890UL}, 0.96},
-     {{2113793UL, 4398319140992UL}, 0.96},
-     {{2113539UL, 272630144UL}, -0.96},
-     {{2113539UL, 34632368256UL}, 0},
-     {{2113539UL, 272629892UL}, -0.96},
-     {{2113539UL, 4398319140992UL}, 0.96},
-     {{4398048624641UL, 272630144UL}, -0.96},
-     {{4398048624641UL, 34632368256UL}, -0.96},
-     {{4398048624641UL, 272629890UL}, -0.96},
-     {{4398048624641UL, 8796365652096UL}, -0.96},
-     {{68721590273UL, 34632368256UL}, 0.96},
-     {{2113541UL, 272629890UL}, 0},
-     {{8796095135745UL, 4398319140992UL}, -0.96},
-     {{4399122366464UL, 817889280UL}, -0.96},
-     {{4399122366464UL, 809533440UL}, -0.96},
-     {{4399122366464UL, 2956984320UL}, -0.96},
-     {{4399122366464UL, 809500800UL}, -0.96},
-     {{4399122366464UL, 35169239040UL}, 0.96},
-     {{4399122366464UL, 809500673UL}, -0.96},
-     {{4399122366464UL, 8796902522880UL}, -0.96},
-     {{13194141646848UL, 809500800UL}, -0.96},
-     {{13194141646848UL, 35169239040UL}, -0.96},
-     {{13194141646848UL, 809500673UL}, -0.96},
-     {{13194141646848UL, 17592995545088UL}, -0.96},
-     {{4398048624896UL, 809500800UL}, -0.96},
-     {{4398048624896UL, 272630400UL}, -0.96},
-     {{4398048624896UL, 34632368256UL}, 0},
-     {{4398048624896UL, 272629889UL}, 0.96},
-     {{4398048624896UL, 8796365652096UL}, 0.96},
-     {{13194141646848UL, 272630144UL}, -0.96},
-     {{13194141646848UL, 34632368256UL}, 0},
-     {{13194141646848UL, 272629889UL}, -0.96},
-     {{13194141646848UL, 17592458674304UL}, -0.96},
-     {{4466768101376UL, 35169239040UL}, 0.96},
-     {{4466768101376UL, 34632368256UL}, 0},
-     {{4466768101376UL, 172071321600UL}, -0.96},
-     {{4466768101376UL, 34632368129UL}, 0.96},
-     {{4466768101376UL, 8830725390336UL}, 0.96},
-     {{13194141646848UL, 103351844864UL}, -0.96},
-     {{13194141646848UL, 34632368129UL}, 0.96},
-     {{13194141646848UL, 17626818412544UL}, 0},
-     {{4398048624642UL, 809500673UL}, -0.96},
-     {{4398048624642UL, 272629889UL}, -0.96},
-     {{4398048624642UL, 34632368129UL}, -0.96},
-     {{4398048624642UL, 272629765UL}, 0},
-     {{4398048624642UL, 8796365651969UL}, -0.96},
-     {{13194141646848UL, 272629763UL}, -0.96},
-     {{13194141646848UL, 17592458674177UL}, -0.96},
-     {{4398048657408UL, 26388551696384UL}, 0.96},
-     {{4398585495552UL, 26388551696384UL}, 0.96},
-     {{4432408363008UL, 26388551696384UL}, -0.96},
-     {{21990234669056UL, 8796902522880UL}, -0.96},
-     {{21990234669056UL, 8796365652096UL}, -0.96},
-     {{21990234669056UL, 8830725390336UL}, 0.96},
-     {{21990234669056UL, 8796365651969UL}, -0.96},
-     {{21990234669056UL, 43980737740800UL}, -0.96},
-     {{10534912UL, 4391040UL}, 0},
-     {{2277376UL, 4522112UL}, 0},
-     {{2277376UL, 4260224UL}, 0.96},
-     {{2277376UL, 34363998336UL}, -0.96},
-     {{2277376UL, 4259969UL}, 0.96},
-     {{2277376UL, 4398050771072UL}, 0},
-     {{270581760UL, 34363998336UL}, -0.96},
-     {{2146560UL, 4391040UL}, -0.96},
-     {{2146560UL, 4260480UL}, -0.96},
-     {{2146560UL, 34363998336UL}, -0.96},
-     {{2146560UL, 4259969UL}, -0.96},
-     {{2146560UL, 4398050771072UL}, -0.96},
-     {{2146305UL, 4391040UL}, -0.96},
-     {{2146305UL, 4260224UL}, -0.96},
-     {{2146305UL, 34363998336UL}, -0.96},
-     {{2146305UL, 4259970UL}, -0.96},
-     {{2146305UL, 4398050771072UL}, -0.96},
-     {{4398048657408UL, 4391040UL}, -0.96},
-     {{4398048657408UL, 4260224UL}, -0.96},
-     {{4398048657408UL, 34363998336UL}, -0.96},
-     {{4398048657408UL, 4259969UL}, -0.96},
-     {{4398048657408UL, 8796097282176UL}, -0.96},
-     {{2211840UL, 4325760UL}, 0.96},
-     {{270581760UL, 34363933056UL}, 0.96},
-     {{2146816UL, 12583296UL}, -0.96},
-     {{2146816UL, 4260224UL}, 0},
-     {{2146816UL, 272630144UL}, 0.96},
-     {{2146816UL, 4195712UL}, 0.96},
-     {{2146816UL, 34363933056UL}, 0.96},
-     {{2146816UL, 4194689UL}, 0.96},
-     {{2146816UL, 4398050705792UL}, 0.96},
-     {{2146305UL, 34363933056UL}, 0},
-     {{2146305UL, 4194690UL}, 0.96},
-     {{2146305UL, 4398050705792UL}, 0.96},
-     {{4398048657408UL, 34363933056UL}, 0.96},
-     {{4398048657408UL, 4194689UL}, 0.96},
-     {{4398048657408UL, 8796097216896UL}, 0.96},
-     {{2211840UL, 34364063872UL}, 0.96},
-     {{270581760UL, 103083409536UL}, -0.96},
-     {{270581760UL, 34363932801UL}, 0.96},
-     {{270581760UL, 4432410443904UL}, 0.96},
-     {{2146560UL, 34363933312UL}, 0.96},
-     {{2146560UL, 103083409536UL}, 0.96},
-     {{2146560UL, 34363932801UL}, 0.96},
-     {{2146560UL, 4432410443904UL}, 0.96},
-     {{68721623040UL, 34363998336UL}, 0},
-     {{68721623040UL, 34363933056UL}, 0.96},
-     {{68721623040UL, 171802886272UL}, 0.96},
-     {{68721623040UL, 34363932801UL}, 0.96},
-     {{68721623040UL, 4432410443904UL}, 0.96},
-     {{2146305UL, 103083409536UL}, -0.96},
-     {{2146305UL, 34363932802UL}, 0.96},
-     {{2146305UL, 4432410443904UL}, 0.96},
-     {{4398048657408UL, 103083409536UL}, 0.96},
-     {{4398048657408UL, 34363932801UL}, 0.96},
-     {{4398048657408UL, 8830456955008UL}, 0.96},
-     {{2211840UL, 4325505UL}, 0.96},
-     {{2146560UL, 4194945UL}, -0.96},
-     {{2146560UL, 4194435UL}, 0.96},
-     {{2146560UL, 4398050705537UL}, 0.96},
-     {{2146306UL, 4259969UL}, -0.96},
-     {{2146306UL, 4194689UL}, 0.96},
-     {{2146306UL, 34363932801UL}, 0.96},
-     {{2146306UL, 4194437UL}, 0.96},
-     {{2146306UL, 4398050705537UL}, 0.96},
-     {{4398048657408UL, 4194435UL}, 0.96},
-     {{4398048657408UL, 8796097216641UL}, 0.96},
-     {{2211840UL, 4398050836608UL}, 0.96},
-     {{2146560UL, 4398050706048UL}, 0.96},
-     {{2146560UL, 13194143727744UL}, 0.96},
-     {{2146305UL, 4398050705538UL}, 0.96},
-     {{2146305UL, 13194143727744UL}, 0.96},
-     {{8796095168512UL, 4398050771072UL}, -0.96},
-     {{8796095168512UL, 4398050705792UL}, 0},
-     {{8796095168512UL, 4432410443904UL}, 0.96},
-     {{8796095168512UL, 4398050705537UL}, 0.96},
-     {{8796095168512UL, 21990236749952UL}, 0.96},
-     {{270548993UL, 34363933056UL}, -0.96},
-     {{4398317060096UL, 34363933056UL}, -0.96},
-     {{270549248UL, 34363933312UL}, -0.96},
-     {{270549248UL, 103083409536UL}, -0.96},
-     {{270549248UL, 34363932801UL}, 0.96},
-     {{270549248UL, 4432410443904UL}, 0.96},
-     {{270548993UL, 34363932802UL}, -0.96},
-     {{270548993UL, 4432410443904UL}, -0.96},
-     {{270548994UL, 34363932801UL}, -0.96},
-     {{2114304UL, 12615808UL}, -0.96},
-     {{2114304UL, 281018496UL}, -0.96},
-     {{2114304UL, 12584064UL}, -0.96},
-     {{2114304UL, 34372321408UL}, -0.96},
-     {{2114304UL, 12583041UL}, -0.96},
-     {{2114304UL, 4398059094144UL}, 0.96},
-     {{2114304UL, 4292736UL}, 0},
-     {{2114304UL, 272662656UL}, 0.96},
-     {{2114304UL, 4228224UL}, 0},
-     {{2114304UL, 34363965568UL}, 0},
-     {{2114304UL, 4227201UL}, 0.96},
-     {{2114304UL, 4398050738304UL}, 0.96},
-     {{2114304UL, 809500800UL}, -0.96},
-     {{2114304UL, 272630912UL}, 0.96},
-     {{2114304UL, 34632368256UL}, 0.96},
-     {{2114304UL, 272629889UL}, 0.96},
-     {{2114304UL, 4398319140992UL}, 0.96},
-     {{2146560UL, 4195968UL}, 0.96},
-     {{2114816UL, 12583552UL}, -0.96},
-     {{2114816UL, 4227712UL}, 0.96},
-     {{2114816UL, 272630400UL}, 0},
-     {{2114816UL, 4196992UL}, 0},
-     {{2114816UL, 34363933312UL}, 0},
-     {{2114816UL, 4194945UL}, 0.96},
-     {{2114816UL, 4398050706048UL}, 0.96},
-     {{2113793UL, 4195968UL}, -0.96},
-     {{2113793UL, 34363933312UL}, -0.96},
-     {{2113793UL, 4194946UL}, 0},
-     {{2113793UL, 4398050706048UL}, -0.96},
-     {{4398048624896UL, 4195968UL}, -0.96},
-     {{4398048624896UL, 34363933312UL}, -0.96},
-     {{4398048624896UL, 4194945UL}, -0.96},
-     {{4398048624896UL, 8796097217152UL}, -0.96},
-     {{2114304UL, 34363933824UL}, 0.96},
-     {{2114304UL, 103083409536UL}, -0.96},
-     {{2114304UL, 34363932801UL}, 0.96},
-     {{2114304UL, 4432410443904UL}, 0.96},
-     {{68721590528UL, 34372321408UL}, -0.96},
-     {{68721590528UL, 34363965568UL}, 0.96},
-     {{68721590528UL, 34632368256UL}, 0.96},
-     {{68721590528UL, 34363933312UL}, 0},
-     {{68721590528UL, 171802886272UL}, 0.96},
-     {{68721590528UL, 34363932801UL}, 0.96},
-     {{68721590528UL, 4432410443904UL}, 0.96},
-     {{2113793UL, 103083409536UL}, -0.96},
-     {{2113793UL, 34363932802UL}, 0.96},
-     {{2113793UL, 4432410443904UL}, 0},
-     {{4398048624896UL, 103083409536UL}, -0.96},
-     {{4398048624896UL, 34363932801UL}, -0.96},
-     {{4398048624896UL, 8830456955008UL}, -0.96},
-     {{2114304UL, 4195457UL}, 0.96},
-     {{2114304UL, 4194435UL}, 0.96},
-     {{2114304UL, 4398050705537UL}, 0.96},
-     {{2113794UL, 12583041UL}, -0.96},
-     {{2113794UL, 4227201UL}, 0.96},
-     {{2113794UL, 272629889UL}, 0.96},
-     {{2113794UL, 4194945UL}, -0.96},
-     {{2113794UL, 34363932801UL}, 0.96},
-     {{2113794UL, 4194437UL}, 0.96},
-     {{2113794UL, 4398050705537UL}, 0.96},
-     {{4398048624896UL, 4194435UL}, 0.96},
-     {{4398048624896UL, 8796097216641UL}, 0.96},
-     {{2114304UL, 4398050706560UL}, 0.96},
-     {{2114304UL, 13194143727744UL}, 0.96},
-     {{2113793UL, 4398050705538UL}, 0.96},
-     {{2113793UL, 13194143727744UL}, 0.96},
-     {{8796095136000UL, 4398059094144UL}, -0.96},
-     {{8796095136000UL, 4398050738304UL}, 0.96},
-     {{8796095136000UL, 4398319140992UL}, 0.96},
-     {{8796095136000UL, 4398050706048UL}, -0.96},
-     {{8796095136000UL, 4432410443904UL}, 0.96},
-     {{8796095136000UL, 4398050705537UL}, 0.96},
-     {{8796095136000UL, 21990236749952UL}, 0.96},
-     {{34361852416UL, 272630144UL}, -0.96},
-     {{2114049UL, 12583296UL}, -0.96},
-     {{2114049UL, 272630144UL}, -0.96},
-     {{2114049UL, 4195712UL}, -0.96},
-     {{2114049UL, 34363933056UL}, -0.96},
-     {{2114049UL, 4398050705792UL}, 0},
-     {{2113539UL, 34363933056UL}, -0.96},
-     {{2113539UL, 4194692UL}, -0.96},
-     {{2113539UL, 4398050705792UL}, 0.96},
-     {{4398048624641UL, 34363933056UL}, -0.96},
-     {{4398048624641UL, 8796097216896UL}, -0.96},
-     {{68721590273UL, 34363933056UL}, -0.96},
-     {{68721590273UL, 171802886272UL}, -0.96},
-     {{68721590273UL, 34363932802UL}, 0.96},
-     {{68721590273UL, 4432410443904UL}, 0.96},
-     {{2113539UL, 103083409536UL}, -0.96},
-     {{2113539UL, 34363932804UL}, -0.96},
-     {{2113539UL, 4432410443904UL}, 0},
-     {{4398048624641UL, 103083409536UL}, -0.96},
-     {{4398048624641UL, 34363932802UL}, -0.96},
-     {{4398048624641UL, 8830456955008UL}, -0.96},
-     {{2146305UL, 4194438UL}, 0.96},
-     {{2113793UL, 4194438UL}, 0},
-     {{2113541UL, 34363932802UL}, -0.96},
-     {{2113541UL, 4194442UL}, 0},
-     {{2113541UL, 4398050705538UL}, 0.96},
-     {{4398048624641UL, 4194438UL}, -0.96},
-     {{4398048624641UL, 8796097216642UL}, 0},
-     {{2113539UL, 4398050705540UL}, 0},
-     {{2113539UL, 13194143727744UL}, 0.96},
-     {{8796095135745UL, 4398050705792UL}, -0.96},
-     {{8796095135745UL, 4432410443904UL}, -0.96},
-     {{8796095135745UL, 4398050705538UL}, 0},
-     {{8796095135745UL, 21990236749952UL}, 0},
-     {{4398048625152UL, 12583296UL}, -0.96},
-     {{4398048625152UL, 4227456UL}, -0.96},
-     {{4398048625152UL, 272630144UL}, -0.96},
-     {{4398048625152UL, 4195712UL}, -0.96},
-     {{4398048625152UL, 34363933056UL}, -0.96},
-     {{4398048625152UL, 4194689UL}, 0},
-     {{4398048625152UL, 8796097216896UL}, 0},
-     {{13194141646848UL, 34363933056UL}, -0.96},
-     {{13194141646848UL, 4194689UL}, -0.96},
-     {{13194141646848UL, 17592190239104UL}, -0.96},
-     {{4466768101376UL, 34363933056UL}, -0.96},
-     {{4466768101376UL, 171802886272UL}, -0.96},
-     {{4466768101376UL, 34363932801UL}, 0.96},
-     {{4466768101376UL, 8830456955008UL}, -0.96},
-     {{13194141646848UL, 103083409536UL}, -0.96},
-     {{13194141646848UL, 34363932801UL}, -0.96},
-     {{13194141646848UL, 17626549977216UL}, -0.96},
-     {{4398048624642UL, 4194689UL}, -0.96},
-     {{4398048624642UL, 34363932801UL}, -0.96},
-     {{4398048624642UL, 4194437UL}, 0},
-     {{4398048624642UL, 8796097216641UL}, 0.96},
-     {{13194141646848UL, 4194435UL}, -0.96},
-     {{13194141646848UL, 17592190238849UL}, -0.96},
-     {{4398048657408UL, 26388283261056UL}, 0.96},
-     {{4398048624896UL, 26388283261056UL}, 0.96},
-     {{4398048624641UL, 26388283261056UL}, 0.96},
-     {{21990234669056UL, 8796097216896UL}, -0.96},
-     {{21990234669056UL, 8830456955008UL}, -0.96},
-     {{21990234669056UL, 8796097216641UL}, -0.96},
-     {{21990234669056UL, 43980469305472UL}, -0.96},
-     {{10534912UL, 34364129280UL}, 0.96},
-     {{2277376UL, 34364260352UL}, 0.96},
-     {{2277376UL, 103083474944UL}, 0.96},
-     {{2277376UL, 34363998209UL}, 0},
-     {{2277376UL, 4432410509312UL}, 0.96},
-     {{68721623040UL, 34364129280UL}, 0.96},
-     {{68721623040UL, 171802951680UL}, 0.96},
-     {{68721623040UL, 34363998209UL}, 0},
-     {{68721623040UL, 4432410509312UL}, 0.96},
-     {{4398048657408UL, 34364129280UL}, 0.96},
-     {{4398048657408UL, 103083474944UL}, 0.96},
-     {{4398048657408UL, 34363998209UL}, -0.96},
-     {{4398048657408UL, 8830457020416UL}, 0.96},
-     {{2211840UL, 103083540480UL}, 0.96},
-     {{137441099776UL, 103091798016UL}, 0.96},
-     {{137441099776UL, 103083474944UL}, 0.96},
-     {{137441099776UL, 103351844864UL}, 0.96},
-     {{137441099776UL, 103083409536UL}, 0.96},
-     {{137441099776UL, 377961316352UL}, 0.96},
-     {{137441099776UL, 103083409409UL}, 0.96},
-     {{137441099776UL, 4501129920512UL}, 0.96},
-     {{4398048657408UL, 103083409409UL}, 0.96},
-     {{4398048657408UL, 8899176431616UL}, 0.96},
-     {{2211840UL, 34364063745UL}, 0.96},
-     {{68721623040UL, 171802886145UL}, 0.96},
-     {{68721623040UL, 34363932675UL}, 0.96},
-     {{68721623040UL, 4432410443777UL}, 0.96},
-     {{2146306UL, 34363998209UL}, -0.96},
-     {{2146306UL, 103083409409UL}, 0.96},
-     {{2146306UL, 34363932677UL}, 0.96},
-     {{2146306UL, 4432410443777UL}, 0.96},
-     {{4398048657408UL, 34363932675UL}, 0.96},
-     {{4398048657408UL, 8830456954881UL}, 0.96},
-     {{2211840UL, 4432410574848UL}, 0.96},
-     {{68721623040UL, 4569849397248UL}, 0.96},
-     {{68721623040UL, 13228503465984UL}, 0.96},
-     {{8796095168512UL, 4432410509312UL}, 0.96},
-     {{8796095168512UL, 4501129920512UL}, 0.96},
-     {{8796095168512UL, 4432410443777UL}, 0.96},
-     {{8796095168512UL, 22024596488192UL}, 0.96},
-     {{206160543744UL, 34372354048UL}, 0.96},
-     {{206160543744UL, 34640756736UL}, 0.96},
-     {{206160543744UL, 34372321408UL}, -0.96},
-     {{206160543744UL, 309250228224UL}, 0.96},
-     {{206160543744UL, 34372321281UL}, -0.96},
-     {{206160543744UL, 4432418832384UL}, 0.96},
-     {{206160543744UL, 34364030976UL}, 0.96},
-     {{206160543744UL, 34632400896UL}, 0.96},
-     {{206160543744UL, 34363965568UL}, -0.96},
-     {{206160543744UL, 309241872384UL}, 0.96},
-     {{206160543744UL, 34363965441UL}, 0.96},
-     {{206160543744UL, 4432410476544UL}, 0.96},
-     {{206160543744UL, 35169239040UL}, 0.96},
-     {{206160543744UL, 34632368256UL}, 0.96},
-     {{206160543744UL, 309510275072UL}, 0.96},
-     {{206160543744UL, 34632368129UL}, 0.96},
-     {{206160543744UL, 4432678879232UL}, 0.96},
-     {{206160543744UL, 34363933056UL}, -0.96},
-     {{206160543744UL, 309241839744UL}, 0.96},
-     {{206160543744UL, 34363932801UL}, 0.96},
-     {{206160543744UL, 4432410443904UL}, 0.96},
-     {{68721623040UL, 446680793088UL}, 0.96},
-     {{343599497216UL, 171811274752UL}, 0.96},
-     {{343599497216UL, 171802918912UL}, 0.96},
-     {{343599497216UL, 172071321600UL}, 0.96},
-     {{343599497216UL, 171802886272UL}, 0},
-     {{343599497216UL, 721558700032UL}, 0.96},
-     {{343599497216UL, 171802886145UL}, 0.96},
-     {{343599497216UL, 4569849397248UL}, 0.96},
-     {{4466768101376UL, 446680793088UL}, 0.96},
-     {{4466768101376UL, 171802886145UL}, -0.96},
-     {{4466768101376UL, 8967895908352UL}, 0.96},
-     {{206160543744UL, 309241839617UL}, 0.96},
-     {{206160543744UL, 34363932675UL}, 0.96},
-     {{206160543744UL, 4432410443777UL}, 0.96},
-     {{68721590274UL, 34372321281UL}, -0.96},
-     {{68721590274UL, 34363965441UL}, 0.96},
-     {{68721590274UL, 34632368129UL}, 0.96},
-     {{68721590274UL, 34363932801UL}, 0.96},
-     {{68721590274UL, 171802886145UL}, -0.96},
-     {{68721590274UL, 34363932677UL}, 0.96},
-     {{68721590274UL, 4432410443777UL}, 0.96},
-     {{4466768101376UL, 34363932675UL}, 0},
-     {{4466768101376UL, 8830456954881UL}, 0.96},
-     {{206160543744UL, 4707288350720UL}, 0.96},
-     {{206160543744UL, 13228503465984UL}, 0.96},
-     {{8864814612480UL, 4432418832384UL}, 0.96},
-     {{8864814612480UL, 4432410476544UL}, 0.96},
-     {{8864814612480UL, 4432678879232UL}, 0.96},
-     {{8864814612480UL, 4432410443904UL}, 0.96},
-     {{8864814612480UL, 4569849397248UL}, 0.96},
-     {{8864814612480UL, 4432410443777UL}, 0.96},
-     {{8864814612480UL, 22024596488192UL}, 0.96},
-     {{4535487578112UL, 103091798016UL}, 0.96},
-     {{4535487578112UL, 103083442176UL}, 0.96},
-     {{4535487578112UL, 103351844864UL}, -0.96},
-     {{4535487578112UL, 103083409536UL}, -0.96},
-     {{4535487578112UL, 377961316352UL}, 0.96},
-     {{4535487578112UL, 103083409409UL}, -0.96},
-     {{4535487578112UL, 8899176431616UL}, 0.96},
-     {{13194141646848UL, 103083409409UL}, -0.96},
-     {{13194141646848UL, 17695269453824UL}, 0.96},
-     {{4398048624642UL, 103083409409UL}, -0.96},
-     {{4398048624642UL, 34363932677UL}, -0.96},
-     {{4398048624642UL, 8830456954881UL}, 0},
-     {{13194141646848UL, 34363932675UL}, 0.96},
-     {{13194141646848UL, 17626549977089UL}, 0},
-     {{4398048657408UL, 26422642999296UL}, 0.96},
-     {{4466768101376UL, 26422642999296UL}, 0.96},
-     {{21990234669056UL, 8899176431616UL}, 0.96},
-     {{21990234669056UL, 8830456954881UL}, -0.96},
-     {{21990234669056UL, 44014829043712UL}, 0.96},
-     {{10534912UL, 4390913UL}, 0.96},
-     {{2277376UL, 4521985UL}, 0.96},
-     {{2277376UL, 4259843UL}, 0.96},
-     {{2277376UL, 4398050770945UL}, 0.96},
-     {{2146306UL, 4390913UL}, 0.96},
-     {{2146306UL, 4259845UL}, 0.96},
-     {{2146306UL, 4398050770945UL}, 0.96},
-     {{4398048657408UL, 4390913UL}, 0.96},
-     {{4398048657408UL, 4259843UL}, 0.96},
-     {{4398048657408UL, 8796097282049UL}, 0.96},
-     {{2211840UL, 4325379UL}, 0.96},
-     {{2146308UL, 12582915UL}, 0.96},
-     {{2146308UL, 4259843UL}, 0.96},
-     {{2146308UL, 272629763UL}, 0.96},
-     {{2146308UL, 4194435UL}, 0.96},
-     {{2146308UL, 34363932675UL}, 0.96},
-     {{2146308UL, 4194315UL}, 0.96},
-     {{2146308UL, 4398050705411UL}, 0.96},
-     {{4398048657408UL, 8796097216515UL}, 0.96},
-     {{2211840UL, 4398050836481UL}, 0.96},
-     {{2146306UL, 4398050705413UL}, 0.96},
-     {{2146306UL, 13194143727617UL}, 0.96},
-     {{8796095168512UL, 4398050770945UL}, 0.96},
-     {{8796095168512UL, 4398050705411UL}, 0.96},
-     {{8796095168512UL, 21990236749825UL}, 0.96},
-     {{2113668UL, 272629763UL}, -0.96},
-     {{34361851908UL, 272629763UL}, 0.96},
-     {{2113542UL, 12615681UL}, 0.96},
-     {{2113542UL, 281018369UL}, -0.96},
-     {{2113542UL, 12583041UL}, -0.96},
-     {{2113542UL, 34372321281UL}, -0.96},
-     {{2113542UL, 12582921UL}, 0.96},
-     {{2113542UL, 4398059094017UL}, 0.96},
-     {{2113542UL, 4292609UL}, 0.96},
-     {{2113542UL, 272662529UL}, -0.96},
-     {{2113542UL, 4227201UL}, -0.96},
-     {{2113542UL, 34363965441UL}, -0.96},
-     {{2113542UL, 4227081UL}, 0.96},
-     {{2113542UL, 4398050738177UL}, 0.96},
-     {{2113542UL, 809500673UL}, -0.96},
-     {{2113542UL, 272629889UL}, 0.96},
-     {{2113542UL, 34632368129UL}, 0.96},
-     {{2113542UL, 272629769UL}, -0.96},
-     {{2113542UL, 4398319140865UL}, 0.96},
-     {{2113542UL, 4194689UL}, 0.96},
-     {{2113542UL, 34363932801UL}, 0.96},
-     {{2113542UL, 4194441UL}, 0.96},
-     {{2113542UL, 4398050705537UL}, 0.96},
-     {{2113542UL, 103083409409UL}, -0.96},
-     {{2113542UL, 34363932681UL}, 0},
-     {{2113542UL, 4432410443777UL}, 0},
-     {{2146306UL, 4194317UL}, 0.96},
-     {{2113546UL, 12582917UL}, 0.96},
-     {{2113546UL, 4227077UL}, 0.96},
-     {{2113546UL, 272629765UL}, 0.96},
-     {{2113546UL, 4194437UL}, 0.96},
-     {{2113546UL, 34363932677UL}, 0.96},
-     {{2113546UL, 4194325UL}, 0.96},
-     {{2113546UL, 4398050705413UL}, 0.96},
-     {{4398048624642UL, 4194317UL}, 0.96},
-     {{4398048624642UL, 8796097216517UL}, 0.96},
-     {{2113542UL, 4398050705417UL}, 0.96},
-     {{2113542UL, 13194143727617UL}, 0.96},
-     {{8796095135746UL, 4398059094017UL}, 0.96},
-     {{8796095135746UL, 4398050738177UL}, 0.96},
-     {{8796095135746UL, 4398319140865UL}, -0.96},
-     {{8796095135746UL, 4398050705537UL}, 0},
-     {{8796095135746UL, 4432410443777UL}, 0},
-     {{8796095135746UL, 4398050705413UL}, 0.96},
-     {{8796095135746UL, 21990236749825UL}, 0.96},
-     {{4398048624644UL, 12582915UL}, 0.96},
-     {{4398048624644UL, 4227075UL}, 0.96},
-     {{4398048624644UL, 272629763UL}, -0.96},
-     {{4398048624644UL, 4194435UL}, 0.96},
-     {{4398048624644UL, 34363932675UL}, -0.96},
-     {{4398048624644UL, 4194315UL}, 0.96},
-     {{4398048624644UL, 8796097216515UL}, 0.96},
-     {{13194141646848UL, 17592190238723UL}, 0.96},
-     {{4398048657408UL, 26388283260929UL}, 0.96},
-     {{4398048624642UL, 26388283260929UL}, 0.96},
-     {{21990234669056UL, 8796097216515UL}, 0.96},
-     {{21990234669056UL, 43980469305345UL}, 0.96},
-     {{10534912UL, 4398050902016UL}, 0.96},
-     {{2277376UL, 4398051033088UL}, 0.96},
-     {{2277376UL, 13194143793152UL}, 0.96},
-     {{8796095168512UL, 4398050902016UL}, 0.96},
-     {{8796095168512UL, 21990236815360UL}, 0.96},
-     {{2211840UL, 13194143858688UL}, 0.96},
-     {{17592188190720UL, 13194152116224UL}, 0.96},
-     {{17592188190720UL, 13194143793152UL}, 0.96},
-     {{17592188190720UL, 13194412163072UL}, 0.96},
-     {{17592188190720UL, 13194143727744UL}, 0.96},
-     {{17592188190720UL, 13228503465984UL}, 0.96},
-     {{17592188190720UL, 13194143727617UL}, 0.96},
-     {{17592188190720UL, 48378515816448UL}, 0.96},
-     {{26388281180160UL, 4398059126784UL}, 0.96},
-     {{26388281180160UL, 4398327529472UL}, 0.96},
-     {{26388281180160UL, 4398059094144UL}, -0.96},
-     {{26388281180160UL, 4432418832384UL}, 0.96},
-     {{26388281180160UL, 4398059094017UL}, 0.96},
-     {{26388281180160UL, 39582431182848UL}, 0.96},
-     {{26388281180160UL, 4398050803712UL}, 0.96},
-     {{26388281180160UL, 4398319173632UL}, -0.96},
-     {{26388281180160UL, 4398050738304UL}, -0.96},
-     {{26388281180160UL, 4432410476544UL}, 0.96},
-     {{26388281180160UL, 4398050738177UL}, 0.96},
-     {{26388281180160UL, 39582422827008UL}, 0.96},
-     {{26388281180160UL, 4398856011776UL}, -0.96},
-     {{26388281180160UL, 4398319140992UL}, -0.96},
-     {{26388281180160UL, 4432678879232UL}, 0.96},
-     {{26388281180160UL, 4398319140865UL}, 0.96},
-     {{26388281180160UL, 39582691229696UL}, 0.96},
-     {{26388281180160UL, 4398050705792UL}, -0.96},
-     {{26388281180160UL, 4432410443904UL}, -0.96},
-     {{26388281180160UL, 4398050705537UL}, 0.96},
-     {{26388281180160UL, 39582422794368UL}, 0},
-     {{26388281180160UL, 4501129920512UL}, 0.96},
-     {{26388281180160UL, 4432410443777UL}, 0.96},
-     {{26388281180160UL, 39616782532608UL}, 0.96},
-     {{26388281180160UL, 4398050705411UL}, 0.96},
-     {{26388281180160UL, 39582422794241UL}, 0.96},
-     {{8796095168512UL, 57174608838656UL}, 0.96},
-     {{43980467224576UL, 21990245138432UL}, 0.96},
-     {{43980467224576UL, 21990236782592UL}, 0.96},
-     {{43980467224576UL, 21990505185280UL}, -0.96},
-     {{43980467224576UL, 21990236749952UL}, 0.96},
-     {{43980467224576UL, 22024596488192UL}, 0.96},
-     {{43980467224576UL, 21990236749825UL}, 0.96},
-     {{43980467224576UL, 92358980927488UL}, 0.96},
-     {{85983360UL, 46153728UL}, -0.96},
-     {{85983360UL, 314572800UL}, -0.96},
-     {{85983360UL, 46137600UL}, 0.96},
-     {{85983360UL, 34405875712UL}, 0.96},
-     {{85983360UL, 46137345UL}, -0.96},
-     {{85983360UL, 4398092648448UL}, 0.96},
-     {{18874752UL, 113246208UL}, 0.96},
-     {{18874752UL, 46153728UL}, -0.96},
-     {{18874752UL, 314572800UL}, 0.96},
-     {{18874752UL, 46137856UL}, 0.96},
-     {{18874752UL, 34405875712UL}, 0.96},
-     {{18874752UL, 46137345UL}, -0.96},
-     {{18874752UL, 4398092648448UL}, 0.96},
-     {{34378612864UL, 113246208UL}, 0.96},
-     {{34378612864UL, 46153728UL}, -0.96},
-     {{34378612864UL, 46137600UL}, 0.96},
-     {{34378612864UL, 46137345UL}, 0.96},
-     {{18874497UL, 46153728UL}, -0.96},
-     {{4398065385600UL, 113246208UL}, 0.96},
-     {{4398065385600UL, 46153728UL}, -0.96},
-     {{4398065385600UL, 314572800UL}, 0.96},
-     {{4398065385600UL, 46137600UL}, 0.96},
-     {{4398065385600UL, 34405875712UL}, 0.96},
-     {{4398065385600UL, 46137345UL}, 0.96},
-     {{4398065385600UL, 8796139159552UL}, 0.96},
-     {{52428928UL, 79708160UL}, -0.96},
-     {{52428928UL, 12632064UL}, -0.96},
-     {{52428928UL, 281034752UL}, -0.96},
-     {{52428928UL, 12599552UL}, -0.96},
-     {{52428928UL, 34372337664UL}, -0.96},
-     {{52428928UL, 12599297UL}, -0.96},
-     {{52428928UL, 4398059110400UL}, -0.96},
-     {{18907264UL, 46153728UL}, -0.96},
-     {{18907264UL, 12664832UL}, -0.96},
-     {{18907264UL, 281034752UL}, -0.96},
-     {{18907264UL, 12599552UL}, -0.96},
-     {{18907264UL, 34372337664UL}, -0.96},
-     {{18907264UL, 12599297UL}, -0.96},
-     {{18907264UL, 4398059110400UL}, -0.96},
-     {{18874752UL, 12632064UL}, 0.96},
-     {{18874752UL, 281034752UL}, -0.96},
-     {{18874752UL, 12599808UL}, -0.96},
-     {{18874752UL, 34372337664UL}, -0.96},
-     {{18874752UL, 12599297UL}, -0.96},
-     {{18874752UL, 4398059110400UL}, -0.96},
-     {{34378612864UL, 12632064UL}, -0.96},
-     {{34378612864UL, 281034752UL}, -0.96},
-     {{34378612864UL, 12599552UL}, -0.96},
-     {{34378612864UL, 68732076032UL}, -0.96},
-     {{34378612864UL, 12599297UL}, -0.96},
-     {{34378612864UL, 4398059110400UL}, -0.96},
-     {{18874497UL, 12632064UL}, -0.96},
-     {{18874497UL, 281034752UL}, -0.96},
-     {{18874497UL, 12599552UL}, -0.96},
-     {{18874497UL, 34372337664UL}, -0.96},
-     {{18874497UL, 12599298UL}, 0},
-     {{18874497UL, 4398059110400UL}, -0.96},
-     {{4398065385600UL, 12632064UL}, -0.96},
-     {{4398065385600UL, 281034752UL}, -0.96},
-     {{4398065385600UL, 12599552UL}, -0.96},
-     {{4398065385600UL, 34372337664UL}, -0.96},
-     {{4398065385600UL, 12599297UL}, -0.96},
-     {{4398065385600UL, 8796105621504UL}, -0.96},
-     {{52428928UL, 348127232UL}, 0},
-     {{52428928UL, 817889280UL}, -0.96},
-     {{52428928UL, 281018624UL}, -0.96},
-     {{52428928UL, 34640756736UL}, -0.96},
-     {{52428928UL, 281018369UL}, -0.96},
-     {{52428928UL, 4398327529472UL}, 0},
-     {{555745408UL, 314572800UL}, -0.96},
-     {{555745408UL, 281034752UL}, 0},
-     {{555745408UL, 1354760192UL}, -0.96},
-     {{555745408UL, 281018624UL}, -0.96},
-     {{555745408UL, 34640756736UL}, 0.96},
-     {{555745408UL, 281018369UL}, -0.96},
-     {{555745408UL, 4398327529472UL}, 0},
-     {{18874752UL, 817889280UL}, 0.96},
-     {{18874752UL, 281018880UL}, 0.96},
-     {{18874752UL, 34640756736UL}, 0},
-     {{18874752UL, 281018369UL}, -0.96},
-     {{18874752UL, 4398327529472UL}, -0.96},
-     {{4398065385600UL, 817889280UL}, -0.96},
-     {{4398065385600UL, 281018624UL}, -0.96},
-     {{4398065385600UL, 34640756736UL}, -0.96},
-     {{4398065385600UL, 281018369UL}, -0.96},
-     {{4398065385600UL, 8796374040576UL}, -0.96},
-     {{52428928UL, 79692032UL}, 0.96},
-     {{52428928UL, 12583680UL}, 0.96},
-     {{52428928UL, 34372321536UL}, 0.96},
-     {{52428928UL, 12583169UL}, -0.96},
-     {{52428928UL, 4398059094272UL}, 0.96},
-     {{18875008UL, 46137600UL}, 0.96},
-     {{18875008UL, 12599552UL}, -0.96},
-     {{18875008UL, 281018624UL}, -0.96},
-     {{18875008UL, 12584192UL}, 0.96},
-     {{18875008UL, 34372321536UL}, 0.96},
-     {{18875008UL, 12583169UL}, -0.96},
-     {{18875008UL, 4398059094272UL}, 0.96},
-     {{34378612864UL, 12583680UL}, 0.96},
-     {{34378612864UL, 68732059904UL}, 0.96},
-     {{34378612864UL, 12583169UL}, 0.96},
-     {{34378612864UL, 4398059094272UL}, 0.96},
-     {{4398065385600UL, 12583680UL}, 0.96},
-     {{4398065385600UL, 34372321536UL}, 0.96},
-     {{4398065385600UL, 12583169UL}, 0.96},
-     {{4398065385600UL, 8796105605376UL}, 0.96},
-     {{52428928UL, 34439430144UL}, 0.96},
-     {{52428928UL, 103091798016UL}, 0.96},
-     {{52428928UL, 34372321281UL}, -0.96},
-     {{52428928UL, 4432418832384UL}, 0.96},
-     {{18874752UL, 34372321792UL}, 0.96},
-     {{18874752UL, 103091798016UL}, 0.96},
-     {{18874752UL, 34372321281UL}, -0.96},
-     {{18874752UL, 4432418832384UL}, 0.96},
-     {{68738351232UL, 34405875712UL}, 0.96},
-     {{68738351232UL, 34372337664UL}, -0.96},
-     {{68738351232UL, 34640756736UL}, 0},
-     {{68738351232UL, 34372321536UL}, 0.96},
-     {{68738351232UL, 171811274752UL}, 0.96},
-     {{68738351232UL, 34372321281UL}, -0.96},
-     {{68738351232UL, 4432418832384UL}, 0.96},
-     {{4398065385600UL, 103091798016UL}, 0.96},
-     {{4398065385600UL, 34372321281UL}, -0.96},
-     {{4398065385600UL, 8830465343488UL}, 0.96},
-     {{52428928UL, 79691777UL}, -0.96},
-     {{52428928UL, 12582915UL}, -0.96},
-     {{52428928UL, 4398059094017UL}, 0},
-     {{18874752UL, 12583425UL}, -0.96},
-     {{18874752UL, 12582915UL}, 0},
-     {{18874752UL, 4398059094017UL}, 0},
-     {{34378612864UL, 12582915UL}, 0.96},
-     {{34378612864UL, 4398059094017UL}, -0.96},
-     {{18874498UL, 46137345UL}, -0.96},
-     {{18874498UL, 12599297UL}, -0.96},
-     {{18874498UL, 281018369UL}, -0.96},
-     {{18874498UL, 12583169UL}, -0.96},
-     {{18874498UL, 34372321281UL}, -0.96},
-     {{18874498UL, 12582917UL}, -0.96},
-     {{18874498UL, 4398059094017UL}, -0.96},
-     {{4398065385600UL, 12582915UL}, 0.96},
-     {{4398065385600UL, 8796105605121UL}, 0.96},
-     {{52428928UL, 4398126202880UL}, 0.96},
-     {{52428928UL, 13194152116224UL}, 0.96},
-     {{18874752UL, 4398059094528UL}, 0.96},
-     {{18874752UL, 13194152116224UL}, 0.96},
-     {{8796111896704UL, 4398092648448UL}, 0.96},
-     {{8796111896704UL, 4398059110400UL}, -0.96},
-     {{8796111896704UL, 4398327529472UL}, 0.96},
-     {{8796111896704UL, 4398059094272UL}, 0.96},
-     {{8796111896704UL, 4432418832384UL}, 0.96},
-     {{8796111896704UL, 4398059094017UL}, -0.96},
-     {{8796111896704UL, 21990245138432UL}, 0.96},
-     {{35651968UL, 96468992UL}, 0.96},
-     {{35651968UL, 29376512UL}, -0.96},
-     {{35651968UL, 297795584UL}, -0.96},
-     {{35651968UL, 29360640UL}, 0.96},
-     {{35651968UL, 34389098496UL}, 0.96},
-     {{35651968UL, 29360129UL}, -0.96},
-     {{35651968UL, 4398075871232UL}, 0.96},
-     {{2130304UL, 12664832UL}, -0.96},
-     {{2130304UL, 281034752UL}, -0.96},
-     {{2130304UL, 12599808UL}, -0.96},
-     {{2130304UL, 34372337664UL}, -0.96},
-     {{2130304UL, 12599297UL}, -0.96},
-     {{2130304UL, 4398059110400UL}, -0.96},
-     {{2098048UL, 12600320UL}, -0.96},
-     {{34361835904UL, 12632064UL}, -0.96},
-     {{34361835904UL, 281034752UL}, -0.96},
-     {{34361835904UL, 12599808UL}, -0.96},
-     {{34361835904UL, 68732076032UL}, -0.96},
-     {{34361835904UL, 12599297UL}, -0.96},
-     {{34361835904UL, 4398059110400UL}, -0.96},
-     {{2097537UL, 12632064UL}, -0.96},
-     {{2097537UL, 281034752UL}, -0.96},
-     {{2097537UL, 12599808UL}, -0.96},
-     {{2097537UL, 34372337664UL}, -0.96},
-     {{2097537UL, 12599298UL}, 0},
-     {{2097537UL, 4398059110400UL}, -0.96},
-     {{4398048608640UL, 12632064UL}, -0.96},
-     {{4398048608640UL, 281034752UL}, -0.96},
-     {{4398048608640UL, 12599808UL}, -0.96},
-     {{4398048608640UL, 34372337664UL}, -0.96},
-     {{4398048608640UL, 12599297UL}, -0.96},
-     {{4398048608640UL, 8796105621504UL}, -0.96},
-     {{538968448UL, 281034752UL}, -0.96},
-     {{538968448UL, 1354760192UL}, -0.96},
-     {{538968448UL, 281018880UL}, -0.96},
-     {{538968448UL, 34640756736UL}, 0},
-     {{538968448UL, 281018369UL}, -0.96},
-     {{538968448UL, 4398327529472UL}, -0.96},
-     {{2098048UL, 281019392UL}, -0.96},
-     {{34361835904UL, 817889280UL}, -0.96},
-     {{34361835904UL, 281018880UL}, -0.96},
-     {{34361835904UL, 69000495104UL}, -0.96},
-     {{34361835904UL, 281018369UL}, -0.96},
-     {{34361835904UL, 4398327529472UL}, -0.96},
-     {{4398048608640UL, 817889280UL}, -0.96},
-     {{4398048608640UL, 281018880UL}, 0.96},
-     {{4398048608640UL, 34640756736UL}, -0.96},
-     {{4398048608640UL, 281018369UL}, -0.96},
-     {{4398048608640UL, 8796374040576UL}, -0.96},
-     {{18874752UL, 12584448UL}, 0.96},
-     {{2098560UL, 12599808UL}, -0.96},
-     {{2098560UL, 281018880UL}, -0.96},
-     {{2098560UL, 12585472UL}, 0.96},
-     {{2098560UL, 34372321792UL}, 0.96},
-     {{2098560UL, 12583425UL}, -0.96},
-     {{2098560UL, 4398059094528UL}, 0.96},
-     {{34361835904UL, 12584448UL}, 0.96},
-     {{34361835904UL, 68732060160UL}, 0.96},
-     {{34361835904UL, 12583425UL}, 0.96},
-     {{34361835904UL, 4398059094528UL}, 0.96},
-     {{4398048608640UL, 12584448UL}, 0.96},
-     {{4398048608640UL, 34372321792UL}, 0.96},
-     {{4398048608640UL, 12583425UL}, 0.96},
-     {{4398048608640UL, 8796105605632UL}, 0.96},
-     {{2098048UL, 34372322304UL}, 0.96},
-     {{68721574272UL, 34372337664UL}, -0.96},
-     {{68721574272UL, 34640756736UL}, 0},
-     {{68721574272UL, 34372321792UL}, 0.96},
-     {{68721574272UL, 171811274752UL}, 0.96},
-     {{68721574272UL, 34372321281UL}, -0.96},
-     {{68721574272UL, 4432418832384UL}, 0.96},
-     {{4398048608640UL, 103091798016UL}, 0.96},
-     {{4398048608640UL, 34372321281UL}, -0.96},
-     {{4398048608640UL, 8830465343488UL}, 0.96},
-     {{2098048UL, 12583937UL}, -0.96},
-     {{34361835904UL, 68732059649UL}, 0.96},
-     {{34361835904UL, 12582915UL}, 0.96},
-     {{34361835904UL, 4398059094017UL}, -0.96},
-     {{2097538UL, 12599297UL}, -0.96},
-     {{2097538UL, 281018369UL}, -0.96},
-     {{2097538UL, 12583425UL}, -0.96},
-     {{2097538UL, 34372321281UL}, -0.96},
-     {{2097538UL, 12582917UL}, -0.96},
-     {{2097538UL, 4398059094017UL}, -0.96},
-     {{4398048608640UL, 12582915UL}, 0.96},
-     {{4398048608640UL, 8796105605121UL}, 0.96},
-     {{2098048UL, 4398059095040UL}, 0.96},
-     {{34361835904UL, 4466778570752UL}, 0.96},
-     {{34361835904UL, 13194152116224UL}, 0.96},
-     {{8796095119744UL, 4398059110400UL}, -0.96},
-     {{8796095119744UL, 4398327529472UL}, -0.96},
-     {{8796095119744UL, 4398059094528UL}, 0.96},
-     {{8796095119744UL, 4432418832384UL}, 0.96},
-     {{8796095119744UL, 4398059094017UL}, -0.96},
-     {{8796095119744UL, 21990245138432UL}, 0.96},
-     {{34395390080UL, 96468992UL}, 0.96},
-     {{34395390080UL, 29376512UL}, -0.96},
-     {{34395390080UL, 29360384UL}, 0.96},
-     {{34395390080UL, 29360129UL}, 0.96},
-     {{34361868416UL, 12664832UL}, -0.96},
-     {{34361868416UL, 281034752UL}, -0.96},
-     {{34361868416UL, 12599552UL}, -0.96},
-     {{34361868416UL, 68732076032UL}, -0.96},
-     {{34361868416UL, 12599297UL}, -0.96},
-     {{34361868416UL, 4398059110400UL}, -0.96},
-     {{34361835649UL, 12632064UL}, -0.96},
-     {{34361835649UL, 281034752UL}, -0.96},
-     {{34361835649UL, 12599552UL}, -0.96},
-     {{34361835649UL, 68732076032UL}, -0.96},
-     {{34361835649UL, 12599298UL}, -0.96},
-     {{34361835649UL, 4398059110400UL}, -0.96},
-     {{34361836160UL, 12599552UL}, -0.96},
-     {{34361836160UL, 281018624UL}, -0.96},
-     {{34361836160UL, 12584192UL}, 0.96},
-     {{34361836160UL, 68732059904UL}, 0.96},
-     {{34361836160UL, 12583169UL}, 0.96},
-     {{34361836160UL, 4398059094272UL}, 0.96},
-     {{103081312384UL, 12583680UL}, 0.96},
-     {{34361835650UL, 12599297UL}, -0.96},
-     {{34361835650UL, 281018369UL}, -0.96},
-     {{34361835650UL, 12583169UL}, 0.96},
-     {{34361835650UL, 68732059649UL}, 0.96},
-     {{34361835650UL, 12582917UL}, 0.96},
-     {{34361835650UL, 4398059094017UL}, -0.96},
-     {{2130049UL, 12664832UL}, -0.96},
-     {{2130049UL, 281034752UL}, -0.96},
-     {{2130049UL, 12599552UL}, -0.96},
-     {{2130049UL, 34372337664UL}, -0.96},
-     {{2130049UL, 12599298UL}, -0.96},
-     {{2130049UL, 4398059110400UL}, -0.96},
-     {{2097283UL, 12632064UL}, -0.96},
-     {{2097283UL, 281034752UL}, -0.96},
-     {{2097283UL, 12599552UL}, -0.96},
-     {{2097283UL, 34372337664UL}, -0.96},
-     {{2097283UL, 12599300UL}, -0.96},
-     {{2097283UL, 4398059110400UL}, -0.96},
-     {{4398048608385UL, 12632064UL}, -0.96},
-     {{4398048608385UL, 281034752UL}, -0.96},
-     {{4398048608385UL, 12599552UL}, -0.96},
-     {{4398048608385UL, 34372337664UL}, -0.96},
-     {{4398048608385UL, 12599298UL}, -0.96},
-     {{4398048608385UL, 8796105621504UL}, -0.96},
-     {{538968193UL, 281034752UL}, -0.96},
-     {{2097793UL, 12599552UL}, -0.96},
-     {{68721574017UL, 34372337664UL}, -0.96},
-     {{2097285UL, 12599298UL}, -0.96},
-     {{8796095119489UL, 4398059110400UL}, -0.96},
-     {{4398082162816UL, 96468992UL}, 0.96},
-     {{4398082162816UL, 29376512UL}, -0.96},
-     {{4398082162816UL, 297795584UL}, -0.96},
-     {{4398082162816UL, 29360384UL}, 0.96},
-     {{4398082162816UL, 34389098496UL}, 0.96},
-     {{4398082162816UL, 29360129UL}, 0.96},
-     {{4398082162816UL, 8796122382336UL}, 0.96},
-     {{4398048641152UL, 12664832UL}, -0.96},
-     {{4398048641152UL, 281034752UL}, -0.96},
-     {{4398048641152UL, 12599552UL}, -0.96},
-     {{4398048641152UL, 34372337664UL}, -0.96},
-     {{4398048641152UL, 12599297UL}, -0.96},
-     {{4398048641152UL, 8796105621504UL}, -0.96},
-     {{13194141630592UL, 12632064UL}, -0.96},
-     {{13194141630592UL, 281034752UL}, -0.96},
-     {{13194141630592UL, 12599552UL}, -0.96},
-     {{13194141630592UL, 34372337664UL}, -0.96},
-     {{13194141630592UL, 12599297UL}, -0.96},
-     {{13194141630592UL, 17592198643712UL}, -0.96},
-     {{4398585479296UL, 281034752UL}, -0.96},
-     {{4398585479296UL, 1354760192UL}, -0.96},
-     {{4398585479296UL, 281018624UL}, -0.96},
-     {{4398585479296UL, 34640756736UL}, -0.96},
-     {{4398585479296UL, 281018369UL}, -0.96},
-     {{4398585479296UL, 8796374040576UL}, -0.96},
-     {{13194141630592UL, 817889280UL}, -0.96},
-     {{13194141630592UL, 281018624UL}, -0.96},
-     {{13194141630592UL, 34640756736UL}, -0.96},
-     {{13194141630592UL, 281018369UL}, -0.96},
-     {{13194141630592UL, 17592467062784UL}, -0.96},
-     {{4398048608896UL, 12599552UL}, -0.96},
-     {{4398048608896UL, 281018624UL}, -0.96},
-     {{4398048608896UL, 12584192UL}, 0.96},
-     {{4398048608896UL, 34372321536UL}, 0.96},
-     {{4398048608896UL, 12583169UL}, 0.96},
-     {{4398048608896UL, 8796105605376UL}, 0.96},
-     {{13194141630592UL, 12583680UL}, 0.96},
-     {{13194141630592UL, 34372321536UL}, 0.96},
-     {{13194141630592UL, 12583169UL}, 0.96},
-     {{13194141630592UL, 17592198627584UL}, 0.96},
-     {{4466768085120UL, 34372337664UL}, -0.96},
-     {{4466768085120UL, 34640756736UL}, -0.96},
-     {{4466768085120UL, 34372321536UL}, 0.96},
-     {{4466768085120UL, 171811274752UL}, 0.96},
-     {{4466768085120UL, 34372321281UL}, -0.96},
-     {{4466768085120UL, 8830465343488UL}, 0.96},
-     {{13194141630592UL, 103091798016UL}, 0.96},
-     {{13194141630592UL, 34372321281UL}, -0.96},
-     {{13194141630592UL, 17626558365696UL}, 0.96},
-     {{4398048608386UL, 12599297UL}, -0.96},
-     {{4398048608386UL, 281018369UL}, -0.96},
-     {{4398048608386UL, 12583169UL}, 0.96},
-     {{4398048608386UL, 34372321281UL}, -0.96},
-     {{4398048608386UL, 12582917UL}, 0.96},
-     {{4398048608386UL, 8796105605121UL}, 0.96},
-     {{13194141630592UL, 12582915UL}, 0.96},
-     {{13194141630592UL, 17592198627329UL}, 0.96},
-     {{4398065385600UL, 26388291649536UL}, 0.96},
-     {{4398048608640UL, 26388291649536UL}, 0.96},
-     {{21990234652800UL, 8796105621504UL}, -0.96},
-     {{21990234652800UL, 8796374040576UL}, -0.96},
-     {{21990234652800UL, 8796105605376UL}, 0.96},
-     {{21990234652800UL, 8830465343488UL}, 0.96},
-     {{21990234652800UL, 8796105605121UL}, 0.96},
-     {{21990234652800UL, 43980477693952UL}, 0.96},
-     {{2195584UL, 12730368UL}, -0.96},
-     {{2195584UL, 281034752UL}, -0.96},
-     {{2195584UL, 12599552UL}, -0.96},
-     {{2195584UL, 34372337664UL}, 0.96},
-     {{2195584UL, 12599297UL}, 0.96},
-     {{2195584UL, 4398059110400UL}, -0.96},
-     {{2261120UL, 12664832UL}, -0.96},
-     {{2261120UL, 4538368UL}, 0},
-     {{2261120UL, 272711680UL}, 0.96},
-     {{2261120UL, 4276480UL}, -0.96},
-     {{2261120UL, 34364014592UL}, -0.96},
-     {{2261120UL, 4276225UL}, -0.96},
-     {{2261120UL, 4398050787328UL}, -0.96},
-     {{2130304UL, 4407296UL}, -0.96},
-     {{2130304UL, 272711680UL}, -0.96},
-     {{2130304UL, 4276736UL}, -0.96},
-     {{2130304UL, 34364014592UL}, -0.96},
-     {{2130304UL, 4276225UL}, -0.96},
-     {{2130304UL, 4398050787328UL}, -0.96},
-     {{34361868416UL, 4407296UL}, -0.96},
-     {{34361868416UL, 272711680UL}, -0.96},
-     {{34361868416UL, 4276480UL}, -0.96},
-     {{34361868416UL, 68723752960UL}, -0.96},
-     {{34361868416UL, 4276225UL}, -0.96},
-     {{34361868416UL, 4398050787328UL}, -0.96},
-     {{2130049UL, 4407296UL}, -0.96},
-     {{2130049UL, 272711680UL}, -0.96},
-     {{2130049UL, 4276480UL}, -0.96},
-     {{2130049UL, 34364014592UL}, -0.96},
-     {{2130049UL, 4276226UL}, -0.96},
-     {{2130049UL, 4398050787328UL}, -0.96},
-     {{4398048641152UL, 4407296UL}, -0.96},
-     {{4398048641152UL, 272711680UL}, -0.96},
-     {{4398048641152UL, 4276480UL}, -0.96},
-     {{4398048641152UL, 34364014592UL}, -0.96},
-     {{4398048641152UL, 4276225UL}, -0.96},
-     {{4398048641152UL, 8796097298432UL}, -0.96},
-     {{2195584UL, 272777216UL}, 0.96},
-     {{2195584UL, 809517056UL}, 0.96},
-     {{2195584UL, 272646400UL}, 0.96},
-     {{2195584UL, 34632384512UL}, 0.96},
-     {{2195584UL, 272646145UL}, 0.96},
-     {{2195584UL, 4398319157248UL}, 0.96},
-     {{539000960UL, 281034752UL}, -0.96},
-     {{539000960UL, 272711680UL}, 0.96},
-     {{539000960UL, 1346387968UL}, 0.96},
-     {{539000960UL, 272646400UL}, 0.96},
-     {{539000960UL, 34632384512UL}, 0.96},
-     {{539000960UL, 272646145UL}, 0.96},
-     {{539000960UL, 4398319157248UL}, 0.96},
-     {{2130304UL, 809517056UL}, 0.96},
-     {{2130304UL, 272646656UL}, 0.96},
-     {{2130304UL, 34632384512UL}, 0.96},
-     {{2130304UL, 272646145UL}, 0.96},
-     {{2130304UL, 4398319157248UL}, 0.96},
-     {{34361868416UL, 809517056UL}, -0.96},
-     {{34361868416UL, 272646400UL}, 0.96},
-     {{34361868416UL, 68992122880UL}, -0.96},
-     {{34361868416UL, 272646145UL}, 0.96},
-     {{34361868416UL, 4398319157248UL}, 0.96},
-     {{2130049UL, 809517056UL}, -0.96},
-     {{2130049UL, 272646400UL}, 0.96},
-     {{2130049UL, 34632384512UL}, 0.96},
-     {{2130049UL, 272646146UL}, 0.96},
-     {{2130049UL, 4398319157248UL}, 0.96},
-     {{4398048641152UL, 809517056UL}, -0.96},
-     {{4398048641152UL, 272646400UL}, 0.96},
-     {{4398048641152UL, 34632384512UL}, 0.96},
-     {{4398048641152UL, 272646145UL}, 0.96},
-     {{4398048641152UL, 8796365668352UL}, 0.96},
-     {{2195584UL, 4342016UL}, 0.96},
-     {{2195584UL, 4211456UL}, 0.96},
-     {{2195584UL, 34363949312UL}, 0.96},
-     {{2195584UL, 4210945UL}, 0.96},
-     {{2195584UL, 4398050722048UL}, 0.96},
-     {{2130560UL, 12599552UL}, -0.96},
-     {{2130560UL, 4276480UL}, -0.96},
-     {{2130560UL, 272646400UL}, 0.96},
-     {{2130560UL, 4211968UL}, -0.96},
-     {{2130560UL, 34363949312UL}, 0.96},
-     {{2130560UL, 4210945UL}, 0.96},
-     {{2130560UL, 4398050722048UL}, 0},
-     {{34361868416UL, 4211456UL}, 0},
-     {{34361868416UL, 68723687680UL}, -0.96},
-     {{34361868416UL, 4210945UL}, 0.96},
-     {{34361868416UL, 4398050722048UL}, -0.96},
-     {{2130049UL, 4211456UL}, -0.96},
-     {{2130049UL, 34363949312UL}, -0.96},
-     {{2130049UL, 4210946UL}, 0.96},
-     {{2130049UL, 4398050722048UL}, -0.96},
-     {{4398048641152UL, 4211456UL}, 0.96},
-     {{4398048641152UL, 34363949312UL}, 0.96},
-     {{4398048641152UL, 4210945UL}, 0.96},
-     {{4398048641152UL, 8796097233152UL}, 0.96},
-     {{2195584UL, 34364080128UL}, 0.96},
-     {{2195584UL, 103083425792UL}, 0},
-     {{2195584UL, 34363949057UL}, 0.96},
-     {{2195584UL, 4432410460160UL}, 0.96},
-     {{2130304UL, 34363949568UL}, 0.96},
-     {{2130304UL, 103083425792UL}, 0.96},
-     {{2130304UL, 34363949057UL}, 0.96},
-     {{2130304UL, 4432410460160UL}, 0.96},
-     {{68721606784UL, 34372337664UL}, -0.96},
-     {{68721606784UL, 34364014592UL}, 0},
-     {{68721606784UL, 34632384512UL}, 0.96},
-     {{68721606784UL, 34363949312UL}, 0.96},
-     {{68721606784UL, 171802902528UL}, 0.96},
-     {{68721606784UL, 34363949057UL}, 0.96},
-     {{68721606784UL, 4432410460160UL}, 0.96},
-     {{2130049UL, 103083425792UL}, -0.96},
-     {{2130049UL, 34363949058UL}, 0.96},
-     {{2130049UL, 4432410460160UL}, 0},
-     {{4398048641152UL, 103083425792UL}, -0.96},
-     {{4398048641152UL, 34363949057UL}, 0.96},
-     {{4398048641152UL, 8830456971264UL}, -0.96},
-     {{2195584UL, 4341761UL}, 0.96},
-     {{2195584UL, 4210691UL}, 0.96},
-     {{2195584UL, 4398050721793UL}, 0.96},
-     {{2130304UL, 4211201UL}, -0.96},
-     {{2130304UL, 4210691UL}, 0.96},
-     {{2130304UL, 4398050721793UL}, 0.96},
-     {{34361868416UL, 68723687425UL}, 0.96},
-     {{34361868416UL, 4210691UL}, 0.96},
-     {{34361868416UL, 4398050721793UL}, 0.96},
-     {{2130050UL, 12599297UL}, -0.96},
-     {{2130050UL, 4276225UL}, -0.96},
-     {{2130050UL, 272646145UL}, 0.96},
-     {{2130050UL, 4210945UL}, 0.96},
-     {{2130050UL, 34363949057UL}, 0.96},
-     {{2130050UL, 4210693UL}, 0.96},
-     {{2130050UL, 4398050721793UL}, 0},
-     {{4398048641152UL, 4210691UL}, 0.96},
-     {{4398048641152UL, 8796097232897UL}, 0.96},
-     {{2195584UL, 4398050852864UL}, 0.96},
-     {{2195584UL, 13194143744000UL}, 0.96},
-     {{2130304UL, 4398050722304UL}, -0.96},
-     {{2130304UL, 13194143744000UL}, 0.96},
-     {{34361868416UL, 4466770198528UL}, -0.96},
-     {{34361868416UL, 13194143744000UL}, 0},
-     {{2130049UL, 4398050721794UL}, 0},
-     {{2130049UL, 13194143744000UL}, -0.96},
-     {{8796095152256UL, 4398059110400UL}, -0.96},
-     {{8796095152256UL, 4398050787328UL}, 0},
-     {{8796095152256UL, 4398319157248UL}, 0.96},
-     {{8796095152256UL, 4398050722048UL}, 0.96},
-     {{8796095152256UL, 4432410460160UL}, 0.96},
-     {{8796095152256UL, 4398050721793UL}, 0.96},
-     {{8796095152256UL, 21990236766208UL}, 0},
-     {{2163072UL, 12632064UL}, 0.96},
-     {{2163072UL, 4374528UL}, 0.96},
-     {{2163072UL, 272678912UL}, 0.96},
-     {{2163072UL, 4243968UL}, -0.96},
-     {{2163072UL, 34363981824UL}, 0.96},
-     {{2163072UL, 4243457UL}, 0.96},
-     {{2163072UL, 4398050754560UL}, 0.96},
-     {{2098048UL, 4244480UL}, 0.96},
-     {{34361835904UL, 272678912UL}, 0.96},
-     {{34361835904UL, 4243968UL}, -0.96},
-     {{34361835904UL, 68723720192UL}, -0.96},
-     {{34361835904UL, 4243457UL}, 0.96},
-     {{34361835904UL, 4398050754560UL}, 0},
-     {{2097537UL, 272678912UL}, 0.96},
-     {{2097537UL, 4243968UL}, -0.96},
-     {{2097537UL, 34363981824UL}, 0.96},
-     {{2097537UL, 4243458UL}, 0.96},
-     {{2097537UL, 4398050754560UL}, 0.96},
-     {{4398048608640UL, 272678912UL}, 0.96},
-     {{4398048608640UL, 4243968UL}, -0.96},
-     {{4398048608640UL, 34363981824UL}, -0.96},
-     {{4398048608640UL, 4243457UL}, 0.96},
-     {{4398048608640UL, 8796097265664UL}, 0.96},
-     {{538968448UL, 272678912UL}, 0.96},
-     {{538968448UL, 1346387968UL}, -0.96},
-     {{538968448UL, 272646656UL}, 0.96},
-     {{538968448UL, 34632384512UL}, 0.96},
-     {{538968448UL, 272646145UL}, 0.96},
-     {{538968448UL, 4398319157248UL}, 0.96},
-     {{2098048UL, 272647168UL}, 0.96},
-     {{34361835904UL, 809517056UL}, -0.96},
-     {{34361835904UL, 272646656UL}, -0.96},
-     {{34361835904UL, 68992122880UL}, -0.96},
-     {{34361835904UL, 272646145UL}, 0.96},
-     {{34361835904UL, 4398319157248UL}, 0.96},
-     {{2097537UL, 809517056UL}, 0.96},
-     {{2097537UL, 272646656UL}, -0.96},
-     {{2097537UL, 34632384512UL}, 0.96},
-     {{2097537UL, 272646146UL}, 0.96},
-     {{2097537UL, 4398319157248UL}, 0.96},
-     {{4398048608640UL, 809517056UL}, 0.96},
-     {{4398048608640UL, 272646656UL}, -0.96},
-     {{4398048608640UL, 34632384512UL}, 0.96},
-     {{4398048608640UL, 272646145UL}, 0.96},
-     {{4398048608640UL, 8796365668352UL}, 0.96},
-     {{10486144UL, 4212224UL}, 0.96},
-     {{2130304UL, 4212224UL}, -0.96},
-     {{270532992UL, 4212224UL}, -0.96},
-     {{2098560UL, 4243968UL}, -0.96},
-     {{2098560UL, 272646656UL}, 0.96},
-     {{2098560UL, 4213248UL}, -0.96},
-     {{2098560UL, 34363949568UL}, -0.96},
-     {{2098560UL, 4211201UL}, 0.96},
-     {{2098560UL, 4398050722304UL}, -0.96},
-     {{34361835904UL, 4212224UL}, -0.96},
-     {{34361835904UL, 68723687936UL}, -0.96},
-     {{34361835904UL, 4211201UL}, -0.96},
-     {{34361835904UL, 4398050722304UL}, -0.96},
-     {{2097537UL, 4212224UL}, -0.96},
-     {{2097537UL, 34363949568UL}, -0.96},
-     {{2097537UL, 4211202UL}, -0.96},
-     {{2097537UL, 4398050722304UL}, -0.96},
-     {{4398048608640UL, 4212224UL}, -0.96},
-     {{4398048608640UL, 34363949568UL}, -0.96},
-     {{4398048608640UL, 4211201UL}, -0.96},
-     {{4398048608640UL, 8796097233408UL}, -0.96},
-     {{2098048UL, 34363950080UL}, 0.96},
-     {{68721574272UL, 34363981824UL}, 0.96},
-     {{68721574272UL, 34632384512UL}, 0.96},
-     {{68721574272UL, 34363949568UL}, 0.96},
-     {{68721574272UL, 171802902528UL}, 0.96},
-     {{68721574272UL, 34363949057UL}, 0.96},
-     {{68721574272UL, 4432410460160UL}, 0.96},
-     {{2097537UL, 103083425792UL}, -0.96},
-     {{2097537UL, 34363949058UL}, 0.96},
-     {{2097537UL, 4432410460160UL}, 0.96},
-     {{4398048608640UL, 103083425792UL}, -0.96},
-     {{4398048608640UL, 34363949057UL}, 0.96},
-     {{4398048608640UL, 8830456971264UL}, -0.96},
-     {{2098048UL, 4211713UL}, 0.96},
-     {{34361835904UL, 68723687425UL}, 0},
-     {{34361835904UL, 4210691UL}, 0.96},
-     {{34361835904UL, 4398050721793UL}, 0},
-     {{2097538UL, 4243457UL}, 0.96},
-     {{2097538UL, 272646145UL}, 0.96},
-     {{2097538UL, 4211201UL}, -0.96},
-     {{2097538UL, 34363949057UL}, 0.96},
-     {{2097538UL, 4210693UL}, 0.96},
-     {{2097538UL, 4398050721793UL}, 0.96},
-     {{4398048608640UL, 4210691UL}, 0.96},
-     {{4398048608640UL, 8796097232897UL}, 0.96},
-     {{2098048UL, 4398050722816UL}, 0.96},
-     {{34361835904UL, 4466770198528UL}, -0.96},
-     {{34361835904UL, 13194143744000UL}, -0.96},
-     {{2097537UL, 4398050721794UL}, 0.96},
-     {{2097537UL, 13194143744000UL}, 0.96},
-     {{8796095119744UL, 4398050754560UL}, -0.96},
-     {{8796095119744UL, 4398319157248UL}, 0.96},
-     {{8796095119744UL, 4398050722304UL}, -0.96},
-     {{8796095119744UL, 4432410460160UL}, 0.96},
-     {{8796095119744UL, 4398050721793UL}, 0.96},
-     {{8796095119744UL, 21990236766208UL}, 0.96},
-     {{34361901184UL, 12632064UL}, -0.96},
-     {{34361901184UL, 4374528UL}, -0.96},
-     {{34361901184UL, 272678912UL}, -0.96},
-     {{34361901184UL, 4243712UL}, -0.96},
-     {{34361901184UL, 68723720192UL}, -0.96},
-     {{34361901184UL, 4243457UL}, 0},
-     {{34361901184UL, 4398050754560UL}, -0.96},
-     {{103081312384UL, 4243712UL}, -0.96},
-     {{103081312384UL, 137443196928UL}, -0.96},
-     {{103081312384UL, 4243457UL}, -0.96},
-     {{103081312384UL, 4398050754560UL}, -0.96},
-     {{34361835649UL, 272678912UL}, -0.96},
-     {{34361835649UL, 68723720192UL}, -0.96},
-     {{34361835649UL, 4398050754560UL}, -0.96},
-     {{4432408346752UL, 272678912UL}, -0.96},
-     {{34361835649UL, 272646400UL}, -0.96},
-     {{34361835649UL, 68992122880UL}, -0.96},
-     {{34361835649UL, 272646146UL}, -0.96},
-     {{34361835649UL, 4398319157248UL}, -0.96},
-     {{34361836160UL, 4243712UL}, -0.96},
-     {{34361836160UL, 272646400UL}, -0.96},
-     {{34361836160UL, 4211968UL}, -0.96},
-     {{34361836160UL, 68723687680UL}, -0.96},
-     {{34361836160UL, 4210945UL}, -0.96},
-     {{34361836160UL, 4398050722048UL}, -0.96},
-     {{103081312384UL, 4211456UL}, -0.96},
-     {{103081312384UL, 137443164416UL}, -0.96},
-     {{103081312384UL, 4210945UL}, -0.96},
-     {{103081312384UL, 4398050722048UL}, -0.96},
-     {{34361835649UL, 4211456UL}, -0.96},
-     {{34361835649UL, 68723687680UL}, -0.96},
-     {{34361835649UL, 4398050722048UL}, -0.96},
-     {{34361868416UL, 206162640896UL}, -0.96},
-     {{34361835904UL, 206162640896UL}, -0.96},
-     {{171800789120UL, 68723720192UL}, -0.96},
-     {{171800789120UL, 68723687680UL}, -0.96},
-     {{171800789120UL, 343601594368UL}, -0.96},
-     {{171800789120UL, 68723687425UL}, -0.96},
-     {{171800789120UL, 4466770198528UL}, -0.96},
-     {{34361835649UL, 206162640896UL}, -0.96},
-     {{34361835649UL, 68723687426UL}, -0.96},
-     {{34361835649UL, 4466770198528UL}, -0.96},
-     {{103081312384UL, 137443164161UL}, -0.96},
-     {{103081312384UL, 4210691UL}, 0},
-     {{103081312384UL, 4398050721793UL}, 0.96},
-     {{34361835650UL, 4243457UL}, -0.96},
-     {{34361835650UL, 272646145UL}, 0.96},
-     {{34361835650UL, 4210945UL}, -0.96},
-     {{34361835650UL, 68723687425UL}, 0.96},
-     {{34361835650UL, 4210693UL}, 0.96},
-     {{34361835650UL, 4398050721793UL}, -0.96},
-     {{103081312384UL, 4535489675264UL}, -0.96},
-     {{103081312384UL, 13194143744000UL}, 0},
-     {{34361835649UL, 4398050721794UL}, -0.96},
-     {{34361835649UL, 13194143744000UL}, -0.96},
-     {{8830454857856UL, 4398050754560UL}, -0.96},
-     {{8830454857856UL, 4398050722048UL}, -0.96},
-     {{8830454857856UL, 4466770198528UL}, -0.96},
-     {{8830454857856UL, 4398050721793UL}, -0.96},
-     {{8830454857856UL, 21990236766208UL}, -0.96},
-     {{2162817UL, 12632064UL}, -0.96},
-     {{2162817UL, 4374528UL}, -0.96},
-     {{2162817UL, 272678912UL}, 0.96},
-     {{2162817UL, 34363981824UL}, 0},
-     {{2162817UL, 4398050754560UL}, -0.96},
-     {{2097283UL, 272678912UL}, -0.96},
-     {{2097283UL, 4243712UL}, -0.96},
-     {{2097283UL, 34363981824UL}, -0.96},
-     {{2097283UL, 4243460UL}, -0.96},
-     {{2097283UL, 4398050754560UL}, -0.96},
-     {{4398048608385UL, 272678912UL}, -0.96},
-     {{4398048608385UL, 34363981824UL}, -0.96},
-     {{4398048608385UL, 8796097265664UL}, -0.96},
-     {{538968193UL, 272678912UL}, 0.96},
-     {{538968193UL, 1346387968UL}, -0.96},
-     {{538968193UL, 272646400UL}, 0.96},
-     {{538968193UL, 34632384512UL}, 0.96},
-     {{538968193UL, 272646146UL}, 0.96},
-     {{538968193UL, 4398319157248UL}, 0.96},
-     {{2097283UL, 809517056UL}, -0.96},
-     {{2097283UL, 272646400UL}, -0.96},
-     {{2097283UL, 34632384512UL}, -0.96},
-     {{2097283UL, 272646148UL}, 0.96},
-     {{2097283UL, 4398319157248UL}, 0.96},
-     {{4398048608385UL, 809517056UL}, -0.96},
-     {{4398048608385UL, 272646400UL}, -0.96},
-     {{4398048608385UL, 34632384512UL}, -0.96},
-     {{4398048608385UL, 272646146UL}, -0.96},
-     {{4398048608385UL, 8796365668352UL}, 0.96},
-     {{2097793UL, 272646400UL}, -0.96},
-     {{2097793UL, 4211968UL}, -0.96},
-     {{2097793UL, 34363949312UL}, -0.96},
-     {{2097793UL, 4398050722048UL}, -0.96},
-     {{2097283UL, 4211456UL}, -0.96},
-     {{2097283UL, 34363949312UL}, -0.96},
-     {{2097283UL, 4210948UL}, -0.96},
-     {{2097283UL, 4398050722048UL}, -0.96},
-     {{4398048608385UL, 4211456UL}, -0.96},
-     {{4398048608385UL, 34363949312UL}, -0.96},
-     {{4398048608385UL, 8796097233152UL}, -0.96},
-     {{68721574017UL, 34363981824UL}, -0.96},
-     {{68721574017UL, 34632384512UL}, 0},
-     {{68721574017UL, 34363949312UL}, -0.96},
-     {{68721574017UL, 171802902528UL}, -0.96},
-     {{68721574017UL, 34363949058UL}, 0},
-     {{68721574017UL, 4432410460160UL}, 0},
-     {{2097283UL, 103083425792UL}, -0.96},
-     {{2097283UL, 34363949060UL}, -0.96},
-     {{2097283UL, 4432410460160UL}, 0},
-     {{4398048608385UL, 103083425792UL}, -0.96},
-     {{4398048608385UL, 34363949058UL}, -0.96},
-     {{4398048608385UL, 8830456971264UL}, -0.96},
-     {{2130049UL, 4210694UL}, 0.96},
-     {{2097537UL, 4210694UL}, 0.96},
-     {{34361835649UL, 4210694UL}, -0.96},
-     {{2097285UL, 272646146UL}, -0.96},
-     {{2097285UL, 34363949058UL}, -0.96},
-     {{2097285UL, 4210698UL}, -0.96},
-     {{2097285UL, 4398050721794UL}, -0.96},
-     {{4398048608385UL, 4210694UL}, -0.96},
-     {{4398048608385UL, 8796097232898UL}, -0.96},
-     {{2097283UL, 4398050721796UL}, -0.96},
-     {{2097283UL, 13194143744000UL}, 0.96},
-     {{8796095119489UL, 4398050754560UL}, -0.96},
-     {{8796095119489UL, 4398319157248UL}, 0.96},
-     {{8796095119489UL, 4398050722048UL}, -0.96},
-     {{8796095119489UL, 4432410460160UL}, -0.96},
-     {{8796095119489UL, 4398050721794UL}, -0.96},
-     {{8796095119489UL, 21990236766208UL}, -0.96},
-     {{4398048673920UL, 12632064UL}, -0.96},
-     {{4398048673920UL, 4374528UL}, -0.96},
-     {{4398048673920UL, 272678912UL}, 0.96},
-     {{4398048673920UL, 4243712UL}, -0.96},
-     {{4398048673920UL, 34363981824UL}, -0.96},
-     {{4398048673920UL, 4243457UL}, 0.96},
-     {{4398048673920UL, 8796097265664UL}, 0.96},
-     {{13194141630592UL, 272678912UL}, -0.96},
-     {{13194141630592UL, 4243712UL}, -0.96},
-     {{13194141630592UL, 34363981824UL}, -0.96},
-     {{13194141630592UL, 4243457UL}, -0.96},
-     {{13194141630592UL, 17592190287872UL}, -0.96},
-     {{4398585479296UL, 272678912UL}, 0.96},
-     {{4398585479296UL, 1346387968UL}, -0.96},
-     {{4398585479296UL, 272646400UL}, 0.96},
-     {{4398585479296UL, 34632384512UL}, 0.96},
-     {{4398585479296UL, 272646145UL}, 0},
-     {{4398585479296UL, 8796365668352UL}, 0.96},
-     {{13194141630592UL, 809517056UL}, -0.96},
-     {{13194141630592UL, 272646400UL}, -0.96},
-     {{13194141630592UL, 34632384512UL}, -0.96},
-     {{13194141630592UL, 272646145UL}, -0.96},
-     {{13194141630592UL, 17592458690560UL}, 0.96},
-     {{4398048608896UL, 4243712UL}, -0.96},
-     {{4398048608896UL, 272646400UL}, -0.96},
-     {{4398048608896UL, 4211968UL}, -0.96},
-     {{4398048608896UL, 34363949312UL}, -0.96},
-     {{4398048608896UL, 4210945UL}, -0.96},
-     {{4398048608896UL, 8796097233152UL}, -0.96},
-     {{13194141630592UL, 4211456UL}, -0.96},
-     {{13194141630592UL, 34363949312UL}, -0.96},
-     {{13194141630592UL, 4210945UL}, -0.96},
-     {{13194141630592UL, 17592190255360UL}, -0.96},
-     {{4466768085120UL, 34363981824UL}, -0.96},
-     {{4466768085120UL, 34632384512UL}, -0.96},
-     {{4466768085120UL, 34363949312UL}, -0.96},
-     {{4466768085120UL, 171802902528UL}, -0.96},
-     {{4466768085120UL, 34363949057UL}, 0.96},
-     {{4466768085120UL, 8830456971264UL}, 0},
-     {{13194141630592UL, 103083425792UL}, -0.96},
-     {{13194141630592UL, 34363949057UL}, -0.96},
-     {{13194141630592UL, 17626549993472UL}, -0.96},
-     {{4398048608386UL, 4243457UL}, -0.96},
-     {{4398048608386UL, 272646145UL}, 0.96},
-     {{4398048608386UL, 4210945UL}, -0.96},
-     {{4398048608386UL, 34363949057UL}, -0.96},
-     {{4398048608386UL, 4210693UL}, 0.96},
-     {{4398048608386UL, 8796097232897UL}, 0.96},
-     {{13194141630592UL, 4210691UL}, 0.96},
-     {{13194141630592UL, 17592190255105UL}, 0},
-     {{4398048641152UL, 26388283277312UL}, 0.96},
-     {{4398048608640UL, 26388283277312UL}, 0.96},
-     {{4398048608385UL, 26388283277312UL}, 0},
-     {{21990234652800UL, 8796097265664UL}, -0.96},
-     {{21990234652800UL, 8796365668352UL}, 0.96},
-     {{21990234652800UL, 8796097233152UL}, 0.96},
-     {{21990234652800UL, 8830456971264UL}, -0.96},
-     {{21990234652800UL, 8796097232897UL}, 0.96},
-     {{21990234652800UL, 43980469321728UL}, 0.96},
-     {{1612710016UL, 281034752UL}, 0},
-     {{1612710016UL, 2428502016UL}, -0.96},
-     {{1612710016UL, 281018624UL}, -0.96},
-     {{1612710016UL, 34640756736UL}, 0.96},
-     {{1612710016UL, 281018369UL}, -0.96},
-     {{1612710016UL, 4398327529472UL}, 0.96},
-     {{1612710016UL, 272678912UL}, 0.96},
-     {{1612710016UL, 2420129792UL}, 0.96},
-     {{1612710016UL, 272646400UL}, 0.96},
-     {{1612710016UL, 34632384512UL}, 0.96},
-     {{1612710016UL, 272646145UL}, 0.96},
-     {{1612710016UL, 4398319157248UL}, 0.96},
-     {{2686451840UL, 1354760192UL}, -0.96},
-     {{2686451840UL, 1346387968UL}, 0.96},
-     {{2686451840UL, 5641338880UL}, 0.96},
-     {{2686451840UL, 1346371840UL}, 0},
-     {{2686451840UL, 35706109952UL}, 0.96},
-     {{2686451840UL, 1346371585UL}, 0},
-     {{2686451840UL, 4399392882688UL}, 0.96},
-     {{538968448UL, 3493855232UL}, -0.96},
-     {{538968448UL, 1346372096UL}, 0.96},
-     {{538968448UL, 35706109952UL}, 0},
-     {{538968448UL, 1346371585UL}, -0.96},
-     {{538968448UL, 4399392882688UL}, 0.96},
-     {{4398585479296UL, 3493855232UL}, -0.96},
-     {{4398585479296UL, 1346371840UL}, -0.96},
-     {{4398585479296UL, 35706109952UL}, -0.96},
-     {{4398585479296UL, 1346371585UL}, -0.96},
-     {{4398585479296UL, 8797439393792UL}, -0.96},
-     {{1612710016UL, 2420113664UL}, 0.96},
-     {{1612710016UL, 272630528UL}, 0.96},
-     {{1612710016UL, 34632368384UL}, 0.96},
-     {{1612710016UL, 272630017UL}, 0.96},
-     {{1612710016UL, 4398319141120UL}, 0.96},
-     {{538968704UL, 281018624UL}, -0.96},
-     {{538968704UL, 272646400UL}, 0.96},
-     {{538968704UL, 1346371840UL}, 0},
-     {{538968704UL, 272631040UL}, 0},
-     {{538968704UL, 34632368384UL}, 0.96},
-     {{538968704UL, 272630017UL}, -0.96},
-     {{538968704UL, 4398319141120UL}, 0.96},
-     {{4398585479296UL, 272630528UL}, -0.96},
-     {{4398585479296UL, 34632368384UL}, 0.96},
-     {{4398585479296UL, 272630017UL}, -0.96},
-     {{4398585479296UL, 8796365652224UL}, 0.96},
-     {{1612710016UL, 36779851776UL}, 0.96},
-     {{1612710016UL, 103351844864UL}, 0.96},
-     {{1612710016UL, 34632368129UL}, 0.96},
-     {{1612710016UL, 4432678879232UL}, 0.96},
-     {{538968448UL, 34632368640UL}, 0.96},
-     {{538968448UL, 103351844864UL}, 0.96},
-     {{538968448UL, 34632368129UL}, 0.96},
-     {{538968448UL, 4432678879232UL}, 0.96},
-     {{69258444928UL, 34640756736UL}, -0.96},
-     {{69258444928UL, 34632384512UL}, 0.96},
-     {{69258444928UL, 35706109952UL}, -0.96},
-     {{69258444928UL, 34632368384UL}, 0.96},
-     {{69258444928UL, 172071321600UL}, 0},
-     {{69258444928UL, 34632368129UL}, 0.96},
-     {{69258444928UL, 4432678879232UL}, 0.96},
-     {{4398585479296UL, 103351844864UL}, 0.96},
-     {{4398585479296UL, 34632368129UL}, 0},
-     {{4398585479296UL, 8830725390336UL}, 0.96},
-     {{1612710016UL, 2420113409UL}, 0.96},
-     {{1612710016UL, 272629763UL}, 0.96},
-     {{1612710016UL, 4398319140865UL}, 0.96},
-     {{538968448UL, 272630273UL}, 0.96},
-     {{538968448UL, 272629763UL}, 0.96},
-     {{538968448UL, 4398319140865UL}, 0.96},
-     {{538968194UL, 281018369UL}, -0.96},
-     {{538968194UL, 272646145UL}, 0.96},
-     {{538968194UL, 1346371585UL}, 0},
-     {{538968194UL, 272630017UL}, 0},
-     {{538968194UL, 34632368129UL}, 0.96},
-     {{538968194UL, 272629765UL}, 0.96},
-     {{538968194UL, 4398319140865UL}, 0.96},
-     {{4398585479296UL, 272629763UL}, -0.96},
-     {{4398585479296UL, 8796365651969UL}, 0},
-     {{1612710016UL, 4400466624512UL}, 0.96},
-     {{1612710016UL, 13194412163072UL}, 0.96},
-     {{538968448UL, 4398319141376UL}, 0.96},
-     {{538968448UL, 13194412163072UL}, 0.96},
-     {{8796631990400UL, 4398327529472UL}, -0.96},
-     {{8796631990400UL, 4398319157248UL}, 0.96},
-     {{8796631990400UL, 4399392882688UL}, 0},
-     {{8796631990400UL, 4398319141120UL}, 0.96},
-     {{8796631990400UL, 4432678879232UL}, 0.96},
-     {{8796631990400UL, 4398319140865UL}, 0.96},
-     {{8796631990400UL, 21990505185280UL}, 0.96},
-     {{1075839360UL, 817889280UL}, 0.96},
-     {{1075839360UL, 809517056UL}, 0.96},
-     {{1075839360UL, 2956984320UL}, 0.96},
-     {{1075839360UL, 809501184UL}, 0.96},
-     {{1075839360UL, 35169239040UL}, 0.96},
-     {{1075839360UL, 809500673UL}, 0.96},
-     {{1075839360UL, 4398856011776UL}, 0.96},
-     {{2098048UL, 809501696UL}, 0.96},
-     {{4398048608640UL, 809501184UL}, -0.96},
-     {{4398048608640UL, 35169239040UL}, -0.96},
-     {{4398048608640UL, 809500673UL}, 0.96},
-     {{4398048608640UL, 8796902522880UL}, 0.96},
-     {{10486144UL, 272631296UL}, 0.96},
-     {{538968448UL, 272631296UL}, -0.96},
-     {{2098560UL, 809501184UL}, -0.96},
-     {{2098560UL, 272632320UL}, 0.96},
-     {{2098560UL, 34632368640UL}, 0.96},
-     {{2098560UL, 272630273UL}, 0.96},
-     {{2098560UL, 4398319141376UL}, 0.96},
-     {{34361835904UL, 272631296UL}, -0.96},
-     {{4398048608640UL, 272631296UL}, -0.96},
-     {{4398048608640UL, 34632368640UL}, -0.96},
-     {{4398048608640UL, 272630273UL}, -0.96},
-     {{4398048608640UL, 8796365652480UL}, -0.96},
-     {{2098048UL, 34632369152UL}, 0.96},
-     {{68721574272UL, 35169239040UL}, 0.96},
-     {{68721574272UL, 34632368640UL}, 0.96},
-     {{68721574272UL, 172071321600UL}, 0.96},
-     {{68721574272UL, 34632368129UL}, 0.96},
-     {{68721574272UL, 4432678879232UL}, 0.96},
-     {{4398048608640UL, 103351844864UL}, -0.96},
-     {{4398048608640UL, 34632368129UL}, 0.96},
-     {{4398048608640UL, 8830725390336UL}, 0.96},
-     {{2098048UL, 272630785UL}, 0.96},
-     {{2097538UL, 809500673UL}, 0.96},
-     {{2097538UL, 272630273UL}, -0.96},
-     {{2097538UL, 34632368129UL}, 0.96},
-     {{2097538UL, 272629765UL}, 0.96},
-     {{2097538UL, 4398319140865UL}, 0.96},
-     {{4398048608640UL, 272629763UL}, 0.96},
-     {{4398048608640UL, 8796365651969UL}, 0.96},
-     {{2098048UL, 4398319141888UL}, 0.96},
-     {{8796095119744UL, 4398856011776UL}, 0.96},
-     {{8796095119744UL, 4398319141376UL}, 0.96},
-     {{8796095119744UL, 4432678879232UL}, 0.96},
-     {{8796095119744UL, 4398319140865UL}, 0.96},
-     {{8796095119744UL, 21990505185280UL}, 0.96},
-     {{1075839105UL, 809517056UL}, -0.96},
-     {{4399122350208UL, 817889280UL}, -0.96},
-     {{4399122350208UL, 809517056UL}, -0.96},
-     {{4399122350208UL, 2956984320UL}, -0.96},
-     {{4399122350208UL, 809500928UL}, -0.96},
-     {{4399122350208UL, 35169239040UL}, 0.96},
-     {{4399122350208UL, 809500673UL}, -0.96},
-     {{4399122350208UL, 8796902522880UL}, 0.96},
-     {{13194141630592UL, 809500928UL}, -0.96},
-     {{13194141630592UL, 35169239040UL}, -0.96},
-     {{13194141630592UL, 809500673UL}, -0.96},
-     {{13194141630592UL, 17592995545088UL}, -0.96},
-     {{4398048608896UL, 809500928UL}, -0.96},
-     {{4398048608896UL, 272631040UL}, -0.96},
-     {{4398048608896UL, 34632368384UL}, 0},
-     {{4398048608896UL, 272630017UL}, -0.96},
-     {{4398048608896UL, 8796365652224UL}, -0.96},
-     {{13194141630592UL, 272630528UL}, -0.96},
-     {{13194141630592UL, 34632368384UL}, 0.96},
-     {{13194141630592UL, 272630017UL}, -0.96},
-     {{13194141630592UL, 17592458674432UL}, -0.96},
-     {{4466768085120UL, 35169239040UL}, 0.96},
-     {{4466768085120UL, 34632368384UL}, -0.96},
-     {{4466768085120UL, 172071321600UL}, -0.96},
-     {{4466768085120UL, 34632368129UL}, 0.96},
-     {{4466768085120UL, 8830725390336UL}, 0.96},
-     {{13194141630592UL, 103351844864UL}, 0},
-     {{13194141630592UL, 34632368129UL}, 0.96},
-     {{13194141630592UL, 17626818412544UL}, 0},
-     {{4398048608386UL, 809500673UL}, -0.96},
-     {{4398048608386UL, 272630017UL}, -0.96},
-     {{4398048608386UL, 34632368129UL}, -0.96},
-     {{4398048608386UL, 272629765UL}, -0.96},
-     {{4398048608386UL, 8796365651969UL}, -0.96},
-     {{13194141630592UL, 272629763UL}, -0.96},
-     {{13194141630592UL, 17592458674177UL}, -0.96},
-     {{4398585479296UL, 26388551696384UL}, 0.96},
-     {{4398048608640UL, 26388551696384UL}, 0.96},
-     {{21990234652800UL, 8796902522880UL}, -0.96},
-     {{21990234652800UL, 8796365652224UL}, -0.96},
-     {{21990234652800UL, 8830725390336UL}, 0.96},
-     {{21990234652800UL, 8796365651969UL}, -0.96},
-     {{21990234652800UL, 43980737740800UL}, 0.96},
-     {{27263104UL, 37749504UL}, 0.96},
-     {{10486912UL, 20972288UL}, 0.96},
-     {{10486912UL, 4211456UL}, 0.96},
-     {{10486912UL, 272630528UL}, 0.96},
-     {{10486912UL, 4197120UL}, 0.96},
-     {{10486912UL, 34363933440UL}, 0.96},
-     {{10486912UL, 4195073UL}, 0.96},
-     {{10486912UL, 4398050706176UL}, 0.96},
-     {{34370224256UL, 68723671808UL}, 0.96},
-     {{4398056996992UL, 8796097217280UL}, 0.96},
-     {{270533760UL, 4211456UL}, -0.96},
-     {{2098816UL, 12599552UL}, -0.96},
-     {{2098816UL, 281018624UL}, -0.96},
-     {{2098816UL, 12585216UL}, 0.96},
-     {{2098816UL, 34372321536UL}, 0.96},
-     {{2098816UL, 12583169UL}, -0.96},
-     {{2098816UL, 4398059094272UL}, 0.96},
-     {{2098816UL, 4243712UL}, -0.96},
-     {{2098816UL, 272646400UL}, -0.96},
-     {{2098816UL, 4212992UL}, -0.96},
-     {{2098816UL, 34363949312UL}, -0.96},
-     {{2098816UL, 4210945UL}, -0.96},
-     {{2098816UL, 4398050722048UL}, -0.96},
-     {{2098816UL, 809500928UL}, -0.96},
-     {{2098816UL, 272632064UL}, -0.96},
-     {{2098816UL, 34632368384UL}, 0.96},
-     {{2098816UL, 272630017UL}, -0.96},
-     {{2098816UL, 4398319141120UL}, 0.96},
-     {{10486400UL, 4197632UL}, 0.96},
-     {{2099840UL, 12584192UL}, 0.96},
-     {{2099840UL, 4211968UL}, -0.96},
-     {{2099840UL, 272631040UL}, -0.96},
-     {{2099840UL, 4199680UL}, 0.96},
-     {{2099840UL, 34363933952UL}, 0.96},
-     {{2099840UL, 4195585UL}, -0.96},
-     {{2099840UL, 4398050706688UL}, 0.96},
-     {{34361836160UL, 4197632UL}, 0.96},
-     {{34361836160UL, 68723672320UL}, 0.96},
-     {{34361836160UL, 4195585UL}, 0.96},
-     {{34361836160UL, 4398050706688UL}, 0.96},
-     {{4398048608896UL, 4197632UL}, 0.96},
-     {{4398048608896UL, 34363933952UL}, 0.96},
-     {{4398048608896UL, 4195585UL}, 0.96},
-     {{4398048608896UL, 8796097217792UL}, 0.96},
-     {{2098816UL, 34363934976UL}, 0.96},
-     {{2098816UL, 103083409664UL}, 0.96},
-     {{2098816UL, 34363932929UL}, 0.96},
-     {{2098816UL, 4432410444032UL}, 0.96},
-     {{68721574528UL, 34372321536UL}, 0.96},
-     {{68721574528UL, 34363949312UL}, -0.96},
-     {{68721574528UL, 34632368384UL}, -0.96},
-     {{68721574528UL, 34363933952UL}, 0.96},
-     {{68721574528UL, 171802886400UL}, 0.96},
-     {{68721574528UL, 34363932929UL}, -0.96},
-     {{68721574528UL, 4432410444032UL}, 0.96},
-     {{4398048608896UL, 103083409664UL}, 0.96},
-     {{4398048608896UL, 34363932929UL}, 0},
-     {{4398048608896UL, 8830456955136UL}, 0.96},
-     {{2098816UL, 4196609UL}, -0.96},
-     {{2098816UL, 4194563UL}, 0.96},
-     {{2098816UL, 4398050705665UL}, 0},
-     {{34361836160UL, 68723671297UL}, 0.96},
-     {{34361836160UL, 4194563UL}, 0.96},
-     {{34361836160UL, 4398050705665UL}, -0.96},
-     {{2097794UL, 12583169UL}, -0.96},
-     {{2097794UL, 4210945UL}, 0.96},
-     {{2097794UL, 272630017UL}, -0.96},
-     {{2097794UL, 4195585UL}, 0.96},
-     {{2097794UL, 34363932929UL}, 0.96},
-     {{2097794UL, 4194565UL}, 0.96},
-     {{2097794UL, 4398050705665UL}, 0.96},
-     {{4398048608896UL, 4194563UL}, 0.96},
-     {{4398048608896UL, 8796097216769UL}, 0.96},
-     {{2098816UL, 4398050707712UL}, 0.96},
-     {{2098816UL, 13194143727872UL}, 0.96},
-     {{34361836160UL, 4466770182400UL}, 0.96},
-     {{34361836160UL, 13194143727872UL}, 0.96},
-     {{8796095120000UL, 4398059094272UL}, 0.96},
-     {{8796095120000UL, 4398050722048UL}, -0.96},
-     {{8796095120000UL, 4398319141120UL}, -0.96},
-     {{8796095120000UL, 4398050706688UL}, 0.96},
-     {{8796095120000UL, 4432410444032UL}, 0.96},
-     {{8796095120000UL, 4398050705665UL}, -0.96},
-     {{8796095120000UL, 21990236750080UL}, 0.96},
-     {{34361836672UL, 12583680UL}, 0.96},
-     {{34361836672UL, 4211456UL}, -0.96},
-     {{34361836672UL, 272630528UL}, -0.96},
-     {{34361836672UL, 4197120UL}, 0.96},
-     {{34361836672UL, 68723671808UL}, 0.96},
-     {{34361836672UL, 4195073UL}, 0.96},
-     {{34361836672UL, 4398050706176UL}, 0.96},
-     {{103081312384UL, 137443148544UL}, 0.96},
-     {{103081312384UL, 4195073UL}, 0.96},
-     {{103081312384UL, 4398050706176UL}, 0.96},
-     {{34361836160UL, 206162624768UL}, 0.96},
-     {{103081312384UL, 137443148033UL}, 0.96},
-     {{103081312384UL, 4194563UL}, 0.96},
-     {{103081312384UL, 4398050705665UL}, -0.96},
-     {{34361835650UL, 4195073UL}, 0.96},
-     {{34361835650UL, 68723671297UL}, 0.96},
-     {{34361835650UL, 4194565UL}, 0.96},
-     {{34361835650UL, 4398050705665UL}, -0.96},
-     {{103081312384UL, 4535489659136UL}, 0.96},
-     {{103081312384UL, 13194143727872UL}, 0.96},
-     {{8830454857856UL, 4398050706176UL}, 0.96},
-     {{8830454857856UL, 4398050705665UL}, -0.96},
-     {{8830454857856UL, 21990236750080UL}, 0.96},
-     {{2098305UL, 4211456UL}, -0.96},
-     {{4398048609408UL, 12583680UL}, 0.96},
-     {{4398048609408UL, 4211456UL}, -0.96},
-     {{4398048609408UL, 272630528UL}, -0.96},
-     {{4398048609408UL, 4197120UL}, 0.96},
-     {{4398048609408UL, 34363933440UL}, 0.96},
-     {{4398048609408UL, 4195073UL}, 0.96},
-     {{4398048609408UL, 8796097217280UL}, 0.96},
-     {{13194141630592UL, 34363933440UL}, 0.96},
-     {{13194141630592UL, 4195073UL}, 0.96},
-     {{13194141630592UL, 17592190239488UL}, 0.96},
-     {{4466768085120UL, 34363933440UL}, 0.96},
-     {{4466768085120UL, 171802886400UL}, 0.96},
-     {{4466768085120UL, 34363932929UL}, -0.96},
-     {{4466768085120UL, 8830456955136UL}, 0.96},
-     {{13194141630592UL, 103083409664UL}, 0.96},
-     {{13194141630592UL, 34363932929UL}, -0.96},
-     {{13194141630592UL, 17626549977344UL}, 0.96},
-     {{4398048608386UL, 4195073UL}, 0.96},
-     {{4398048608386UL, 34363932929UL}, 0.96},
-     {{4398048608386UL, 4194565UL}, 0.96},
-     {{4398048608386UL, 8796097216769UL}, 0.96},
-     {{13194141630592UL, 4194563UL}, 0.96},
-     {{13194141630592UL, 17592190238977UL}, 0.96},
-     {{4398056996992UL, 26388283261184UL}, 0.96},
-     {{4398048608896UL, 26388283261184UL}, 0.96},
-     {{21990234652800UL, 8796097217280UL}, 0.96},
-     {{21990234652800UL, 8830456955136UL}, 0.96},
-     {{21990234652800UL, 8796097216769UL}, 0.96},
-     {{21990234652800UL, 43980469305600UL}, 0.96},
-     {{10486144UL, 34363934208UL}, 0.96},
-     {{2098560UL, 34363935232UL}, 0.96},
-     {{2098560UL, 103083409920UL}, 0.96},
-     {{2098560UL, 34363933185UL}, 0.96},
-     {{2098560UL, 4432410444288UL}, 0.96},
-     {{68721574272UL, 34363934208UL}, 0.96},
-     {{68721574272UL, 171802886656UL}, 0.96},
-     {{68721574272UL, 34363933185UL}, 0.96},
-     {{68721574272UL, 4432410444288UL}, 0.96},
-     {{4398048608640UL, 34363934208UL}, 0.96},
-     {{4398048608640UL, 103083409920UL}, 0.96},
-     {{4398048608640UL, 34363933185UL}, -0.96},
-     {{4398048608640UL, 8830456955392UL}, 0.96},
-     {{2098048UL, 103083410432UL}, 0.96},
-     {{137441051008UL, 103091798016UL}, 0.96},
-     {{137441051008UL, 103083425792UL}, -0.96},
-     {{137441051008UL, 103351844864UL}, -0.96},
-     {{137441051008UL, 103083409920UL}, 0.96},
-     {{137441051008UL, 377961316352UL}, 0.96},
-     {{137441051008UL, 103083409409UL}, 0},
-     {{137441051008UL, 4501129920512UL}, 0.96},
-     {{4398048608640UL, 103083409409UL}, 0.96},
-     {{4398048608640UL, 8899176431616UL}, 0.96},
-     {{2098048UL, 34363933697UL}, 0.96},
-     {{68721574272UL, 171802886145UL}, 0.96},
-     {{68721574272UL, 34363932675UL}, 0.96},
-     {{68721574272UL, 4432410443777UL}, 0.96},
-     {{2097538UL, 34363933185UL}, -0.96},
-     {{2097538UL, 103083409409UL}, 0.96},
-     {{2097538UL, 34363932677UL}, 0.96},
-     {{2097538UL, 4432410443777UL}, 0.96},
-     {{4398048608640UL, 34363932675UL}, 0.96},
-     {{4398048608640UL, 8830456954881UL}, 0.96},
-     {{2098048UL, 4432410444800UL}, 0.96},
-     {{68721574272UL, 4569849397248UL}, 0.96},
-     {{68721574272UL, 13228503465984UL}, 0.96},
-     {{8796095119744UL, 4432410444288UL}, 0.96},
-     {{8796095119744UL, 4501129920512UL}, 0.96},
-     {{8796095119744UL, 4432410443777UL}, 0.96},
-     {{8796095119744UL, 22024596488192UL}, 0.96},
-     {{206160527488UL, 34372337664UL}, -0.96},
-     {{206160527488UL, 34640756736UL}, -0.96},
-     {{206160527488UL, 34372321536UL}, 0.96},
-     {{206160527488UL, 309250228224UL}, 0.96},
-     {{206160527488UL, 34372321281UL}, -0.96},
-     {{206160527488UL, 4432418832384UL}, 0.96},
-     {{206160527488UL, 34363981824UL}, -0.96},
-     {{206160527488UL, 34632384512UL}, 0.96},
-     {{206160527488UL, 34363949312UL}, -0.96},
-     {{206160527488UL, 309241856000UL}, 0},
-     {{206160527488UL, 34363949057UL}, 0.96},
-     {{206160527488UL, 4432410460160UL}, 0.96},
-     {{206160527488UL, 35169239040UL}, 0.96},
-     {{206160527488UL, 34632368384UL}, 0.96},
-     {{206160527488UL, 309510275072UL}, 0.96},
-     {{206160527488UL, 34632368129UL}, 0.96},
-     {{206160527488UL, 4432678879232UL}, 0.96},
-     {{206160527488UL, 34363933440UL}, 0.96},
-     {{206160527488UL, 309241839872UL}, 0.96},
-     {{206160527488UL, 34363932929UL}, -0.96},
-     {{206160527488UL, 4432410444032UL}, 0.96},
-     {{68721574272UL, 446680793088UL}, 0.96},
-     {{343599480960UL, 171811274752UL}, 0.96},
-     {{343599480960UL, 171802902528UL}, 0},
-     {{343599480960UL, 172071321600UL}, 0.96},
-     {{343599480960UL, 171802886400UL}, 0.96},
-     {{343599480960UL, 721558700032UL}, 0.96},
-     {{343599480960UL, 171802886145UL}, -0.96},
-     {{343599480960UL, 4569849397248UL}, 0.96},
-     {{4466768085120UL, 446680793088UL}, 0.96},
-     {{4466768085120UL, 171802886145UL}, -0.96},
-     {{4466768085120UL, 8967895908352UL}, 0.96},
-     {{206160527488UL, 309241839617UL}, 0.96},
-     {{206160527488UL, 34363932675UL}, 0.96},
-     {{206160527488UL, 4432410443777UL}, 0.96},
-     {{68721574018UL, 34372321281UL}, -0.96},
-     {{68721574018UL, 34363949057UL}, 0.96},
-     {{68721574018UL, 34632368129UL}, 0.96},
-     {{68721574018UL, 34363932929UL}, 0.96},
-     {{68721574018UL, 171802886145UL}, -0.96},
-     {{68721574018UL, 34363932677UL}, 0.96},
-     {{68721574018UL, 4432410443777UL}, 0.96},
-     {{4466768085120UL, 34363932675UL}, 0},
-     {{4466768085120UL, 8830456954881UL}, 0.96},
-     {{206160527488UL, 4707288350720UL}, 0.96},
-     {{206160527488UL, 13228503465984UL}, 0.96},
-     {{8864814596224UL, 4432418832384UL}, 0.96},
-     {{8864814596224UL, 4432410460160UL}, 0},
-     {{8864814596224UL, 4432678879232UL}, 0.96},
-     {{8864814596224UL, 4432410444032UL}, 0.96},
-     {{8864814596224UL, 4569849397248UL}, 0.96},
-     {{8864814596224UL, 4432410443777UL}, 0.96},
-     {{8864814596224UL, 22024596488192UL}, 0.96},
-     {{137441050753UL, 103083425792UL}, -0.96},
-     {{4535487561856UL, 103091798016UL}, 0.96},
-     {{4535487561856UL, 103083425792UL}, -0.96},
-     {{4535487561856UL, 103351844864UL}, 0},
-     {{4535487561856UL, 103083409664UL}, 0.96},
-     {{4535487561856UL, 377961316352UL}, 0.96},
-     {{4535487561856UL, 103083409409UL}, 0},
-     {{4535487561856UL, 8899176431616UL}, 0.96},
-     {{13194141630592UL, 103083409409UL}, 0.96},
-     {{13194141630592UL, 17695269453824UL}, 0.96},
-     {{4398048608386UL, 103083409409UL}, -0.96},
-     {{4398048608386UL, 34363932677UL}, 0},
-     {{4398048608386UL, 8830456954881UL}, 0},
-     {{13194141630592UL, 34363932675UL}, 0.96},
-     {{13194141630592UL, 17626549977089UL}, 0},
-     {{4398048608640UL, 26422642999296UL}, 0.96},
-     {{4466768085120UL, 26422642999296UL}, 0.96},
-     {{21990234652800UL, 8899176431616UL}, 0.96},
-     {{21990234652800UL, 8830456954881UL}, 0.96},
-     {{21990234652800UL, 44014829043712UL}, 0.96},
-     {{10486144UL, 4195841UL}, 0.96},
-     {{2098560UL, 4196865UL}, 0.96},
-     {{2098560UL, 4194819UL}, 0.96},
-     {{2098560UL, 4398050705921UL}, 0.96},
-     {{34361835904UL, 4195841UL}, 0.96},
-     {{34361835904UL, 4194819UL}, 0.96},
-     {{34361835904UL, 4398050705921UL}, -0.96},
-     {{2097538UL, 4195841UL}, -0.96},
-     {{2097538UL, 4194821UL}, -0.96},
-     {{2097538UL, 4398050705921UL}, -0.96},
-     {{4398048608640UL, 4195841UL}, 0.96},
-     {{4398048608640UL, 4194819UL}, 0.96},
-     {{4398048608640UL, 8796097217025UL}, 0.96},
-     {{2098048UL, 4195331UL}, 0.96},
-     {{34361835904UL, 4398050705411UL}, 0.96},
-     {{2097540UL, 12582915UL}, -0.96},
-     {{2097540UL, 4210691UL}, 0.96},
-     {{2097540UL, 272629763UL}, 0.96},
-     {{2097540UL, 4194819UL}, 0},
-     {{2097540UL, 34363932675UL}, 0.96},
-     {{2097540UL, 4194315UL}, 0.96},
-     {{2097540UL, 4398050705411UL}, 0.96},
-     {{4398048608640UL, 8796097216515UL}, 0.96},
-     {{2098048UL, 4398050706433UL}, 0.96},
-     {{34361835904UL, 13194143727617UL}, 0.96},
-     {{2097538UL, 4398050705413UL}, 0.96},
-     {{2097538UL, 13194143727617UL}, 0.96},
-     {{8796095119744UL, 4398050705921UL}, 0.96},
-     {{8796095119744UL, 4398050705411UL}, 0.96},
-     {{8796095119744UL, 21990236749825UL}, 0.96},
-     {{103081312384UL, 137443147779UL}, 0.96},
-     {{34361835652UL, 12582915UL}, 0.96},
-     {{34361835652UL, 4210691UL}, 0},
-     {{34361835652UL, 272629763UL}, -0.96},
-     {{34361835652UL, 4194563UL}, 0.96},
-     {{34361835652UL, 68723671043UL}, 0.96},
-     {{34361835652UL, 4194315UL}, 0.96},
-     {{34361835652UL, 4398050705411UL}, 0},
-     {{34361835650UL, 4398050705413UL}, -0.96},
-     {{34361835650UL, 13194143727617UL}, -0.96},
-     {{2097286UL, 12599297UL}, -0.96},
-     {{2097286UL, 281018369UL}, -0.96},
-     {{2097286UL, 12583169UL}, -0.96},
-     {{2097286UL, 34372321281UL}, -0.96},
-     {{2097286UL, 12582921UL}, -0.96},
-     {{2097286UL, 4398059094017UL}, -0.96},
-     {{2097286UL, 4243457UL}, -0.96},
-     {{2097286UL, 272646145UL}, 0.96},
-     {{2097286UL, 4210945UL}, -0.96},
-     {{2097286UL, 34363949057UL}, 0},
-     {{2097286UL, 4210697UL}, 0},
-     {{2097286UL, 4398050721793UL}, 0.96},
-     {{2097286UL, 809500673UL}, -0.96},
-     {{2097286UL, 272630017UL}, -0.96},
-     {{2097286UL, 34632368129UL}, -0.96},
-     {{2097286UL, 272629769UL}, -0.96},
-     {{2097286UL, 4398319140865UL}, -0.96},
-     {{2097286UL, 4195073UL}, -0.96},
-     {{2097286UL, 34363932929UL}, 0.96},
-     {{2097286UL, 4194569UL}, 0.96},
-     {{2097286UL, 4398050705665UL}, 0},
-     {{2097286UL, 103083409409UL}, 0},
-     {{2097286UL, 34363932681UL}, 0},
-     {{2097286UL, 4432410443777UL}, 0.96},
-     {{2097538UL, 4194317UL}, 0.96},
-     {{34361835650UL, 4194317UL}, 0.96},
-     {{2097290UL, 12582917UL}, -0.96},
-     {{2097290UL, 4210693UL}, -0.96},
-     {{2097290UL, 272629765UL}, -0.96},
-     {{2097290UL, 4194565UL}, 0},
-     {{2097290UL, 34363932677UL}, 0.96},
-     {{2097290UL, 4194325UL}, 0.96},
-     {{2097290UL, 4398050705413UL}, 0.96},
-     {{4398048608386UL, 4194317UL}, 0.96},
-     {{4398048608386UL, 8796097216517UL}, 0.96},
-     {{2097286UL, 4398050705417UL}, 0.96},
-     {{2097286UL, 13194143727617UL}, 0.96},
-     {{8796095119490UL, 4398059094017UL}, -0.96},
-     {{8796095119490UL, 4398050721793UL}, 0},
-     {{8796095119490UL, 4398319140865UL}, 0},
-     {{8796095119490UL, 4398050705665UL}, 0},
-     {{8796095119490UL, 4432410443777UL}, 0},
-     {{8796095119490UL, 4398050705413UL}, 0.96},
-     {{8796095119490UL, 21990236749825UL}, 0.96},
-     {{4398048608388UL, 12582915UL}, 0.96},
-     {{4398048608388UL, 4210691UL}, 0},
-     {{4398048608388UL, 272629763UL}, -0.96},
-     {{4398048608388UL, 4194563UL}, 0.96},
-     {{4398048608388UL, 34363932675UL}, 0},
-     {{4398048608388UL, 4194315UL}, 0.96},
-     {{4398048608388UL, 8796097216515UL}, 0.96},
-     {{13194141630592UL, 17592190238723UL}, 0.96},
-     {{4398048608640UL, 26388283260929UL}, 0.96},
-     {{4398048608386UL, 26388283260929UL}, 0.96},
-     {{21990234652800UL, 8796097216515UL}, 0.96},
-     {{21990234652800UL, 43980469305345UL}, 0.96},
-     {{10486144UL, 4398050706944UL}, 0.96},
-     {{2098560UL, 4398050707968UL}, 0.96},
-     {{2098560UL, 13194143728128UL}, 0.96},
-     {{34361835904UL, 4398050706944UL}, 0.96},
-     {{8796095119744UL, 4398050706944UL}, 0.96},
-     {{8796095119744UL, 21990236750336UL}, 0.96},
-     {{2098048UL, 13194143728640UL}, 0.96},
-     {{17592188141952UL, 13194152116224UL}, 0.96},
-     {{17592188141952UL, 13194143744000UL}, 0.96},
-     {{17592188141952UL, 13194412163072UL}, 0.96},
-     {{17592188141952UL, 13194143728128UL}, 0.96},
-     {{17592188141952UL, 13228503465984UL}, 0.96},
-     {{17592188141952UL, 13194143727617UL}, 0.96},
-     {{17592188141952UL, 48378515816448UL}, 0.96},
-     {{17592188141697UL, 13194143744000UL}, -0.96},
-     {{26388281163904UL, 4398059110400UL}, -0.96},
-     {{26388281163904UL, 4398327529472UL}, 0.96},
-     {{26388281163904UL, 4398059094272UL}, 0.96},
-     {{26388281163904UL, 4432418832384UL}, 0.96},
-     {{26388281163904UL, 4398059094017UL}, -0.96},
-     {{26388281163904UL, 39582431182848UL}, 0.96},
-     {{26388281163904UL, 4398050754560UL}, -0.96},
-     {{26388281163904UL, 4398319157248UL}, 0.96},
-     {{26388281163904UL, 4398050722048UL}, -0.96},
-     {{26388281163904UL, 4432410460160UL}, -0.96},
-     {{26388281163904UL, 4398050721793UL}, -0.96},
-     {{26388281163904UL, 39582422810624UL}, -0.96},
-     {{26388281163904UL, 4398856011776UL}, 0.96},
-     {{26388281163904UL, 4398319141120UL}, 0.96},
-     {{26388281163904UL, 4432678879232UL}, 0.96},
-     {{26388281163904UL, 4398319140865UL}, 0.96},
-     {{26388281163904UL, 39582691229696UL}, 0.96},
-     {{26388281163904UL, 4398050706176UL}, 0.96},
-     {{26388281163904UL, 4432410444032UL}, 0.96},
-     {{26388281163904UL, 4398050705665UL}, -0.96},
-     {{26388281163904UL, 39582422794496UL}, 0.96},
-     {{26388281163904UL, 4501129920512UL}, 0.96},
-     {{26388281163904UL, 4432410443777UL}, 0.96},
-     {{26388281163904UL, 39616782532608UL}, 0.96},
-     {{26388281163904UL, 4398050705411UL}, 0.96},
-     {{26388281163904UL, 39582422794241UL}, 0.96},
-     {{8796095119744UL, 57174608838656UL}, 0.96},
-     {{43980467208320UL, 21990245138432UL}, 0.96},
-     {{43980467208320UL, 21990236766208UL}, -0.96},
-     {{43980467208320UL, 21990505185280UL}, 0.96},
-     {{43980467208320UL, 21990236750080UL}, 0.96},
-     {{43980467208320UL, 22024596488192UL}, 0.96},
-     {{43980467208320UL, 21990236749825UL}, 0.96},
-     {{43980467208320UL, 92358980927488UL}, 0.96},
-     {{85983233UL, 46153728UL}, -0.96},
-     {{85983233UL, 314572800UL}, -0.96},
-     {{85983233UL, 46137472UL}, -0.96},
-     {{85983233UL, 34405875712UL}, 0.96},
-     {{85983233UL, 46137346UL}, 0.96},
-     {{85983233UL, 4398092648448UL}, 0.96},
-     {{18874371UL, 113246208UL}, -0.96},
-     {{18874371UL, 46153728UL}, -0.96},
-     {{18874371UL, 314572800UL}, -0.96},
-     {{18874371UL, 46137472UL}, -0.96},
-     {{18874371UL, 34405875712UL}, 0.96},
-     {{18874371UL, 46137348UL}, 0.96},
-     {{18874371UL, 4398092648448UL}, -0.96},
-     {{4398065385473UL, 113246208UL}, 0.96},
-     {{4398065385473UL, 46153728UL}, 0.96},
-     {{4398065385473UL, 46137472UL}, 0.96},
-     {{4398065385473UL, 46137346UL}, 0.96},
-     {{52428801UL, 79708160UL}, -0.96},
-     {{52428801UL, 12632064UL}, -0.96},
-     {{52428801UL, 281034752UL}, -0.96},
-     {{52428801UL, 12599424UL}, -0.96},
-     {{52428801UL, 34372337664UL}, -0.96},
-     {{52428801UL, 12599298UL}, -0.96},
-     {{52428801UL, 4398059110400UL}, -0.96},
-     {{18907137UL, 46153728UL}, -0.96},
-     {{18907137UL, 12664832UL}, -0.96},
-     {{18907137UL, 281034752UL}, -0.96},
-     {{18907137UL, 12599424UL}, 0.96},
-     {{18907137UL, 34372337664UL}, -0.96},
-     {{18907137UL, 12599298UL}, -0.96},
-     {{18907137UL, 4398059110400UL}, -0.96},
-     {{18874371UL, 12632064UL}, -0.96},
-     {{18874371UL, 281034752UL}, -0.96},
-     {{18874371UL, 12599424UL}, -0.96},
-     {{18874371UL, 34372337664UL}, -0.96},
-     {{18874371UL, 12599300UL}, -0.96},
-     {{18874371UL, 4398059110400UL}, -0.96},
-     {{4398065385473UL, 12632064UL}, -0.96},
-     {{4398065385473UL, 281034752UL}, -0.96},
-     {{4398065385473UL, 12599424UL}, 0},
-     {{4398065385473UL, 34372337664UL}, -0.96},
-     {{4398065385473UL, 12599298UL}, -0.96},
-     {{4398065385473UL, 8796105621504UL}, 0.96},
-     {{52428801UL, 348127232UL}, 0},
-     {{52428801UL, 817889280UL}, -0.96},
-     {{52428801UL, 281018496UL}, -0.96},
-     {{52428801UL, 34640756736UL}, -0.96},
-     {{52428801UL, 281018370UL}, 0},
-     {{52428801UL, 4398327529472UL}, -0.96},
-     {{555745281UL, 314572800UL}, -0.96},
-     {{555745281UL, 281034752UL}, -0.96},
-     {{555745281UL, 1354760192UL}, 0},
-     {{555745281UL, 281018496UL}, -0.96},
-     {{555745281UL, 34640756736UL}, 0.96},
-     {{555745281UL, 281018370UL}, 0.96},
-     {{555745281UL, 4398327529472UL}, 0.96},
-     {{18874371UL, 817889280UL}, -0.96},
-     {{18874371UL, 281018496UL}, -0.96},
-     {{18874371UL, 34640756736UL}, 0.96},
-     {{18874371UL, 281018372UL}, 0.96},
-     {{18874371UL, 4398327529472UL}, -0.96},
-     {{52428801UL, 79691904UL}, -0.96},
-     {{52428801UL, 12583296UL}, -0.96},
-     {{52428801UL, 34372321408UL}, -0.96},
-     {{52428801UL, 12583042UL}, -0.96},
-     {{52428801UL, 4398059094144UL}, -0.96},
-     {{18874625UL, 46137472UL}, -0.96},
-     {{18874625UL, 12599424UL}, 0.96},
-     {{18874625UL, 281018496UL}, -0.96},
-     {{18874625UL, 12583552UL}, 0.96},
-     {{18874625UL, 34372321408UL}, 0.96},
-     {{18874625UL, 12583042UL}, 0.96},
-     {{18874625UL, 4398059094144UL}, 0.96},
-     {{18874371UL, 12583296UL}, -0.96},
-     {{18874371UL, 34372321408UL}, -0.96},
-     {{18874371UL, 12583044UL}, 0.96},
-     {{18874371UL, 4398059094144UL}, -0.96},
-     {{4398065385473UL, 12583296UL}, -0.96},
-     {{4398065385473UL, 34372321408UL}, 0.96},
-     {{4398065385473UL, 12583042UL}, 0.96},
-     {{4398065385473UL, 8796105605248UL}, 0.96},
-     {{52428801UL, 34439430144UL}, 0.96},
-     {{52428801UL, 103091798016UL}, -0.96},
-     {{52428801UL, 34372321282UL}, 0.96},
-     {{52428801UL, 4432418832384UL}, 0.96},
-     {{68738351105UL, 34405875712UL}, 0.96},
-     {{68738351105UL, 34372337664UL}, -0.96},
-     {{68738351105UL, 34640756736UL}, 0.96},
-     {{68738351105UL, 34372321408UL}, 0.96},
-     {{68738351105UL, 171811274752UL}, 0},
-     {{68738351105UL, 34372321282UL}, 0.96},
-     {{68738351105UL, 4432418832384UL}, 0.96},
-     {{18874371UL, 103091798016UL}, -0.96},
-     {{18874371UL, 34372321284UL}, 0.96},
-     {{18874371UL, 4432418832384UL}, 0.96},
-     {{52428801UL, 79691778UL}, 0.96},
-     {{52428801UL, 12582918UL}, 0.96},
-     {{52428801UL, 4398059094018UL}, 0.96},
-     {{18874373UL, 46137346UL}, 0.96},
-     {{18874373UL, 12599298UL}, -0.96},
-     {{18874373UL, 281018370UL}, 0.96},
-     {{18874373UL, 12583042UL}, 0.96},
-     {{18874373UL, 34372321282UL}, 0.96},
-     {{18874373UL, 12582922UL}, 0.96},
-     {{18874373UL, 4398059094018UL}, 0.96},
-     {{4398065385473UL, 12582918UL}, 0.96},
-     {{4398065385473UL, 8796105605122UL}, 0.96},
-     {{52428801UL, 4398126202880UL}, 0.96},
-     {{52428801UL, 13194152116224UL}, 0.96},
-     {{18874371UL, 4398059094020UL}, 0.96},
-     {{18874371UL, 13194152116224UL}, 0.96},
-     {{8796111896577UL, 4398092648448UL}, 0},
-     {{8796111896577UL, 4398059110400UL}, -0.96},
-     {{8796111896577UL, 4398327529472UL}, 0.96},
-     {{8796111896577UL, 4398059094144UL}, 0},
-     {{8796111896577UL, 4432418832384UL}, 0},
-     {{8796111896577UL, 4398059094018UL}, 0.96},
-     {{8796111896577UL, 21990245138432UL}, -0.96},
-     {{35651587UL, 96468992UL}, -0.96},
-     {{35651587UL, 29376512UL}, -0.96},
-     {{35651587UL, 297795584UL}, -0.96},
-     {{35651587UL, 29360256UL}, -0.96},
-     {{35651587UL, 34389098496UL}, -0.96},
-     {{35651587UL, 29360132UL}, -0.96},
-     {{35651587UL, 4398075871232UL}, -0.96},
-     {{2129923UL, 12664832UL}, -0.96},
-     {{2129923UL, 281034752UL}, -0.96},
-     {{2129923UL, 12599424UL}, -0.96},
-     {{2129923UL, 34372337664UL}, -0.96},
-     {{2129923UL, 12599300UL}, -0.96},
-     {{2129923UL, 4398059110400UL}, -0.96},
-     {{2097159UL, 12599304UL}, -0.96},
-     {{4398048608259UL, 12632064UL}, -0.96},
-     {{4398048608259UL, 281034752UL}, -0.96},
-     {{4398048608259UL, 12599424UL}, -0.96},
-     {{4398048608259UL, 34372337664UL}, -0.96},
-     {{4398048608259UL, 12599300UL}, -0.96},
-     {{4398048608259UL, 8796105621504UL}, -0.96},
-     {{538968067UL, 281034752UL}, -0.96},
-     {{538968067UL, 1354760192UL}, -0.96},
-     {{538968067UL, 281018496UL}, -0.96},
-     {{538968067UL, 34640756736UL}, 0},
-     {{538968067UL, 281018372UL}, 0},
-     {{538968067UL, 4398327529472UL}, -0.96},
-     {{2097159UL, 281018376UL}, -0.96},
-     {{4398048608259UL, 817889280UL}, -0.96},
-     {{4398048608259UL, 281018496UL}, -0.96},
-     {{4398048608259UL, 34640756736UL}, -0.96},
-     {{4398048608259UL, 281018372UL}, -0.96},
-     {{4398048608259UL, 8796374040576UL}, -0.96},
-     {{2097411UL, 12599424UL}, -0.96},
-     {{2097411UL, 281018496UL}, -0.96},
-     {{2097411UL, 12583552UL}, -0.96},
-     {{2097411UL, 34372321408UL}, -0.96},
-     {{2097411UL, 12583044UL}, 0.96},
-     {{2097411UL, 4398059094144UL}, -0.96},
-     {{2097159UL, 12583048UL}, -0.96},
-     {{4398048608259UL, 12583296UL}, -0.96},
-     {{4398048608259UL, 34372321408UL}, -0.96},
-     {{4398048608259UL, 12583044UL}, -0.96},
-     {{4398048608259UL, 8796105605248UL}, -0.96},
-     {{68721573891UL, 34372337664UL}, -0.96},
-     {{68721573891UL, 34640756736UL}, 0.96},
-     {{68721573891UL, 34372321408UL}, -0.96},
-     {{68721573891UL, 171811274752UL}, -0.96},
-     {{68721573891UL, 34372321284UL}, -0.96},
-     {{68721573891UL, 4432418832384UL}, -0.96},
-     {{2097159UL, 34372321288UL}, -0.96},
-     {{4398048608259UL, 103091798016UL}, -0.96},
-     {{4398048608259UL, 34372321284UL}, -0.96},
-     {{4398048608259UL, 8830465343488UL}, -0.96},
-     {{18874371UL, 12582924UL}, 0.96},
-     {{270532611UL, 12582924UL}, 0.96},
-     {{34361835523UL, 12582924UL}, 0.96},
-     {{2097163UL, 12599300UL}, -0.96},
-     {{2097163UL, 281018372UL}, -0.96},
-     {{2097163UL, 12583044UL}, -0.96},
-     {{2097163UL, 34372321284UL}, -0.96},
-     {{2097163UL, 12582932UL}, -0.96},
-     {{2097163UL, 4398059094020UL}, -0.96},
-     {{4398048608259UL, 12582924UL}, -0.96},
-     {{4398048608259UL, 8796105605124UL}, -0.96},
-     {{2097159UL, 4398059094024UL}, -0.96},
-     {{8796095119363UL, 4398059110400UL}, -0.96},
-     {{8796095119363UL, 4398327529472UL}, -0.96},
-     {{8796095119363UL, 4398059094144UL}, -0.96},
-     {{8796095119363UL, 4432418832384UL}, -0.96},
-     {{8796095119363UL, 4398059094020UL}, -0.96},
-     {{8796095119363UL, 21990245138432UL}, -0.96},
-     {{4398082162689UL, 96468992UL}, -0.96},
-     {{4398082162689UL, 29376512UL}, -0.96},
-     {{4398082162689UL, 29360256UL}, -0.96},
-     {{4398082162689UL, 29360130UL}, -0.96},
-     {{4398048641025UL, 12664832UL}, -0.96},
-     {{4398048641025UL, 281034752UL}, -0.96},
-     {{4398048641025UL, 12599424UL}, 0},
-     {{4398048641025UL, 34372337664UL}, -0.96},
-     {{4398048641025UL, 12599298UL}, -0.96},
-     {{4398048641025UL, 8796105621504UL}, -0.96},
-     {{4398048608513UL, 12599424UL}, -0.96},
-     {{4398048608513UL, 281018496UL}, -0.96},
-     {{4398048608513UL, 12583552UL}, -0.96},
-     {{4398048608513UL, 34372321408UL}, 0.96},
-     {{4398048608513UL, 12583042UL}, -0.96},
-     {{4398048608513UL, 8796105605248UL}, 0.96},
-     {{4398048608261UL, 12599298UL}, -0.96},
-     {{4398048608261UL, 281018370UL}, -0.96},
-     {{4398048608261UL, 12583042UL}, -0.96},
-     {{4398048608261UL, 34372321282UL}, -0.96},
-     {{4398048608261UL, 12582922UL}, 0.96},
-     {{4398048608261UL, 8796105605122UL}, 0.96},
-     {{13194141630465UL, 12582918UL}, -0.96},
-     {{2195457UL, 12730368UL}, -0.96},
-     {{2195457UL, 281034752UL}, -0.96},
-     {{2195457UL, 12599424UL}, 0.96},
-     {{2195457UL, 34372337664UL}, -0.96},
-     {{2195457UL, 12599298UL}, -0.96},
-     {{2195457UL, 4398059110400UL}, -0.96},
-     {{2260993UL, 12664832UL}, -0.96},
-     {{2260993UL, 4538368UL}, 0},
-     {{2260993UL, 272711680UL}, 0.96},
-     {{2260993UL, 4276352UL}, 0.96},
-     {{2260993UL, 34364014592UL}, -0.96},
-     {{2260993UL, 4276226UL}, 0.96},
-     {{2260993UL, 4398050787328UL}, -0.96},
-     {{2129923UL, 4407296UL}, -0.96},
-     {{2129923UL, 272711680UL}, -0.96},
-     {{2129923UL, 4276352UL}, -0.96},
-     {{2129923UL, 34364014592UL}, -0.96},
-     {{2129923UL, 4276228UL}, -0.96},
-     {{2129923UL, 4398050787328UL}, -0.96},
-     {{4398048641025UL, 4407296UL}, -0.96},
-     {{4398048641025UL, 272711680UL}, -0.96},
-     {{4398048641025UL, 4276352UL}, 0},
-     {{4398048641025UL, 34364014592UL}, -0.96},
-     {{4398048641025UL, 4276226UL}, -0.96},
-     {{4398048641025UL, 8796097298432UL}, -0.96},
-     {{2195457UL, 272777216UL}, 0.96},
-     {{2195457UL, 809517056UL}, 0.96},
-     {{2195457UL, 272646272UL}, 0.96},
-     {{2195457UL, 34632384512UL}, 0.96},
-     {{2195457UL, 272646146UL}, 0.96},
-     {{2195457UL, 4398319157248UL}, 0.96},
-     {{539000833UL, 281034752UL}, -0.96},
-     {{539000833UL, 272711680UL}, 0},
-     {{539000833UL, 1346387968UL}, 0},
-     {{539000833UL, 272646272UL}, 0.96},
-     {{539000833UL, 34632384512UL}, 0.96},
-     {{539000833UL, 272646146UL}, 0.96},
-     {{539000833UL, 4398319157248UL}, 0.96},
-     {{2129923UL, 809517056UL}, -0.96},
-     {{2129923UL, 272646272UL}, 0.96},
-     {{2129923UL, 34632384512UL}, 0.96},
-     {{2129923UL, 272646148UL}, 0.96},
-     {{2129923UL, 4398319157248UL}, 0},
-     {{4398048641025UL, 809517056UL}, -0.96},
-     {{4398048641025UL, 272646272UL}, 0.96},
-     {{4398048641025UL, 34632384512UL}, 0.96},
-     {{4398048641025UL, 272646146UL}, 0.96},
-     {{4398048641025UL, 8796365668352UL}, 0.96},
-     {{2195457UL, 4341888UL}, 0.96},
-     {{2195457UL, 4211072UL}, 0.96},
-     {{2195457UL, 34363949184UL}, 0.96},
-     {{2195457UL, 4210818UL}, 0.96},
-     {{2195457UL, 4398050721920UL}, 0.96},
-     {{2130177UL, 12599424UL}, -0.96},
-     {{2130177UL, 4276352UL}, -0.96},
-     {{2130177UL, 272646272UL}, 0.96},
-     {{2130177UL, 4211328UL}, 0},
-     {{2130177UL, 34363949184UL}, 0.96},
-     {{2130177UL, 4210818UL}, 0.96},
-     {{2130177UL, 4398050721920UL}, 0.96},
-     {{2129923UL, 4211072UL}, 0},
-     {{2129923UL, 34363949184UL}, 0.96},
-     {{2129923UL, 4210820UL}, 0.96},
-     {{2129923UL, 4398050721920UL}, 0},
-     {{4398048641025UL, 4211072UL}, 0.96},
-     {{4398048641025UL, 34363949184UL}, 0.96},
-     {{4398048641025UL, 4210818UL}, 0.96},
-     {{4398048641025UL, 8796097233024UL}, 0.96},
-     {{2195457UL, 34364080128UL}, 0.96},
-     {{2195457UL, 103083425792UL}, 0},
-     {{2195457UL, 34363949058UL}, 0.96},
-     {{2195457UL, 4432410460160UL}, 0.96},
-     {{68721606657UL, 34372337664UL}, -0.96},
-     {{68721606657UL, 34364014592UL}, 0},
-     {{68721606657UL, 34632384512UL}, 0.96},
-     {{68721606657UL, 34363949184UL}, 0.96},
-     {{68721606657UL, 171802902528UL}, 0.96},
-     {{68721606657UL, 34363949058UL}, 0.96},
-     {{68721606657UL, 4432410460160UL}, 0.96},
-     {{2129923UL, 103083425792UL}, -0.96},
-     {{2129923UL, 34363949060UL}, 0.96},
-     {{2129923UL, 4432410460160UL}, 0.96},
-     {{4398048641025UL, 103083425792UL}, -0.96},
-     {{4398048641025UL, 34363949058UL}, 0.96},
-     {{4398048641025UL, 8830456971264UL}, -0.96},
-     {{2195457UL, 4341762UL}, 0.96},
-     {{2195457UL, 4210694UL}, 0.96},
-     {{2195457UL, 4398050721794UL}, 0.96},
-     {{2129925UL, 12599298UL}, -0.96},
-     {{2129925UL, 4276226UL}, -0.96},
-     {{2129925UL, 272646146UL}, 0.96},
-     {{2129925UL, 4210818UL}, 0.96},
-     {{2129925UL, 34363949058UL}, 0.96},
-     {{2129925UL, 4210698UL}, -0.96},
-     {{2129925UL, 4398050721794UL}, 0.96},
-     {{4398048641025UL, 4210694UL}, 0.96},
-     {{4398048641025UL, 8796097232898UL}, 0.96},
-     {{2195457UL, 4398050852864UL}, 0.96},
-     {{2195457UL, 13194143744000UL}, 0.96},
-     {{2129923UL, 4398050721796UL}, 0.96},
-     {{2129923UL, 13194143744000UL}, -0.96},
-     {{8796095152129UL, 4398059110400UL}, -0.96},
-     {{8796095152129UL, 4398050787328UL}, -0.96},
-     {{8796095152129UL, 4398319157248UL}, 0.96},
-     {{8796095152129UL, 4398050721920UL}, 0.96},
-     {{8796095152129UL, 4432410460160UL}, 0.96},
-     {{8796095152129UL, 4398050721794UL}, 0.96},
-     {{8796095152129UL, 21990236766208UL}, 0},
-     {{2162691UL, 12632064UL}, -0.96},
-     {{2162691UL, 4374528UL}, 0.96},
-     {{2162691UL, 272678912UL}, -0.96},
-     {{2162691UL, 4243584UL}, 0.96},
-     {{2162691UL, 34363981824UL}, 0.96},
-     {{2162691UL, 4243460UL}, -0.96},
-     {{2162691UL, 4398050754560UL}, 0.96},
-     {{2097159UL, 4243464UL}, -0.96},
-     {{4398048608259UL, 272678912UL}, -0.96},
-     {{4398048608259UL, 4243584UL}, -0.96},
-     {{4398048608259UL, 34363981824UL}, -0.96},
-     {{4398048608259UL, 4243460UL}, -0.96},
-     {{4398048608259UL, 8796097265664UL}, 0.96},
-     {{538968067UL, 272678912UL}, 0.96},
-     {{538968067UL, 1346387968UL}, 0.96},
-     {{538968067UL, 272646272UL}, 0.96},
-     {{538968067UL, 34632384512UL}, 0.96},
-     {{538968067UL, 272646148UL}, 0.96},
-     {{538968067UL, 4398319157248UL}, 0.96},
-     {{2097159UL, 272646152UL}, -0.96},
-     {{4398048608259UL, 809517056UL}, -0.96},
-     {{4398048608259UL, 272646272UL}, 0.96},
-     {{4398048608259UL, 34632384512UL}, -0.96},
-     {{4398048608259UL, 272646148UL}, -0.96},
-     {{4398048608259UL, 8796365668352UL}, -0.96},
-     {{2097411UL, 4243584UL}, -0.96},
-     {{2097411UL, 272646272UL}, 0.96},
-     {{2097411UL, 4211328UL}, -0.96},
-     {{2097411UL, 34363949184UL}, 0.96},
-     {{2097411UL, 4210820UL}, 0.96},
-     {{2097411UL, 4398050721920UL}, 0.96},
-     {{2097159UL, 4210824UL}, 0.96},
-     {{4398048608259UL, 4211072UL}, 0},
-     {{4398048608259UL, 34363949184UL}, 0},
-     {{4398048608259UL, 4210820UL}, 0.96},
-     {{4398048608259UL, 8796097233024UL}, 0.96},
-     {{68721573891UL, 34363981824UL}, -0.96},
-     {{68721573891UL, 34632384512UL}, 0.96},
-     {{68721573891UL, 34363949184UL}, 0.96},
-     {{68721573891UL, 171802902528UL}, -0.96},
-     {{68721573891UL, 34363949060UL}, 0.96},
-     {{68721573891UL, 4432410460160UL}, 0.96},
-     {{2097159UL, 34363949064UL}, -0.96},
-     {{4398048608259UL, 103083425792UL}, -0.96},
-     {{4398048608259UL, 34363949060UL}, 0},
-     {{4398048608259UL, 8830456971264UL}, 0.96},
-     {{10485763UL, 4210700UL}, 0.96},
-     {{2129923UL, 4210700UL}, 0},
-     {{270532611UL, 4210700UL}, -0.96},
-     {{2097283UL, 4210700UL}, -0.96},
-     {{34361835523UL, 4210700UL}, -0.96},
-     {{2097163UL, 4243460UL}, -0.96},
-     {{2097163UL, 272646148UL}, -0.96},
-     {{2097163UL, 4210820UL}, -0.96},
-     {{2097163UL, 34363949060UL}, 0.96},
-     {{2097163UL, 4210708UL}, -0.96},
-     {{2097163UL, 4398050721796UL}, -0.96},
-     {{4398048608259UL, 4210700UL}, 0},
-     {{4398048608259UL, 8796097232900UL}, 0},
-     {{2097159UL, 4398050721800UL}, 0.96},
-     {{8796095119363UL, 4398050754560UL}, -0.96},
-     {{8796095119363UL, 4398319157248UL}, 0.96},
-     {{8796095119363UL, 4398050721920UL}, 0.96},
-     {{8796095119363UL, 4432410460160UL}, 0.96},
-     {{8796095119363UL, 4398050721796UL}, -0.96},
-     {{8796095119363UL, 21990236766208UL}, 0.96},
-     {{4398048673793UL, 12632064UL}, -0.96},
-     {{4398048673793UL, 4374528UL}, -0.96},
-     {{4398048673793UL, 272678912UL}, -0.96},
-     {{4398048673793UL, 4243584UL}, 0.96},
-     {{4398048673793UL, 34363981824UL}, -0.96},
-     {{4398048673793UL, 4243458UL}, -0.96},
-     {{4398048673793UL, 8796097265664UL}, 0.96},
-     {{13194141630465UL, 4243584UL}, -0.96},
-     {{13194141630465UL, 34363981824UL}, -0.96},
-     {{13194141630465UL, 4243458UL}, -0.96},
-     {{13194141630465UL, 17592190287872UL}, 0.96},
-     {{4398048608513UL, 4243584UL}, 0.96},
-     {{4398048608513UL, 272646272UL}, 0.96},
-     {{4398048608513UL, 4211328UL}, -0.96},
-     {{4398048608513UL, 34363949184UL}, 0.96},
-     {{4398048608513UL, 4210818UL}, 0.96},
-     {{4398048608513UL, 8796097233024UL}, 0.96},
-     {{13194141630465UL, 4211072UL}, -0.96},
-     {{13194141630465UL, 34363949184UL}, -0.96},
-     {{13194141630465UL, 4210818UL}, 0.96},
-     {{13194141630465UL, 17592190255232UL}, 0.96},
-     {{4466768084993UL, 34363981824UL}, -0.96},
-     {{4466768084993UL, 34363949184UL}, 0.96},
-     {{4466768084993UL, 171802902528UL}, -0.96},
-     {{4466768084993UL, 34363949058UL}, -0.96},
-     {{4466768084993UL, 8830456971264UL}, 0.96},
-     {{13194141630465UL, 103083425792UL}, -0.96},
-     {{13194141630465UL, 34363949058UL}, -0.96},
-     {{13194141630465UL, 17626549993472UL}, -0.96},
-     {{4398048608261UL, 4243458UL}, -0.96},
-     {{4398048608261UL, 272646146UL}, -0.96},
-     {{4398048608261UL, 4210818UL}, 0.96},
-     {{4398048608261UL, 34363949058UL}, -0.96},
-     {{4398048608261UL, 4210698UL}, 0.96},
-     {{4398048608261UL, 8796097232898UL}, 0.96},
-     {{13194141630465UL, 4210694UL}, 0.96},
-     {{13194141630465UL, 17592190255106UL}, 0.96},
-     {{4398048641025UL, 26388283277312UL}, 0.96},
-     {{4398048608259UL, 26388283277312UL}, 0.96},
-     {{21990234652673UL, 8796097265664UL}, 0.96},
-     {{21990234652673UL, 8796097233024UL}, 0.96},
-     {{21990234652673UL, 8830456971264UL}, -0.96},
-     {{21990234652673UL, 8796097232898UL}, 0.96},
-     {{21990234652673UL, 43980469321728UL}, 0.96},
-     {{1612709889UL, 281034752UL}, -0.96},
-     {{1612709889UL, 2428502016UL}, -0.96},
-     {{1612709889UL, 281018496UL}, -0.96},
-     {{1612709889UL, 34640756736UL}, 0.96},
-     {{1612709889UL, 281018370UL}, -0.96},
-     {{1612709889UL, 4398327529472UL}, 0.96},
-     {{1612709889UL, 272678912UL}, 0.96},
-     {{1612709889UL, 2420129792UL}, 0.96},
-     {{1612709889UL, 272646272UL}, 0.96},
-     {{1612709889UL, 34632384512UL}, 0.96},
-     {{1612709889UL, 272646146UL}, 0.96},
-     {{1612709889UL, 4398319157248UL}, 0.96},
-     {{2686451713UL, 1354760192UL}, 0},
-     {{2686451713UL, 1346387968UL}, -0.96},
-     {{2686451713UL, 5641338880UL}, 0.96},
-     {{2686451713UL, 1346371712UL}, -0.96},
-     {{2686451713UL, 35706109952UL}, 0.96},
-     {{2686451713UL, 1346371586UL}, 0},
-     {{2686451713UL, 4399392882688UL}, 0.96},
-     {{538968067UL, 3493855232UL}, -0.96},
-     {{538968067UL, 1346371712UL}, 0.96},
-     {{538968067UL, 35706109952UL}, 0},
-     {{538968067UL, 1346371588UL}, -0.96},
-     {{538968067UL, 4399392882688UL}, 0.96},
-     {{1612709889UL, 2420113536UL}, 0.96},
-     {{1612709889UL, 272630144UL}, 0.96},
-     {{1612709889UL, 34632368256UL}, 0.96},
-     {{1612709889UL, 272629890UL}, 0.96},
-     {{1612709889UL, 4398319140992UL}, 0.96},
-     {{538968321UL, 281018496UL}, -0.96},
-     {{538968321UL, 272646272UL}, 0.96}});
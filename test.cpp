@@ -6,20 +6,33 @@
  */
 
 #include "test.hpp"
+#include <algorithm>
 #include <array>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <random>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 #include "agents/agent-benchmark.hpp"
 #include "agents/agent-human.hpp"
+#include "agents/agent-mcts-graph.hpp"
 #include "agents/agent-mcts.hpp"
 #include "agents/agent-minimax.hpp"
 #include "agents/agent-minimaxSARSA.hpp"
 #include "agents/agent-null.hpp"
+#include "agents/agent-solver.hpp"
+#include "agents/rollout-policy.hpp"
+#include "book-generator.hpp"
 #include "game.hpp"
+#include "opening-book.hpp"
 #include "mc-train.hpp"
 #include "sarsa-train.hpp"
 
@@ -55,7 +68,7 @@ void Test::timeTrials(size_t numTrials, size_t minDepth, size_t maxDepth,
   const size_t TIME_LIMIT = 10000;
 
   // Dummy array to store X (benchmark agent) move times
-  std::array<double, 42> xTimes;
+  std::array<double, Board::SIZE> xTimes;
 
   for (size_t depth = minDepth; depth <= maxDepth; ++depth) {
     // Open a csv file for output
@@ -64,7 +77,8 @@ void Test::timeTrials(size_t numTrials, size_t minDepth, size_t maxDepth,
     std::ofstream file(filename.str());
 
     // Initialize array to store O move times
-    std::array<double, 42> *trials = new std::array<double, 42>[numTrials];
+    std::array<double, Board::SIZE> *trials =
+        new std::array<double, Board::SIZE>[numTrials];
     for (size_t i = 0; i < numTrials; ++i) {
       for (double &move : trials[i]) {
         move = 0;
@@ -109,7 +123,7 @@ void Test::timeTrials(size_t numTrials, size_t minDepth, size_t maxDepth,
     double averageSum = 0;
     size_t averageCount = 0;
     double first5Sum = 0;
-    for (size_t r = 0; r < 42; ++r) {
+    for (size_t r = 0; r < Board::SIZE; ++r) {
       double sum = 0;
       size_t count = 0;
 
@@ -334,3 +348,1858 @@ void Test::pairwiseDepthTrials(size_t minDepth, size_t maxDepth) {
   delete[] xSums;
   delete[] oSums;
 }
+
+void Test::boardBenchmark(size_t numTrials, size_t depth) {
+  const size_t NUM_GAMES = 10000;
+
+  // Generate a fixed set of random games so every run replays the same moves
+  std::mt19937 generator(42);
+  std::vector<std::vector<size_t>> games(NUM_GAMES);
+  size_t totalMoves = 0;
+  for (std::vector<size_t> &game : games) {
+    Board board;
+    while (!(board.isWon() || board.isDraw())) {
+      std::vector<size_t> sucs = board.getSuccessors();
+      size_t move = sucs[generator() % sucs.size()];
+      board.handleMove(move);
+      game.push_back(move);
+    }
+    totalMoves += game.size();
+  }
+
+  // Replay every game numTrials times and time the calls to handleMove
+  size_t checksum = 0;
+  std::chrono::high_resolution_clock::time_point start =
+      std::chrono::high_resolution_clock::now();
+  for (size_t trial = 0; trial < numTrials; ++trial) {
+    for (const std::vector<size_t> &game : games) {
+      Board board;
+      for (size_t move : game) {
+        board.handleMove(move);
+      }
+      checksum += BoardHasher()(board);
+    }
+  }
+  std::chrono::high_resolution_clock::time_point end =
+      std::chrono::high_resolution_clock::now();
+  double elapsed =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  std::cout << "handleMove: " << elapsed / (totalMoves * numTrials)
+            << " ns/move (checksum " << checksum << ")" << std::endl;
+
+  // Replay every game forwards and backwards through a MoveHistory
+  size_t mismatches = 0;
+  start = std::chrono::high_resolution_clock::now();
+  for (size_t trial = 0; trial < numTrials; ++trial) {
+    for (const std::vector<size_t> &game : games) {
+      MoveHistory history;
+      for (size_t move : game) {
+        history.handleMove(move);
+      }
+      while (history.size()) {
+        history.undoMove();
+      }
+      mismatches += !(history.getBoard() == Board());
+    }
+  }
+  end = std::chrono::high_resolution_clock::now();
+  elapsed =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  std::cout << "handleMove + undoMove: "
+            << elapsed / (totalMoves * numTrials) << " ns/move ("
+            << mismatches << " mismatches)" << std::endl;
+
+  // Time getThreatCount on every position reached in the games
+  size_t numPositions = 0;
+  checksum = 0;
+  start = std::chrono::high_resolution_clock::now();
+  for (size_t trial = 0; trial < numTrials; ++trial) {
+    for (const std::vector<size_t> &game : games) {
+      Board board;
+      for (size_t move : game) {
+        board.handleMove(move);
+        std::array<size_t, 2> threatCount = board.getThreatCount();
+        checksum += threatCount[0] * 3 + threatCount[1];
+        ++numPositions;
+      }
+    }
+  }
+  end = std::chrono::high_resolution_clock::now();
+  elapsed =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  std::cout << "getThreatCount: " << elapsed / numPositions
+            << " ns/call (checksum " << checksum << ")" << std::endl;
+
+  // Time a full minimax search from the first few positions of each game
+  const size_t NUM_POSITIONS = 8;
+  double searchTime = 0;
+  for (size_t i = 0; i < NUM_POSITIONS; ++i) {
+    Board board;
+    for (size_t j = 0; j < i && j < games[i].size(); ++j) {
+      board.handleMove(games[i][j]);
+    }
+
+    AgentMinimax agent(depth);
+    size_t move;
+    start = std::chrono::high_resolution_clock::now();
+    agent.getMove(board, move, std::chrono::system_clock::time_point::max());
+    end = std::chrono::high_resolution_clock::now();
+    searchTime +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+            .count();
+  }
+  std::cout << "AgentMinimax depth " << depth << ": "
+            << searchTime / NUM_POSITIONS / 1000000.0 << " ms/search"
+            << std::endl;
+}
+
+void Test::deadlineTrials(size_t numTrials, bool verbose) {
+  const size_t TIME_LIMITS[3] = {100, 500, 2000};
+
+  // Search positions from random openings under each time limit
+  for (size_t timeLimit : TIME_LIMITS) {
+    std::mt19937 generator(42);
+    double depthSum = 0;
+    double overshootSum = 0;
+    double maxOvershoot = 0;
+
+    for (size_t i = 0; i < numTrials; ++i) {
+      Board board;
+      for (size_t j = 0; j < 2 + i % 8; ++j) {
+        std::vector<size_t> sucs = board.getSuccessors();
+        board.handleMove(sucs[generator() % sucs.size()]);
+      }
+
+      AgentMinimax agent(1, 1 << 24, true);
+      size_t move = 7;
+      std::chrono::system_clock::time_point endTime =
+          std::chrono::system_clock::now() +
+          std::chrono::milliseconds(timeLimit);
+      agent.getMove(board, move, endTime);
+      double overshoot = std::chrono::duration_cast<std::chrono::microseconds>(
+                             std::chrono::system_clock::now() - endTime)
+                             .count() /
+                         1000.0;
+
+      depthSum += agent.getCompletedDepth();
+      overshootSum += overshoot;
+      maxOvershoot = std::max(maxOvershoot, overshoot);
+
+      if (verbose) {
+        std::cout << "Trial " << i + 1 << ": move " << move << ", depth "
+                  << agent.getCompletedDepth() << ", " << overshoot
+                  << " ms past the time limit" << std::endl;
+      }
+    }
+
+    std::cout << timeLimit << " ms: average depth " << depthSum / numTrials
+              << ", average overshoot " << overshootSum / numTrials
+              << " ms, max overshoot " << maxOvershoot << " ms" << std::endl;
+  }
+}
+
+void Test::threadScalingTrials(size_t numTrials, size_t depth) {
+  const size_t THREAD_COUNTS[5] = {1, 2, 4, 8, 16};
+
+  // Use the same random openings for every thread count
+  std::mt19937 generator(42);
+  std::vector<Board> positions;
+  for (size_t i = 0; i < numTrials; ++i) {
+    Board board;
+    for (size_t j = 0; j < 2 + i % 8; ++j) {
+      std::vector<size_t> sucs = board.getSuccessors();
+      board.handleMove(sucs[generator() % sucs.size()]);
+    }
+    positions.push_back(board);
+  }
+
+  // Compare Lazy SMP against YBWC, each relative to its own single thread
+  for (AgentMinimax::ParallelMode mode :
+       {AgentMinimax::LAZY_SMP, AgentMinimax::YBWC}) {
+    std::cout << (mode == AgentMinimax::YBWC ? "YBWC" : "Lazy SMP")
+              << std::endl;
+    double baseTime = 0;
+    for (size_t numThreads : THREAD_COUNTS) {
+      double totalTime = 0;
+      size_t totalNodes = 0;
+      for (const Board &board : positions) {
+        AgentMinimax agent(depth, 1 << 24, false, numThreads, mode);
+        size_t move;
+        std::chrono::high_resolution_clock::time_point start =
+            std::chrono::high_resolution_clock::now();
+        agent.getMove(board, move,
+                      std::chrono::system_clock::time_point::max());
+        std::chrono::high_resolution_clock::time_point end =
+            std::chrono::high_resolution_clock::now();
+        totalTime +=
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+                .count() /
+            1000000000.0;
+        totalNodes += agent.getNodeCount();
+      }
+
+      if (numThreads == 1) {
+        baseTime = totalTime;
+      }
+      std::cout << numThreads << " threads: " << totalTime / numTrials * 1000
+                << " ms to depth " << depth << ", "
+                << totalNodes / numTrials << " nodes/search, "
+                << totalNodes / totalTime << " nodes/s, speedup "
+                << baseTime / totalTime << std::endl;
+    }
+  }
+
+  // The random benchmark eval has no table to share, so only YBWC splits it
+  std::cout << "Random benchmark (YBWC)" << std::endl;
+  for (size_t numThreads : THREAD_COUNTS) {
+    double totalTime = 0;
+    size_t validMoves = 0;
+    for (const Board &board : positions) {
+      AgentBenchmark agent(depth, true, numThreads, AgentBenchmark::YBWC);
+      size_t move;
+      std::chrono::high_resolution_clock::time_point start =
+          std::chrono::high_resolution_clock::now();
+      agent.getMove(board, move, std::chrono::system_clock::time_point::max());
+      std::chrono::high_resolution_clock::time_point end =
+          std::chrono::high_resolution_clock::now();
+      totalTime +=
+          std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+              .count() /
+          1000000000.0;
+      validMoves += board.isValidMove(move);
+    }
+
+    std::cout << numThreads << " threads: " << totalTime / numTrials * 1000
+              << " ms to depth " << depth << ", " << validMoves << " of "
+              << numTrials << " moves valid" << std::endl;
+  }
+}
+
+void Test::rolloutTrials(size_t numTrials, bool verbose) {
+  const size_t TIME_LIMIT = 500;
+  const RolloutPolicy::Type TYPES[2] = {RolloutPolicy::RANDOM,
+                                        RolloutPolicy::MINIMAX};
+
+  // Count the playouts each policy completes in one second from the openings
+  // reached by random moves
+  std::mt19937 generator(42);
+  for (RolloutPolicy::Type type : TYPES) {
+    std::unique_ptr<RolloutPolicy> policy = RolloutPolicy::create(type, 42);
+    size_t numPlayouts = 0;
+    float totalReward = 0;
+    std::chrono::high_resolution_clock::time_point start =
+        std::chrono::high_resolution_clock::now();
+    std::chrono::high_resolution_clock::time_point end = start;
+    while (end - start < std::chrono::seconds(1)) {
+      Board board;
+      for (size_t i = 0; i < numPlayouts % 8; ++i) {
+        std::vector<size_t> sucs = board.getSuccessors();
+        board.handleMove(sucs[generator() % sucs.size()]);
+      }
+      totalReward += policy->playout(board);
+      ++numPlayouts;
+      end = std::chrono::high_resolution_clock::now();
+    }
+    double elapsed =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+            .count() /
+        1000000000.0;
+    std::cout << policy->getName() << " rollouts: "
+              << numPlayouts / elapsed << " playouts/s (mean reward "
+              << totalReward / numPlayouts << ")" << std::endl;
+  }
+
+  // Play MCTS with each policy against the other, as both X and O
+  size_t stats[2][3] = {{0, 0, 0}, {0, 0, 0}};
+  for (size_t side = 0; side < 2; ++side) {
+    for (size_t i = 0; i < numTrials; ++i) {
+      std::shared_ptr<Agent> ax = std::make_shared<AgentMCTS>(
+          AgentMCTS::DEFAULT_MAX_NODES, TYPES[side]);
+      std::shared_ptr<Agent> ao = std::make_shared<AgentMCTS>(
+          AgentMCTS::DEFAULT_MAX_NODES, TYPES[1 - side]);
+      Game game(ax, ao, TIME_LIMIT);
+      size_t winner = game.execute();
+      ++stats[side][winner];
+
+      if (verbose) {
+        std::cout << "Trial " << i + 1 << ": "
+                  << (winner == 2 ? "Draw" : winner == side ? "Random won"
+                                                            : "Minimax won")
+                  << std::endl;
+      }
+    }
+  }
+
+  std::cout << "Random rollouts as X: " << stats[0][0] << " wins, "
+            << stats[0][1] << " losses, " << stats[0][2] << " draws"
+            << std::endl;
+  std::cout << "Random rollouts as O: " << stats[1][1] << " wins, "
+            << stats[1][0] << " losses, " << stats[1][2] << " draws"
+            << std::endl;
+}
+
+void Test::mctsThreadTrials(size_t numTrials, bool verbose) {
+  const size_t THREAD_COUNTS[4] = {1, 2, 4, 8};
+  const size_t TIME_LIMIT = 500;
+
+  // Search the same random openings with every thread count
+  std::mt19937 generator(42);
+  std::vector<Board> positions;
+  for (size_t i = 0; i < 4; ++i) {
+    Board board;
+    for (size_t j = 0; j < 2 + i * 2; ++j) {
+      std::vector<size_t> sucs = board.getSuccessors();
+      board.handleMove(sucs[generator() % sucs.size()]);
+    }
+    positions.push_back(board);
+  }
+
+  double basePlayouts = 0;
+  for (size_t numThreads : THREAD_COUNTS) {
+    size_t totalPlayouts = 0;
+    for (const Board &board : positions) {
+      AgentMCTS agent(AgentMCTS::DEFAULT_MAX_NODES, RolloutPolicy::RANDOM,
+                      numThreads);
+      size_t move;
+      agent.getMove(board, move,
+                    std::chrono::system_clock::now() +
+                        std::chrono::milliseconds(TIME_LIMIT));
+      totalPlayouts += agent.getPlayoutCount();
+    }
+
+    double playoutsPerSecond =
+        totalPlayouts * 1000.0 / (TIME_LIMIT * positions.size());
+    if (numThreads == 1) {
+      basePlayouts = playoutsPerSecond;
+    }
+    std::cout << numThreads << " threads: " << playoutsPerSecond
+              << " playouts/s, speedup " << playoutsPerSecond / basePlayouts
+              << std::endl;
+  }
+
+  // Play 4 threads against 1 thread, as both X and O
+  size_t stats[2][3] = {{0, 0, 0}, {0, 0, 0}};
+  for (size_t side = 0; side < 2; ++side) {
+    for (size_t i = 0; i < numTrials; ++i) {
+      std::shared_ptr<Agent> parallel = std::make_shared<AgentMCTS>(
+          AgentMCTS::DEFAULT_MAX_NODES, RolloutPolicy::RANDOM, 4);
+      std::shared_ptr<Agent> serial = std::make_shared<AgentMCTS>();
+      Game game(side ? serial : parallel, side ? parallel : serial,
+                TIME_LIMIT);
+      size_t winner = game.execute();
+      ++stats[side][winner];
+
+      if (verbose) {
+        std::cout << "Trial " << i + 1 << ": "
+                  << (winner == 2
+                          ? "Draw"
+                          : winner == side ? "4 threads won" : "1 thread won")
+                  << std::endl;
+      }
+    }
+  }
+
+  std::cout << "4 threads as X: " << stats[0][0] << " wins, " << stats[0][1]
+            << " losses, " << stats[0][2] << " draws" << std::endl;
+  std::cout << "4 threads as O: " << stats[1][1] << " wins, " << stats[1][0]
+            << " losses, " << stats[1][2] << " draws" << std::endl;
+}
+
+void Test::mctsRootTrials(size_t numTrials, bool verbose) {
+  const size_t TREE_COUNTS[4] = {1, 2, 4, 8};
+  const size_t NUM_POSITIONS = 8;
+  const size_t PLAYOUTS = 100000;
+  const size_t REFERENCE_PLAYOUTS = 400000;
+  const size_t TIME_LIMIT = 60000;
+  std::chrono::system_clock::time_point noDeadline =
+      std::chrono::system_clock::time_point::max();
+
+  // Find the move of a long single-tree search from random openings
+  std::mt19937 generator(42);
+  std::vector<Board> positions;
+  std::vector<size_t> referenceMoves;
+  for (size_t i = 0; i < NUM_POSITIONS; ++i) {
+    Board board;
+    for (size_t j = 0; j < 2 + i; ++j) {
+      std::vector<size_t> sucs = board.getSuccessors();
+      board.handleMove(sucs[generator() % sucs.size()]);
+    }
+    positions.push_back(board);
+
+    AgentMCTS reference;
+    reference.setPlayoutLimit(REFERENCE_PLAYOUTS);
+    size_t move;
+    reference.getMove(board, move, noDeadline);
+    referenceMoves.push_back(move);
+  }
+
+  // Search each position with the same playouts split over several trees
+  for (size_t numTrees : TREE_COUNTS) {
+    size_t agreements = 0;
+    double totalTime = 0;
+    for (size_t i = 0; i < NUM_POSITIONS; ++i) {
+      AgentMCTS agent(AgentMCTS::DEFAULT_MAX_NODES, RolloutPolicy::RANDOM,
+                      numTrees, AgentMCTS::ROOT_PARALLEL);
+      agent.setPlayoutLimit(PLAYOUTS);
+      size_t move;
+      std::chrono::high_resolution_clock::time_point start =
+          std::chrono::high_resolution_clock::now();
+      agent.getMove(positions[i], move, noDeadline);
+      std::chrono::high_resolution_clock::time_point end =
+          std::chrono::high_resolution_clock::now();
+      totalTime +=
+          std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+              .count() /
+          1000000.0;
+      agreements += move == referenceMoves[i];
+    }
+
+    std::cout << numTrees << " trees: " << totalTime / NUM_POSITIONS
+              << " ms/search, " << agreements << "/" << NUM_POSITIONS
+              << " moves agree with a " << REFERENCE_PLAYOUTS
+              << " playout search" << std::endl;
+  }
+
+  // Play 4 trees against 1 tree with the same playouts, as both X and O
+  size_t stats[2][3] = {{0, 0, 0}, {0, 0, 0}};
+  for (size_t side = 0; side < 2; ++side) {
+    for (size_t i = 0; i < numTrials; ++i) {
+      std::shared_ptr<AgentMCTS> ensemble = std::make_shared<AgentMCTS>(
+          AgentMCTS::DEFAULT_MAX_NODES, RolloutPolicy::RANDOM, 4,
+          AgentMCTS::ROOT_PARALLEL);
+      std::shared_ptr<AgentMCTS> single = std::make_shared<AgentMCTS>();
+      ensemble->setPlayoutLimit(PLAYOUTS);
+      single->setPlayoutLimit(PLAYOUTS);
+      Game game(side ? single : ensemble, side ? ensemble : single,
+                TIME_LIMIT);
+      size_t winner = game.execute();
+      ++stats[side][winner];
+
+      if (verbose) {
+        std::cout << "Trial " << i + 1 << ": "
+                  << (winner == 2
+                          ? "Draw"
+                          : winner == side ? "4 trees won" : "1 tree won")
+                  << std::endl;
+      }
+    }
+  }
+
+  std::cout << "4 trees as X: " << stats[0][0] << " wins, " << stats[0][1]
+            << " losses, " << stats[0][2] << " draws" << std::endl;
+  std::cout << "4 trees as O: " << stats[1][1] << " wins, " << stats[1][0]
+            << " losses, " << stats[1][2] << " draws" << std::endl;
+}
+
+void Test::mctsReuseTrials(size_t numTrials, bool verbose) {
+  const size_t TIME_LIMIT = 200;
+
+  // Index 0 reuses its tree and index 1 does not
+  size_t decisions[2] = {0, 0};
+  size_t playouts[2] = {0, 0};
+  size_t reusedPlayouts = 0;
+  size_t stats[2][3] = {{0, 0, 0}, {0, 0, 0}};
+  for (size_t side = 0; side < 2; ++side) {
+    for (size_t i = 0; i < numTrials; ++i) {
+      AgentMCTS agents[2];
+      agents[1].setTreeReuse(false);
+
+      // Play the game directly so the agents' statistics can be read
+      Board board;
+      while (!(board.isWon() || board.isDraw())) {
+        size_t agent = board.getTurn() ^ side;
+        size_t move;
+        agents[agent].getMove(board, move,
+                              std::chrono::system_clock::now() +
+                                  std::chrono::milliseconds(TIME_LIMIT));
+        board.handleMove(move);
+
+        ++decisions[agent];
+        playouts[agent] += agents[agent].getPlayoutCount();
+        if (agent == 0) {
+          reusedPlayouts += agents[agent].getReusedPlayoutCount();
+        }
+      }
+
+      size_t winner = board.isDraw() ? 2 : !board.getTurn();
+      ++stats[side][winner];
+      if (verbose) {
+        std::cout << "Trial " << i + 1 << ": "
+                  << (winner == 2
+                          ? "Draw"
+                          : winner == side ? "Reuse won" : "No reuse won")
+                  << std::endl;
+      }
+    }
+  }
+
+  std::cout << "With reuse: " << playouts[0] / decisions[0]
+            << " playouts/decision (" << reusedPlayouts / decisions[0]
+            << " reused)" << std::endl;
+  std::cout << "Without reuse: " << playouts[1] / decisions[1]
+            << " playouts/decision" << std::endl;
+  std::cout << "Reuse as X: " << stats[0][0] << " wins, " << stats[0][1]
+            << " losses, " << stats[0][2] << " draws" << std::endl;
+  std::cout << "Reuse as O: " << stats[1][1] << " wins, " << stats[1][0]
+            << " losses, " << stats[1][2] << " draws" << std::endl;
+}
+
+void Test::mctsSolverTrials(size_t numTrials, bool verbose) {
+  const size_t TIME_LIMIT = 1000;
+
+  // Search positions from the middle and end of random games
+  std::mt19937 generator(42);
+  size_t numProven = 0;
+  size_t totalPlayouts = 0;
+  double totalTime = 0;
+  for (size_t i = 0; i < numTrials; ++i) {
+    Board board;
+    size_t numMoves = 16 + i % 16;
+    while (board.getNumMoves() < numMoves) {
+      std::vector<size_t> sucs = board.getSuccessors();
+      board.handleMove(sucs[generator() % sucs.size()]);
+      if (board.isWon() || board.isDraw()) {
+        board = Board();
+      }
+    }
+
+    AgentMCTS agent;
+    size_t move;
+    std::chrono::high_resolution_clock::time_point start =
+        std::chrono::high_resolution_clock::now();
+    agent.getMove(board, move,
+                  std::chrono::system_clock::now() +
+                      std::chrono::milliseconds(TIME_LIMIT));
+    std::chrono::high_resolution_clock::time_point end =
+        std::chrono::high_resolution_clock::now();
+    double elapsed =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+            .count() /
+        1000000.0;
+
+    // The search only stops before the deadline once the root is proven
+    bool proven = elapsed < TIME_LIMIT * 0.9;
+    numProven += proven;
+    totalPlayouts += agent.getPlayoutCount();
+    totalTime += elapsed;
+    if (verbose) {
+      std::cout << "Position " << i + 1 << " (" << numMoves
+                << " moves): " << elapsed << " ms, "
+                << agent.getPlayoutCount() << " playouts"
+                << (proven ? ", proven" : "") << std::endl;
+    }
+  }
+
+  std::cout << numProven << "/" << numTrials << " positions proven, "
+            << totalTime / numTrials << " ms/decision, "
+            << totalPlayouts / numTrials << " playouts/decision" << std::endl;
+}
+
+void Test::mctsGraphTrials(size_t numTrials, bool verbose) {
+  const size_t TIME_LIMIT = 500;
+  const size_t SMALL_BUDGET = 1 << 12;
+
+  // Search the same random openings with each agent
+  std::mt19937 generator(42);
+  std::vector<Board> positions;
+  for (size_t i = 0; i < 4; ++i) {
+    Board board;
+    for (size_t j = 0; j < 2 + i * 2; ++j) {
+      std::vector<size_t> sucs = board.getSuccessors();
+      board.handleMove(sucs[generator() % sucs.size()]);
+    }
+    positions.push_back(board);
+  }
+
+  const char *NAMES[3] = {"Tree", "Graph", "Small graph"};
+  for (size_t config = 0; config < 3; ++config) {
+    size_t totalPlayouts = 0;
+    size_t totalBytes = 0;
+    for (const Board &board : positions) {
+      std::chrono::system_clock::time_point endTime =
+          std::chrono::system_clock::now() +
+          std::chrono::milliseconds(TIME_LIMIT);
+      size_t move;
+      if (config == 0) {
+        AgentMCTS agent;
+        agent.getMove(board, move, endTime);
+        totalPlayouts += agent.getPlayoutCount();
+        totalBytes += agent.getMemoryBytes();
+      } else {
+        std::unique_ptr<AgentMCTSGraph> agent(
+            config == 1 ? new AgentMCTSGraph()
+                        : new AgentMCTSGraph(SMALL_BUDGET));
+        agent->getMove(board, move, endTime);
+        totalPlayouts += agent->getPlayoutCount();
+        totalBytes += agent->getMemoryBytes();
+      }
+    }
+
+    std::cout << NAMES[config] << ": "
+              << totalPlayouts * 1000.0 / (TIME_LIMIT * positions.size())
+              << " playouts/s, " << totalBytes / positions.size()
+              << " bytes of nodes/search, "
+              << static_cast<double>(totalBytes) / totalPlayouts
+              << " bytes/playout" << std::endl;
+  }
+
+  // Play the graph against the tree, as both X and O
+  size_t stats[2][3] = {{0, 0, 0}, {0, 0, 0}};
+  for (size_t side = 0; side < 2; ++side) {
+    for (size_t i = 0; i < numTrials; ++i) {
+      std::shared_ptr<Agent> graph = std::make_shared<AgentMCTSGraph>();
+      std::shared_ptr<Agent> tree = std::make_shared<AgentMCTS>();
+      Game game(side ? tree : graph, side ? graph : tree, TIME_LIMIT);
+      size_t winner = game.execute();
+      ++stats[side][winner];
+
+      if (verbose) {
+        std::cout << "Trial " << i + 1 << ": "
+                  << (winner == 2 ? "Draw"
+                                  : winner == side ? "Graph won" : "Tree won")
+                  << std::endl;
+      }
+    }
+  }
+
+  std::cout << "Graph as X: " << stats[0][0] << " wins, " << stats[0][1]
+            << " losses, " << stats[0][2] << " draws" << std::endl;
+  std::cout << "Graph as O: " << stats[1][1] << " wins, " << stats[1][0]
+            << " losses, " << stats[1][2] << " draws" << std::endl;
+}
+
+void Test::mctsRaveTrials(size_t numTrials, bool verbose) {
+  const size_t BUDGETS[4] = {1000, 4000, 16000, 64000};
+  const size_t NUM_POSITIONS = 32;
+  const size_t NUM_REPEATS = 4;
+  const size_t REFERENCE_PLAYOUTS = 400000;
+  const size_t TIME_LIMIT = 100;
+  std::chrono::system_clock::time_point noDeadline =
+      std::chrono::system_clock::time_point::max();
+
+  // Find the move of a long search without RAVE from random openings
+  std::mt19937 generator(42);
+  std::vector<Board> positions;
+  std::vector<size_t> referenceMoves;
+  for (size_t i = 0; i < NUM_POSITIONS; ++i) {
+    Board board;
+    for (size_t j = 0; j < 4 + i / 2; ++j) {
+      std::vector<size_t> sucs = board.getSuccessors();
+      board.handleMove(sucs[generator() % sucs.size()]);
+      if (board.isWon() || board.isDraw()) {
+        board = Board();
+      }
+    }
+    positions.push_back(board);
+
+    AgentMCTS reference;
+    reference.setPlayoutLimit(REFERENCE_PLAYOUTS);
+    size_t move;
+    reference.getMove(board, move, noDeadline);
+    referenceMoves.push_back(move);
+  }
+
+  // Search each position several times with a small playout budget, with and
+  // without RAVE, and with single and batched rollouts
+  const RolloutPolicy::Type ROLLOUTS[2] = {RolloutPolicy::RANDOM,
+                                           RolloutPolicy::BATCH};
+  for (size_t budget : BUDGETS) {
+    size_t agreements[2][2] = {{0, 0}, {0, 0}};
+    for (size_t batch = 0; batch < 2; ++batch) {
+      for (size_t rave = 0; rave < 2; ++rave) {
+        for (size_t i = 0; i < NUM_POSITIONS * NUM_REPEATS; ++i) {
+          AgentMCTS agent(AgentMCTS::DEFAULT_MAX_NODES, ROLLOUTS[batch]);
+          agent.setPlayoutLimit(budget);
+          if (rave) {
+            agent.setRave(AgentMCTS::DEFAULT_RAVE_EQUIVALENCE);
+          }
+          size_t move;
+          agent.getMove(positions[i % NUM_POSITIONS], move, noDeadline);
+          agreements[batch][rave] += move == referenceMoves[i % NUM_POSITIONS];
+        }
+      }
+    }
+
+    for (size_t batch = 0; batch < 2; ++batch) {
+      std::cout << budget << (batch ? " batched" : "") << " playouts: "
+                << agreements[batch][0] << "/" << NUM_POSITIONS * NUM_REPEATS
+                << " without RAVE, " << agreements[batch][1] << "/"
+                << NUM_POSITIONS * NUM_REPEATS << " with RAVE agree with a "
+                << REFERENCE_PLAYOUTS << " playout search" << std::endl;
+    }
+  }
+
+  // Play RAVE against plain UCT, as both X and O
+  size_t stats[2][3] = {{0, 0, 0}, {0, 0, 0}};
+  for (size_t side = 0; side < 2; ++side) {
+    for (size_t i = 0; i < numTrials; ++i) {
+      std::shared_ptr<AgentMCTS> rave = std::make_shared<AgentMCTS>();
+      std::shared_ptr<AgentMCTS> plain = std::make_shared<AgentMCTS>();
+      rave->setRave(AgentMCTS::DEFAULT_RAVE_EQUIVALENCE);
+      Game game(side ? plain : rave, side ? rave : plain, TIME_LIMIT);
+      size_t winner = game.execute();
+      ++stats[side][winner];
+
+      if (verbose) {
+        std::cout << "Trial " << i + 1 << ": "
+                  << (winner == 2 ? "Draw"
+                                  : winner == side ? "RAVE won" : "UCT won")
+                  << std::endl;
+      }
+    }
+  }
+
+  std::cout << "RAVE as X: " << stats[0][0] << " wins, " << stats[0][1]
+            << " losses, " << stats[0][2] << " draws" << std::endl;
+  std::cout << "RAVE as O: " << stats[1][1] << " wins, " << stats[1][0]
+            << " losses, " << stats[1][2] << " draws" << std::endl;
+}
+
+void Test::batchRolloutTrials(size_t numTrials, bool verbose) {
+  const size_t BATCH_SIZES[3] = {4, 8, 16};
+  const BatchRolloutPolicy::Backend BACKENDS[3] = {
+      BatchRolloutPolicy::SCALAR, BatchRolloutPolicy::AVX2,
+      BatchRolloutPolicy::AVX512};
+  const size_t TIME_LIMIT = 200;
+
+  // Play from the openings reached by random moves
+  std::mt19937 generator(42);
+  std::vector<Board> positions;
+  for (size_t i = 0; i < 64; ++i) {
+    Board board;
+    for (size_t j = 0; j < i % 8; ++j) {
+      std::vector<size_t> sucs = board.getSuccessors();
+      board.handleMove(sucs[generator() % sucs.size()]);
+    }
+    positions.push_back(board);
+  }
+
+  // Every backend must play exactly the games of the scalar backend, and
+  // record where each game stopped for RAVE
+  for (size_t batchSize : BATCH_SIZES) {
+    BatchRolloutPolicy scalar(42, batchSize, BatchRolloutPolicy::SCALAR);
+    std::vector<float> expected;
+    std::vector<RolloutPolicy::Game> expectedGames(positions.size() *
+                                                   batchSize);
+    for (size_t i = 0; i < positions.size(); ++i) {
+      expected.push_back(scalar.playoutGames(
+          positions[i], expectedGames.data() + i * batchSize));
+    }
+
+    for (BatchRolloutPolicy::Backend backend : BACKENDS) {
+      BatchRolloutPolicy policy(42, batchSize, backend);
+      if (policy.getBackend() != backend) {
+        continue;
+      }
+      BatchRolloutPolicy recorder(42, batchSize, backend);
+      std::vector<RolloutPolicy::Game> games(batchSize);
+      size_t matches = 0;
+      size_t gameMatches = 0;
+      for (size_t i = 0; i < positions.size(); ++i) {
+        Board board = positions[i];
+        matches += policy.playout(board) == expected[i];
+
+        // Each game continues from the position and stops where the player
+        // to move wins, or where the board is full for a draw
+        Board::Mask start[2] = {positions[i].getMask(0),
+                                positions[i].getMask(1)};
+        bool finished = positions[i].isWon() || positions[i].isDraw();
+        float total = recorder.playoutGames(positions[i], games.data());
+        for (size_t lane = 0; lane < batchSize; ++lane) {
+          const RolloutPolicy::Game &game = games[lane];
+          const RolloutPolicy::Game &scalarGame =
+              expectedGames[i * batchSize + lane];
+          Board::Mask all = game.masks[0] | game.masks[1];
+          size_t turn = __builtin_popcountll(all) % 2;
+          Board::Mask legal = (all + Board::BOTTOM_MASK) & Board::BOARD_MASK;
+          bool won = Board::getWinningPositions(game.masks[turn]) & legal;
+          bool valid = finished || (won ? game.reward == (turn ? -1 : 1)
+                                        : !legal && game.reward == 0);
+          valid = valid && !(game.masks[0] & game.masks[1]) &&
+                  (game.masks[0] & start[0]) == start[0] &&
+                  (game.masks[1] & start[1]) == start[1];
+          gameMatches += valid && total == expected[i] &&
+                         game.masks[0] == scalarGame.masks[0] &&
+                         game.masks[1] == scalarGame.masks[1] &&
+                         game.reward == scalarGame.reward;
+        }
+      }
+      std::cout << policy.getName() << ": " << matches << "/"
+                << positions.size() << " batches and " << gameMatches << "/"
+                << positions.size() * batchSize
+                << " recorded games match the scalar backend" << std::endl;
+    }
+  }
+
+  // Count the games each policy completes in one second
+  std::vector<std::unique_ptr<RolloutPolicy>> policies;
+  policies.emplace_back(new RandomRolloutPolicy(42));
+  for (size_t batchSize : BATCH_SIZES) {
+    for (BatchRolloutPolicy::Backend backend : BACKENDS) {
+      BatchRolloutPolicy *policy =
+          new BatchRolloutPolicy(42, batchSize, backend);
+      policies.emplace_back(policy);
+      if (policy->getBackend() != backend) {
+        policies.pop_back();
+      }
+    }
+  }
+  for (std::unique_ptr<RolloutPolicy> &policy : policies) {
+    size_t numGames = 0;
+    float totalReward = 0;
+    std::chrono::high_resolution_clock::time_point start =
+        std::chrono::high_resolution_clock::now();
+    std::chrono::high_resolution_clock::time_point end = start;
+    for (size_t i = 0; end - start < std::chrono::seconds(1); ++i) {
+      Board board = positions[i % positions.size()];
+      totalReward += policy->playout(board);
+      numGames += policy->getBatchSize();
+      end = std::chrono::high_resolution_clock::now();
+    }
+    double elapsed =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+            .count() /
+        1000000000.0;
+    std::cout << policy->getName() << ": " << numGames / elapsed
+              << " games/s (mean reward " << totalReward / numGames << ")"
+              << std::endl;
+  }
+
+  // Play MCTS with batched rollouts against single rollouts, as both X and O
+  size_t stats[2][3] = {{0, 0, 0}, {0, 0, 0}};
+  for (size_t side = 0; side < 2; ++side) {
+    for (size_t i = 0; i < numTrials; ++i) {
+      std::shared_ptr<Agent> batch = std::make_shared<AgentMCTS>(
+          AgentMCTS::DEFAULT_MAX_NODES, RolloutPolicy::BATCH);
+      std::shared_ptr<Agent> single = std::make_shared<AgentMCTS>();
+      Game game(side ? single : batch, side ? batch : single, TIME_LIMIT);
+      size_t winner = game.execute();
+      ++stats[side][winner];
+
+      if (verbose) {
+        std::cout << "Trial " << i + 1 << ": "
+                  << (winner == 2
+                          ? "Draw"
+                          : winner == side ? "Batch won" : "Single won")
+                  << std::endl;
+      }
+    }
+  }
+
+  std::cout << "Batch as X: " << stats[0][0] << " wins, " << stats[0][1]
+            << " losses, " << stats[0][2] << " draws" << std::endl;
+  std::cout << "Batch as O: " << stats[1][1] << " wins, " << stats[1][0]
+            << " losses, " << stats[1][2] << " draws" << std::endl;
+}
+
+namespace {
+/**
+ * \brief Scores a board by alpha-beta search to the end of the game, without
+ * the solver's pruning, move ordering or table
+ * \param board   The board to score, which must not be finished
+ * \param alpha   The lower bound of the window
+ * \param beta    The upper bound of the window
+ * \returns The score of board (see AgentSolver) if it lies within
+ * (alpha, beta), and otherwise a bound on the score
+ */
+int plainScore(Board &board, int alpha, int beta) {
+  // Winning with the next piece is the best any move can do
+  int numMoves = static_cast<int>(board.getNumMoves());
+  for (size_t move : board.getSuccessors()) {
+    board.handleMove(move);
+    bool won = board.isWon();
+    board.undoMove(move);
+    if (won) {
+      return (static_cast<int>(Board::SIZE) + 1 - numMoves) / 2;
+    }
+  }
+
+  for (size_t move : board.getSuccessors()) {
+    board.handleMove(move);
+    int score = board.isDraw() ? 0 : -plainScore(board, -beta, -alpha);
+    board.undoMove(move);
+    if (score >= beta) {
+      return score;
+    }
+    alpha = std::max(alpha, score);
+  }
+  return alpha;
+}
+}  // namespace
+
+void Test::solverTrials(size_t numTrials, bool verbose) {
+  const char *GRADES[3] = {"End (28-35 pieces)", "Middle (18-27 pieces)",
+                           "Begin (10-17 pieces)"};
+  const size_t MIN_PIECES[3] = {28, 18, 10};
+
+  std::mt19937 generator(42);
+  AgentSolver solver;
+  for (size_t grade = 0; grade < 3; ++grade) {
+    double totalTime = 0;
+    size_t totalNodes = 0;
+    for (size_t i = 0; i < numTrials; ++i) {
+      // Play random moves until the position has the grade's pieces, and
+      // start over if the game ends first
+      Board board;
+      size_t numPieces = MIN_PIECES[grade] + generator() % 8;
+      while (board.getNumMoves() < numPieces) {
+        std::vector<size_t> sucs = board.getSuccessors();
+        board.handleMove(sucs[generator() % sucs.size()]);
+        if (board.isWon() || board.isDraw()) {
+          board = Board();
+        }
+      }
+
+      std::chrono::high_resolution_clock::time_point start =
+          std::chrono::high_resolution_clock::now();
+      int score = solver.solve(board);
+      std::chrono::high_resolution_clock::time_point end =
+          std::chrono::high_resolution_clock::now();
+      double elapsed =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+              .count() /
+          1000000.0;
+      totalTime += elapsed;
+      totalNodes += solver.getNodeCount();
+
+      if (verbose) {
+        std::cout << GRADES[grade] << " position " << i + 1 << " ("
+                  << numPieces << " pieces): score " << score << ", "
+                  << elapsed << " ms, " << solver.getNodeCount() << " nodes"
+                  << std::endl;
+      }
+    }
+
+    std::cout << GRADES[grade] << ": " << totalTime / numTrials
+              << " ms/position, " << totalNodes / numTrials
+              << " nodes/position, " << totalNodes / totalTime / 1000
+              << "M nodes/s" << std::endl;
+  }
+
+  // Check the scores against a plain search to the end of the game, which
+  // can start from the first moves of the short Connect 3 games but only from
+  // near the end of longer games
+  size_t checkPieces = Board::CONNECT <= 3 ? 0 : 28;
+  size_t matches = 0;
+  double totalTime = 0;
+  for (size_t i = 0; i < numTrials; ++i) {
+    Board board;
+    size_t numPieces = checkPieces + generator() % 8;
+    while (board.getNumMoves() < numPieces) {
+      std::vector<size_t> sucs = board.getSuccessors();
+      board.handleMove(sucs[generator() % sucs.size()]);
+      if (board.isWon() || board.isDraw()) {
+        board = Board();
+      }
+    }
+
+    std::chrono::high_resolution_clock::time_point start =
+        std::chrono::high_resolution_clock::now();
+    int expected = plainScore(board, AgentSolver::MIN_SCORE - 1,
+                              AgentSolver::MAX_SCORE + 1);
+    std::chrono::high_resolution_clock::time_point end =
+        std::chrono::high_resolution_clock::now();
+    totalTime +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+            .count() /
+        1000000.0;
+    int score = solver.solve(board);
+    matches += score == expected;
+
+    if (verbose) {
+      std::cout << "Checked position " << i + 1 << " (" << numPieces
+                << " pieces): score " << score << ", plain search "
+                << expected << std::endl;
+    }
+  }
+  std::cout << "Plain search check (" << checkPieces << "-" << checkPieces + 7
+            << " pieces): " << matches << " of " << numTrials
+            << " scores match, " << totalTime / numTrials
+            << " ms/plain search" << std::endl;
+}
+
+void Test::bookTrials(size_t numTrials, size_t depth, bool verbose) {
+  const size_t ROOT_PLY = 14;
+  const char *PATH = "book-test.bin";
+
+  // Solve every board two moves after each random root board
+  std::mt19937 generator(42);
+  AgentSolver solver;
+  std::vector<Board> roots;
+  std::vector<Board> misses;
+  std::vector<std::pair<Board, int>> solved;
+  std::vector<uint64_t> entries;
+  while (roots.size() < numTrials) {
+    Board root;
+    while (root.getNumMoves() < ROOT_PLY && !root.isWon()) {
+      std::vector<size_t> sucs = root.getSuccessors();
+      root.handleMove(sucs[generator() % sucs.size()]);
+    }
+    if (root.isWon()) {
+      continue;
+    }
+
+    roots.push_back(root);
+    for (size_t first : root.getSuccessors()) {
+      Board child = root;
+      child.handleMove(first);
+      if (child.isWon()) {
+        continue;
+      }
+      misses.push_back(child);
+      for (size_t second : child.getSuccessors()) {
+        Board grandchild = child;
+        grandchild.handleMove(second);
+        if (!grandchild.isWon() && !grandchild.isDraw()) {
+          int score = solver.solve(grandchild);
+          solved.emplace_back(grandchild, score);
+          entries.push_back(
+              OpeningBook::makeEntry(grandchild.getCanonicalKey(), score));
+        }
+      }
+    }
+  }
+  OpeningBook::write(PATH, entries, ROOT_PLY + 2);
+
+  std::chrono::high_resolution_clock::time_point start =
+      std::chrono::high_resolution_clock::now();
+  OpeningBook book(PATH);
+  std::chrono::high_resolution_clock::time_point end =
+      std::chrono::high_resolution_clock::now();
+  std::cout << "Opened a book of " << book.size() << " boards in "
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(end -
+                                                                     start)
+                       .count() /
+                   1000.0
+            << " us" << std::endl;
+
+  // Every solved board and its mirror image must be found with its score
+  size_t mismatches = 0;
+  start = std::chrono::high_resolution_clock::now();
+  for (const std::pair<Board, int> &pair : solved) {
+    int score;
+    mismatches += !book.probe(pair.first, score) || score != pair.second;
+  }
+  end = std::chrono::high_resolution_clock::now();
+  double elapsed =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  for (const std::pair<Board, int> &pair : solved) {
+    Board mirror(Board::mirror(pair.first.getMask(0)),
+                 Board::mirror(pair.first.getMask(1)));
+    int score;
+    mismatches += !book.probe(mirror, score) || score != pair.second;
+  }
+  std::cout << "Hits: " << elapsed / solved.size() << " ns/lookup ("
+            << mismatches << " mismatches in " << 2 * solved.size()
+            << " lookups)" << std::endl;
+
+  // The boards between the roots and the book are not in the book
+  size_t found = 0;
+  start = std::chrono::high_resolution_clock::now();
+  for (const Board &board : misses) {
+    int score;
+    found += book.probe(board, score);
+  }
+  end = std::chrono::high_resolution_clock::now();
+  elapsed =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  std::cout << "Misses: " << elapsed / misses.size() << " ns/lookup ("
+            << found << " found)" << std::endl;
+
+  // Search from each root with and without the book
+  size_t nodes[2] = {0, 0};
+  double times[2] = {0, 0};
+  size_t sameMoves = 0;
+  for (const Board &root : roots) {
+    size_t moves[2];
+    for (size_t useBook = 0; useBook < 2; ++useBook) {
+      AgentMinimax agent(depth);
+      agent.setOpeningBook(useBook ? &book : nullptr);
+      start = std::chrono::high_resolution_clock::now();
+      agent.getMove(root, moves[useBook],
+                    std::chrono::system_clock::time_point::max());
+      end = std::chrono::high_resolution_clock::now();
+      nodes[useBook] += agent.getNodeCount();
+      times[useBook] +=
+          std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+              .count() /
+          1000000.0;
+      if (verbose) {
+        std::cout << (useBook ? "With book: " : "Without book: ") << "move "
+                  << moves[useBook] << ", " << agent.getNodeCount()
+                  << " nodes" << std::endl;
+      }
+    }
+    sameMoves += moves[0] == moves[1];
+  }
+  for (size_t useBook = 0; useBook < 2; ++useBook) {
+    std::cout << "Minimax depth " << depth
+              << (useBook ? " with book: " : " without book: ")
+              << nodes[useBook] / numTrials << " nodes/search, "
+              << times[useBook] / numTrials << " ms/search" << std::endl;
+  }
+  std::cout << "Same move in " << sameMoves << " of " << numTrials
+            << " searches" << std::endl;
+
+  std::remove(PATH);
+}
+
+void Test::bookGeneratorTrials(size_t numTrials, bool verbose) {
+  const size_t ROOT_PLY = 14;
+  const char *PATHS[3] = {"book-test-1.bin", "book-test-n.bin",
+                          "book-test-resume.bin"};
+
+  std::mt19937 generator(42);
+  size_t numPositions = 0;
+  double times[2] = {0, 0};
+  size_t resumed = 0;
+  size_t matches = 0;
+  for (size_t trial = 0; trial < numTrials; ++trial) {
+    Board root;
+    while (root.getNumMoves() < ROOT_PLY) {
+      std::vector<size_t> sucs = root.getSuccessors();
+      root.handleMove(sucs[generator() % sucs.size()]);
+      if (root.isWon()) {
+        root = Board();
+      }
+    }
+
+    // Generate the book with one thread and with one thread per core
+    double elapsed[2];
+    for (size_t i = 0; i < 2; ++i) {
+      BookGenerator bookGenerator(PATHS[i], ROOT_PLY + 3, root, i ? 0 : 1);
+      std::chrono::system_clock::time_point start =
+          std::chrono::system_clock::now();
+      bookGenerator.generate();
+      elapsed[i] = std::chrono::duration_cast<std::chrono::microseconds>(
+                       std::chrono::system_clock::now() - start)
+                       .count() /
+                   1000.0;
+      times[i] += elapsed[i];
+      numPositions += i ? 0 : bookGenerator.getNumPositions();
+    }
+
+    // Stop a generation halfway through, then resume it from its checkpoint
+    BookGenerator bookGenerator(PATHS[2], ROOT_PLY + 3, root, 1);
+    bool finished = bookGenerator.generate(
+        std::chrono::system_clock::now() +
+        std::chrono::microseconds(static_cast<size_t>(elapsed[0] * 500)));
+    resumed += !finished && bookGenerator.generate();
+
+    // Every book must be identical
+    std::string books[3];
+    for (size_t i = 0; i < 3; ++i) {
+      std::ifstream file(PATHS[i], std::ios::binary);
+      std::stringstream contents;
+      contents << file.rdbuf();
+      books[i] = contents.str();
+      std::remove(PATHS[i]);
+    }
+    bool match = books[0] == books[1] && books[0] == books[2];
+    matches += match;
+
+    if (verbose) {
+      std::cout << "Book " << trial + 1 << ": "
+                << bookGenerator.getNumPositions() << " positions, "
+                << elapsed[0] << " ms with 1 thread, " << elapsed[1]
+                << " ms with every core, "
+                << (finished ? "finished before the stop"
+                             : "stopped and resumed")
+                << (match ? "" : ", books differ") << std::endl;
+    }
+  }
+
+  std::cout << numPositions / numTrials << " positions/book" << std::endl
+            << "1 thread: " << times[0] / numTrials << " ms/book"
+            << std::endl
+            << std::thread::hardware_concurrency()
+            << " threads: " << times[1] / numTrials << " ms/book ("
+            << times[0] / times[1] << "x)" << std::endl
+            << "Resumed " << resumed << " of " << numTrials
+            << " stopped generations, " << matches << " of " << numTrials
+            << " books identical" << std::endl;
+}
+
+void Test::symmetryTrials(size_t numTrials, size_t depth, bool verbose) {
+  const size_t NUM_GAMES = 10000;
+  const size_t MAX_MINIMAX_PLY = 8;
+  const size_t SOLVER_PLY = 14;
+  const size_t TABLE_BYTES = 1 << 16;
+  const size_t GRAPH_MS = 1000;
+  const char *MODES[2] = {"plain", "symmetric"};
+
+  // Check the mirrored key of every board reached in random games
+  std::mt19937 generator(42);
+  std::vector<Board> boards;
+  for (size_t i = 0; i < NUM_GAMES; ++i) {
+    Board board;
+    while (!(board.isWon() || board.isDraw())) {
+      std::vector<size_t> sucs = board.getSuccessors();
+      board.handleMove(sucs[generator() % sucs.size()]);
+      boards.push_back(board);
+    }
+  }
+  size_t mismatches = 0;
+  for (const Board &board : boards) {
+    Board mirror(Board::mirror(board.getMask(0)),
+                 Board::mirror(board.getMask(1)));
+    mismatches += mirror.getKey() != board.getMirroredKey() ||
+                  mirror.getMirroredKey() != board.getKey() ||
+                  mirror.getCanonicalKey() != board.getCanonicalKey();
+  }
+  uint64_t checksum = 0;
+  std::chrono::high_resolution_clock::time_point start =
+      std::chrono::high_resolution_clock::now();
+  for (const Board &board : boards) {
+    checksum += board.getCanonicalKey();
+  }
+  std::chrono::high_resolution_clock::time_point end =
+      std::chrono::high_resolution_clock::now();
+  double elapsed =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  std::cout << "getCanonicalKey: " << elapsed / boards.size() << " ns/board ("
+            << mismatches << " mismatches in " << boards.size()
+            << " boards, checksum " << checksum << ")" << std::endl;
+
+  // Search random early boards with a small table, where mirrored boards are
+  // most common
+  size_t nodes[2] = {0, 0};
+  double times[2] = {0, 0};
+  size_t sameMoves = 0;
+  for (size_t trial = 0; trial < numTrials; ++trial) {
+    Board root;
+    size_t ply = generator() % (MAX_MINIMAX_PLY + 1);
+    while (root.getNumMoves() < ply) {
+      std::vector<size_t> sucs = root.getSuccessors();
+      root.handleMove(sucs[generator() % sucs.size()]);
+    }
+
+    size_t moves[2];
+    for (size_t symmetric = 0; symmetric < 2; ++symmetric) {
+      AgentMinimax agent(depth, TABLE_BYTES);
+      agent.setSymmetric(symmetric);
+      start = std::chrono::high_resolution_clock::now();
+      agent.getMove(root, moves[symmetric],
+                    std::chrono::system_clock::time_point::max());
+      end = std::chrono::high_resolution_clock::now();
+      nodes[symmetric] += agent.getNodeCount();
+      times[symmetric] +=
+          std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+              .count() /
+          1000000.0;
+      if (verbose) {
+        std::cout << "Minimax (" << MODES[symmetric] << ", " << ply
+                  << " pieces): move " << moves[symmetric] << ", "
+                  << agent.getNodeCount() << " nodes" << std::endl;
+      }
+    }
+    sameMoves += moves[0] == moves[1];
+  }
+  for (size_t symmetric = 0; symmetric < 2; ++symmetric) {
+    std::cout << "Minimax depth " << depth << " (" << MODES[symmetric]
+              << "): " << nodes[symmetric] / numTrials << " nodes/search, "
+              << times[symmetric] / numTrials << " ms/search" << std::endl;
+  }
+  std::cout << "Same move in " << sameMoves << " of " << numTrials
+            << " searches" << std::endl;
+
+  // Solve random boards with each kind of key
+  nodes[0] = nodes[1] = 0;
+  times[0] = times[1] = 0;
+  size_t sameScores = 0;
+  for (size_t trial = 0; trial < numTrials; ++trial) {
+    Board root;
+    while (root.getNumMoves() < SOLVER_PLY) {
+      std::vector<size_t> sucs = root.getSuccessors();
+      root.handleMove(sucs[generator() % sucs.size()]);
+      if (root.isWon()) {
+        root = Board();
+      }
+    }
+
+    int scores[2];
+    for (size_t symmetric = 0; symmetric < 2; ++symmetric) {
+      AgentSolver solver;
+      solver.setSymmetric(symmetric);
+      start = std::chrono::high_resolution_clock::now();
+      scores[symmetric] = solver.solve(root);
+      end = std::chrono::high_resolution_clock::now();
+      nodes[symmetric] += solver.getNodeCount();
+      times[symmetric] +=
+          std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+              .count() /
+          1000000.0;
+    }
+    sameScores += scores[0] == scores[1];
+  }
+  for (size_t symmetric = 0; symmetric < 2; ++symmetric) {
+    std::cout << "Solver (" << MODES[symmetric]
+              << "): " << nodes[symmetric] / numTrials << " nodes/solve, "
+              << times[symmetric] / numTrials << " ms/solve" << std::endl;
+  }
+  std::cout << "Same score in " << sameScores << " of " << numTrials
+            << " solves" << std::endl;
+
+  // Grow a graph from the empty board, where every position has a mirror
+  for (size_t symmetric = 0; symmetric < 2; ++symmetric) {
+    AgentMCTSGraph agent;
+    agent.setSymmetric(symmetric);
+    size_t move;
+    agent.getMove(Board(), move,
+                  std::chrono::system_clock::now() +
+                      std::chrono::milliseconds(GRAPH_MS));
+    std::cout << "MCTS graph (" << MODES[symmetric] << "): move " << move
+              << ", " << agent.getPlayoutCount() << " playouts, "
+              << agent.getNodeCount() << " nodes ("
+              << static_cast<double>(agent.getMemoryBytes()) /
+                     agent.getPlayoutCount()
+              << " bytes/playout)" << std::endl;
+  }
+}
+
+namespace {
+/**
+ * \struct ShiftBoardHasher
+ * \brief The hash used by BoardHasher before the Zobrist hash
+ */
+struct ShiftBoardHasher {
+  size_t operator()(const Board &b) const {
+    return b.getMask(0) ^ (b.getMask(1) << 16);
+  }
+};
+
+/**
+ * \brief Reports how well a hash spreads boards over an unordered_set
+ * \param name     The name of the hash
+ * \param boards   The distinct boards to store
+ */
+template <typename Hasher>
+void reportHashOccupancy(const std::string &name,
+                         const std::vector<Board> &boards) {
+  std::unordered_set<Board, Hasher> set(boards.begin(), boards.end());
+
+  // The bucket of a board holds every board which shares it
+  size_t usedBuckets = 0;
+  size_t maxBucket = 0;
+  double probes = 0;
+  for (size_t i = 0; i < set.bucket_count(); ++i) {
+    size_t size = set.bucket_size(i);
+    usedBuckets += size > 0;
+    maxBucket = std::max(maxBucket, size);
+    probes += size * (size + 1) / 2.0;
+  }
+
+  std::vector<size_t> hashes;
+  for (const Board &board : boards) {
+    hashes.push_back(Hasher()(board));
+  }
+  std::sort(hashes.begin(), hashes.end());
+  size_t collisions =
+      hashes.end() - std::unique(hashes.begin(), hashes.end());
+
+  size_t found = 0;
+  std::chrono::high_resolution_clock::time_point start =
+      std::chrono::high_resolution_clock::now();
+  for (const Board &board : boards) {
+    found += set.count(board);
+  }
+  std::chrono::high_resolution_clock::time_point end =
+      std::chrono::high_resolution_clock::now();
+  double elapsed =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+  std::cout << name << ": " << usedBuckets << " of " << set.bucket_count()
+            << " buckets used, " << static_cast<double>(boards.size()) /
+                                        usedBuckets
+            << " boards/used bucket, largest bucket " << maxBucket << ", "
+            << probes / boards.size() << " compares/lookup, " << collisions
+            << " 64-bit collisions, " << elapsed / boards.size()
+            << " ns/lookup (" << found << " found)" << std::endl;
+}
+}  // namespace
+
+void Test::hashTrials(size_t numTrials, size_t depth) {
+  const size_t MAX_ROOT_PLY = 16;
+
+  // Collect every board a full-width search from each random root visits
+  std::mt19937 generator(42);
+  std::unordered_set<uint64_t> keys;
+  std::vector<Board> boards;
+  for (size_t trial = 0; trial < numTrials; ++trial) {
+    Board root;
+    size_t ply = generator() % (MAX_ROOT_PLY + 1);
+    while (root.getNumMoves() < ply) {
+      std::vector<size_t> sucs = root.getSuccessors();
+      root.handleMove(sucs[generator() % sucs.size()]);
+      if (root.isWon()) {
+        root = Board();
+      }
+    }
+
+    std::vector<std::pair<Board, size_t>> stack = {{root, depth}};
+    while (!stack.empty()) {
+      Board board = stack.back().first;
+      size_t remaining = stack.back().second;
+      stack.pop_back();
+      if (!keys.insert(board.getKey()).second) {
+        continue;
+      }
+      boards.push_back(board);
+      if (remaining && !board.isWon() && !board.isDraw()) {
+        for (size_t move : board.getSuccessors()) {
+          Board child = board;
+          child.handleMove(move);
+          stack.emplace_back(child, remaining - 1);
+        }
+      }
+    }
+  }
+  std::shuffle(boards.begin(), boards.end(), generator);
+
+  // The incremental hash must match the hash of the same pieces placed at
+  // once, and undoing a move must restore it
+  size_t mismatches = 0;
+  for (const Board &board : boards) {
+    mismatches +=
+        Board(board.getMask(0), board.getMask(1)).getHash() != board.getHash();
+    if (!board.isDraw()) {
+      Board child = board;
+      size_t move = child.getSuccessors()[0];
+      child.handleMove(move);
+      child.undoMove(move);
+      mismatches += child.getHash() != board.getHash();
+    }
+  }
+  std::cout << boards.size() << " distinct boards (" << mismatches
+            << " incremental hash mismatches)" << std::endl;
+
+  reportHashOccupancy<ShiftBoardHasher>("Shift hash", boards);
+  reportHashOccupancy<BoardHasher>("Zobrist hash", boards);
+}
+
+namespace {
+/**
+ * \brief Determines whether a piece completes a line on a grid
+ * \param grid    The owner of each position (0 for X, 1 for O, 2 if empty),
+ * indexed by col * height + row
+ * \param height  The number of rows of the grid
+ * \param col     The column of the piece
+ * \param row     The row of the piece
+ * \param player  The owner of the piece
+ * \param length  The number of pieces in a line
+ * \returns True if the piece and length - 1 of player's pieces are in a row
+ */
+bool gridCompletesLine(const std::vector<size_t> &grid, size_t height,
+                       int col, int row, size_t player, size_t length) {
+  const int DIRECTIONS[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+  int width = grid.size() / height;
+  for (const int *d : DIRECTIONS) {
+    size_t count = 1;
+    for (int sign : {-1, 1}) {
+      int c = col + sign * d[0];
+      int r = row + sign * d[1];
+      while (c >= 0 && c < width && r >= 0 && r < static_cast<int>(height) &&
+             grid[c * height + r] == player) {
+        ++count;
+        c += sign * d[0];
+        r += sign * d[1];
+      }
+    }
+    if (count >= length) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * \brief Checks one board geometry against a plain grid and times it
+ * \param numTrials   The number of random games to play
+ * \param generator   The source of the random moves
+ * \returns The boards reached in the games
+ */
+template <size_t W, size_t H, size_t N = 4>
+std::vector<BasicBoard<W, H, N>> checkGeometry(size_t numTrials,
+                                               std::mt19937 &generator) {
+  typedef BasicBoard<W, H, N> B;
+  const typename B::Mask ONE = 1;
+
+  // Play random games on the board and on a grid, comparing every position
+  std::vector<std::vector<size_t>> games(numTrials);
+  std::vector<B> boards;
+  size_t mismatches = 0;
+  size_t numPositions = 0;
+  for (std::vector<size_t> &game : games) {
+    B board;
+    std::vector<size_t> grid(W * H, 2);
+    std::array<size_t, W> heights = {};
+    bool won = false;
+    while (!won && !board.isDraw()) {
+      // The successors are the open columns in MOVE_ORDER
+      std::vector<size_t> expected;
+      size_t fast = 0;
+      for (size_t i = 0; i < W; ++i) {
+        if (heights[B::MOVE_ORDER[i]] < H) {
+          expected.push_back(B::MOVE_ORDER[i]);
+          fast |= static_cast<size_t>(1) << i;
+        }
+        mismatches += board.isValidMove(i) != (heights[i] < H);
+      }
+      mismatches += board.getSuccessors() != expected;
+      mismatches += board.getSuccessorsFast() != fast;
+
+      // A threat is an empty position which completes four for its player
+      for (size_t player = 0; player < 2; ++player) {
+        typename B::Mask threats = 0;
+        for (size_t col = 0; col < W; ++col) {
+          for (size_t row = heights[col]; row < H; ++row) {
+            if (gridCompletesLine(grid, H, col, row, player, N)) {
+              threats |= ONE << (col * B::COLUMN_BITS + row);
+            }
+          }
+        }
+        mismatches += board.getThreatMask(player) != threats;
+      }
+
+      typename B::Mask mirrored = 0;
+      for (size_t col = 0; col < W; ++col) {
+        mirrored |= ((board.getKey() >> (col * B::COLUMN_BITS)) &
+                     ((ONE << B::COLUMN_BITS) - 1))
+                    << ((W - 1 - col) * B::COLUMN_BITS);
+      }
+      mismatches += board.getMirroredKey() != mirrored;
+
+      size_t move = expected[generator() % expected.size()];
+      size_t row = heights[move]++;
+      grid[move * H + row] = board.getTurn();
+      won = gridCompletesLine(grid, H, move, row, board.getTurn(), N);
+      board.handleMove(move);
+      game.push_back(move);
+      boards.push_back(board);
+      mismatches += board.isWon() != won;
+      mismatches += board.getNumMoves() != game.size();
+      ++numPositions;
+    }
+  }
+
+  // Replay the games to time handleMove and isWon
+  size_t checksum = 0;
+  std::chrono::high_resolution_clock::time_point start =
+      std::chrono::high_resolution_clock::now();
+  for (const std::vector<size_t> &game : games) {
+    B board;
+    for (size_t move : game) {
+      board.handleMove(move);
+      checksum += board.isWon();
+    }
+    checksum += board.getHash();
+  }
+  std::chrono::high_resolution_clock::time_point end =
+      std::chrono::high_resolution_clock::now();
+  double elapsed =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+  std::cout << W << "x" << H << " connect " << N << " ("
+            << sizeof(typename B::Mask) * 8 << "-bit masks): " << numPositions
+            << " positions, " << mismatches << " mismatches, "
+            << elapsed / numPositions
+            << " ns/move for handleMove + isWon (checksum " << checksum << ")"
+            << std::endl;
+  return boards;
+}
+
+/**
+ * \brief Determines whether a player has N in a row with one shift per token
+ * \param mask    The pieces of the player
+ * \returns True if mask holds a line of B::CONNECT tokens
+ * \note The O(N) check which BasicBoard::getLines replaces
+ */
+template <typename B>
+bool linearIsWon(typename B::Mask mask) {
+  for (size_t shift : {B::COLUMN_BITS - 1, B::COLUMN_BITS,
+                       B::COLUMN_BITS + 1, static_cast<size_t>(1)}) {
+    typename B::Mask lines = mask;
+    for (size_t i = 1; i < B::CONNECT; ++i) {
+      lines &= mask >> (i * shift);
+    }
+    if (lines) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * \brief Checks and times the win and threat detection of one value of N
+ * \param numTrials   The number of random games to play
+ * \param generator   The source of the random moves
+ */
+template <size_t W, size_t H, size_t N>
+void benchmarkConnect(size_t numTrials, std::mt19937 &generator) {
+  typedef BasicBoard<W, H, N> B;
+  std::vector<B> boards = checkGeometry<W, H, N>(numTrials, generator);
+
+  size_t mismatches = 0;
+  for (const B &board : boards) {
+    mismatches +=
+        board.isWon() != linearIsWon<B>(board.getMask(!board.getTurn()));
+  }
+
+  // Time each check over every board, keeping a count so none is skipped
+  size_t count = 0;
+  std::chrono::high_resolution_clock::time_point start =
+      std::chrono::high_resolution_clock::now();
+  for (const B &board : boards) {
+    count += board.isWon();
+  }
+  std::chrono::high_resolution_clock::time_point end =
+      std::chrono::high_resolution_clock::now();
+  double doubling =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+  start = std::chrono::high_resolution_clock::now();
+  for (const B &board : boards) {
+    count += linearIsWon<B>(board.getMask(!board.getTurn()));
+  }
+  end = std::chrono::high_resolution_clock::now();
+  double linear =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+  start = std::chrono::high_resolution_clock::now();
+  for (const B &board : boards) {
+    std::array<size_t, 2> threatCount = board.getThreatCount();
+    count += threatCount[0] + threatCount[1];
+  }
+  end = std::chrono::high_resolution_clock::now();
+  double threats =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+  std::cout << "  isWon: " << doubling / boards.size()
+            << " ns (shift doubling), " << linear / boards.size()
+            << " ns (one shift per token), " << mismatches
+            << " mismatches; getThreatCount: " << threats / boards.size()
+            << " ns (count " << count << ")" << std::endl;
+}
+
+/**
+ * \brief Plays a game between two minimax agents on a board geometry
+ * \param xDepth  The search depth of the X agent
+ * \param oDepth  The search depth of the O agent
+ */
+template <typename B>
+void playGeometryGame(size_t xDepth, size_t oDepth) {
+  std::shared_ptr<BasicAgent<B>> ax(new BasicAgentMinimax<B>(xDepth));
+  std::shared_ptr<BasicAgent<B>> ao(new BasicAgentMinimax<B>(oDepth));
+  BasicGame<B> game(ax, ao, 10000);
+  size_t winner = game.execute();
+
+  std::cout << B::WIDTH << "x" << B::HEIGHT << " connect " << B::CONNECT
+            << ", minimax depth " << xDepth << " (X) vs depth " << oDepth
+            << " (O): "
+            << (winner == 0 ? "X won" : winner == 1 ? "O won" : "draw")
+            << std::endl;
+  game.printBoard(std::cout);
+}
+}  // namespace
+
+void Test::geometryTrials(size_t numTrials) {
+  std::mt19937 generator(42);
+  checkGeometry<7, 6>(numTrials, generator);
+  checkGeometry<8, 7>(numTrials, generator);
+  checkGeometry<9, 7>(numTrials, generator);
+  checkGeometry<10, 10>(numTrials, generator);
+  playGeometryGame<BasicBoard<8, 7, 4>>(6, 4);
+  playGeometryGame<BasicBoard<9, 7, 5>>(6, 4);
+}
+
+void Test::connectTrials(size_t numTrials) {
+  std::mt19937 generator(42);
+  benchmarkConnect<7, 6, 3>(numTrials, generator);
+  benchmarkConnect<7, 6, 4>(numTrials, generator);
+  benchmarkConnect<7, 6, 5>(numTrials, generator);
+  benchmarkConnect<7, 6, 6>(numTrials, generator);
+  benchmarkConnect<10, 10, 5>(numTrials, generator);
+  benchmarkConnect<10, 10, 8>(numTrials, generator);
+  benchmarkConnect<10, 10, 10>(numTrials, generator);
+}
+
+void Test::forcedMoveTrials(size_t numTrials, size_t depth, bool verbose) {
+  const size_t NUM_GAMES = 2000;
+  const size_t MAX_ROOT_PLY = 16;
+  const char *MODES[2] = {"all moves", "forced-move pruning"};
+
+  // Check the move queries of every board reached in random games against
+  // playing each move
+  std::mt19937 generator(42);
+  std::vector<Board> boards;
+  for (size_t i = 0; i < NUM_GAMES; ++i) {
+    Board board;
+    while (!(board.isWon() || board.isDraw())) {
+      boards.push_back(board);
+      std::vector<size_t> sucs = board.getSuccessors();
+      board.handleMove(sucs[generator() % sucs.size()]);
+    }
+  }
+  size_t mismatches = 0;
+  for (const Board &board : boards) {
+    uint64_t wins = 0;
+    uint64_t blocks = 0;
+    uint64_t nonLosing = 0;
+    for (size_t move : board.getSuccessors()) {
+      uint64_t position = board.getLegalMask() &
+                          (Board::COLUMN_MASK << (move * Board::COLUMN_BITS));
+      Board child = board;
+      child.handleMove(move);
+      wins |= child.isWon() ? position : 0;
+      nonLosing |= child.winningMoves() ? 0 : position;
+      Board opponent(board.getMask(0) | (board.getTurn() ? position : 0),
+                     board.getMask(1) | (board.getTurn() ? 0 : position));
+      blocks |= opponent.isWon() ? position : 0;
+    }
+    mismatches += board.winningMoves() != wins ||
+                  board.opponentWinningMoves() != blocks ||
+                  board.possibleNonLosingMoves() != nonLosing;
+  }
+  uint64_t checksum = 0;
+  std::chrono::high_resolution_clock::time_point start =
+      std::chrono::high_resolution_clock::now();
+  for (const Board &board : boards) {
+    checksum += board.winningMoves() + board.possibleNonLosingMoves();
+  }
+  std::chrono::high_resolution_clock::time_point end =
+      std::chrono::high_resolution_clock::now();
+  double elapsed =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  std::cout << "winningMoves + possibleNonLosingMoves: "
+            << elapsed / boards.size() << " ns/board (" << mismatches
+            << " mismatches in " << boards.size() << " boards, checksum "
+            << checksum << ")" << std::endl;
+
+  // Search the same random boards at every depth with and without pruning
+  std::vector<Board> roots;
+  for (size_t trial = 0; trial < numTrials; ++trial) {
+    Board root;
+    size_t ply = generator() % (MAX_ROOT_PLY + 1);
+    while (root.getNumMoves() < ply) {
+      std::vector<size_t> sucs = root.getSuccessors();
+      root.handleMove(sucs[generator() % sucs.size()]);
+      if (root.isWon()) {
+        root = Board();
+      }
+    }
+    roots.push_back(root);
+  }
+  for (size_t d = 1; d <= depth; ++d) {
+    size_t nodes[2] = {0, 0};
+    double times[2] = {0, 0};
+    size_t sameValues = 0;
+    size_t sameMoves = 0;
+    for (const Board &root : roots) {
+      size_t moves[2];
+      int values[2];
+      for (size_t prune = 0; prune < 2; ++prune) {
+        AgentMinimax agent(d);
+        agent.setForcedMovePruning(prune);
+        start = std::chrono::high_resolution_clock::now();
+        agent.getMove(root, moves[prune],
+                      std::chrono::system_clock::time_point::max());
+        end = std::chrono::high_resolution_clock::now();
+        nodes[prune] += agent.getNodeCount();
+        values[prune] = agent.getValue();
+        times[prune] +=
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+                .count() /
+            1000000.0;
+        if (verbose) {
+          std::cout << "Depth " << d << " (" << MODES[prune] << ", "
+                    << root.getNumMoves() << " pieces): move " << moves[prune]
+                    << ", value " << values[prune] << ", "
+                    << agent.getNodeCount() << " nodes" << std::endl;
+        }
+      }
+      sameValues += values[0] == values[1];
+      sameMoves += moves[0] == moves[1];
+    }
+
+    // Pruning must never change the value of a search, though it may choose
+    // a different move of the same value
+    std::cout << "Depth " << d << ": " << nodes[0] / numTrials << " -> "
+              << nodes[1] / numTrials << " nodes/search ("
+              << 100.0 * nodes[1] / nodes[0] << "%), " << times[0] / numTrials
+              << " -> " << times[1] / numTrials << " ms/search, same value in "
+              << sameValues << " and same move in " << sameMoves << " of "
+              << numTrials << " searches" << std::endl;
+    assert(sameValues == numTrials);
+  }
+}
+
+void Test::pvsTrials(size_t numTrials, size_t depth, bool verbose) {
+  const size_t MAX_ROOT_PLY = 16;
+  const size_t TABLE_BYTES = 1 << 24;
+  const char *MODES[2] = {"full window", "PVS"};
+
+  std::mt19937 generator(42);
+  std::vector<Board> roots;
+  for (size_t trial = 0; trial < numTrials; ++trial) {
+    Board root;
+    size_t ply = generator() % (MAX_ROOT_PLY + 1);
+    while (root.getNumMoves() < ply) {
+      std::vector<size_t> sucs = root.getSuccessors();
+      root.handleMove(sucs[generator() % sucs.size()]);
+      if (root.isWon()) {
+        root = Board();
+      }
+    }
+    roots.push_back(root);
+  }
+
+  // Search the same random boards at every depth with each kind of window,
+  // first without a table to check the values, then with a table to time
+  for (size_t d = 1; d <= depth; ++d) {
+    size_t nodes[2][2] = {{0, 0}, {0, 0}};
+    double times[2] = {0, 0};
+    size_t sameValues = 0;
+    for (const Board &root : roots) {
+      int values[2];
+      for (size_t table = 0; table < 2; ++table) {
+        for (size_t pvs = 0; pvs < 2; ++pvs) {
+          AgentMinimax agent(d, table ? TABLE_BYTES : 0);
+          agent.setPrincipalVariationSearch(pvs);
+          size_t move;
+          std::chrono::high_resolution_clock::time_point start =
+              std::chrono::high_resolution_clock::now();
+          agent.getMove(root, move,
+                        std::chrono::system_clock::time_point::max());
+          std::chrono::high_resolution_clock::time_point end =
+              std::chrono::high_resolution_clock::now();
+          nodes[table][pvs] += agent.getNodeCount();
+          if (table) {
+            times[pvs] += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              end - start)
+                              .count() /
+                          1000000.0;
+          } else {
+            values[pvs] = agent.getValue();
+          }
+          if (verbose) {
+            std::cout << "Depth " << d << " (" << MODES[pvs]
+                      << (table ? ", table, " : ", no table, ")
+                      << root.getNumMoves() << " pieces): move " << move
+                      << ", value " << agent.getValue() << ", "
+                      << agent.getNodeCount() << " nodes" << std::endl;
+          }
+        }
+      }
+      sameValues += values[0] == values[1];
+    }
+
+    std::cout << "Depth " << d << ": " << nodes[0][0] / numTrials << " -> "
+              << nodes[0][1] / numTrials << " nodes/search without a table ("
+              << 100.0 * nodes[0][1] / nodes[0][0] << "%), "
+              << nodes[1][0] / numTrials << " -> " << nodes[1][1] / numTrials
+              << " with a table (" << 100.0 * nodes[1][1] / nodes[1][0]
+              << "%), " << times[0] / numTrials << " -> "
+              << times[1] / numTrials << " ms/search, same value in "
+              << sameValues << " of " << numTrials << " searches" << std::endl;
+  }
+}
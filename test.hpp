@@ -55,6 +55,211 @@ class Test {
    * \param maxDepth    The highest depth to test (inclusive)
    */
   static void pairwiseDepthTrials(size_t minDepth, size_t maxDepth);
+
+  /**
+   * \brief Times Board::handleMove and full minimax searches
+   * \param numTrials   The number of times to replay each set of games
+   * \param depth       The depth to use for the minimax searches
+   */
+  static void boardBenchmark(size_t numTrials, size_t depth);
+
+  /**
+   * \brief Measures how iterative deepening minimax uses its time budget
+   * \param numTrials   The number of positions to search for each budget
+   * \param verbose     Print the result of every search
+   */
+  static void deadlineTrials(size_t numTrials, bool verbose = false);
+
+  /**
+   * \brief Measures how parallel minimax search scales with thread count
+   * \note Both Lazy SMP and YBWC are measured, then YBWC with the random
+   * benchmark heuristic, whose threads each draw from their own generator
+   * \param numTrials   The number of positions to search
+   * \param depth       The depth to which each position is searched
+   */
+  static void threadScalingTrials(size_t numTrials, size_t depth);
+
+  /**
+   * \brief Compares the speed and strength of the MCTS rollout policies
+   * \param numTrials   The number of games played by each side
+   * \param verbose     Print the result of every game
+   */
+  static void rolloutTrials(size_t numTrials, bool verbose = false);
+
+  /**
+   * \brief Measures how tree-parallel MCTS scales with thread count
+   * \note Reports playouts per second for several thread counts, then plays
+   * MCTS with 4 threads against MCTS with 1 thread at the same time limit
+   * \param numTrials   The number of games played by each side
+   * \param verbose     Print the result of every game
+   */
+  static void mctsThreadTrials(size_t numTrials, bool verbose = false);
+
+  /**
+   * \brief Compares root-parallel MCTS against a single tree
+   * \note Every search is given the same total number of playouts.  Reports
+   * how often the move of each ensemble size agrees with a longer
+   * single-tree search, then plays 4 trees against 1 tree.
+   * \param numTrials   The number of games played by each side
+   * \param verbose     Print the result of every game
+   */
+  static void mctsRootTrials(size_t numTrials, bool verbose = false);
+
+  /**
+   * \brief Measures how many playouts MCTS keeps by reusing its tree
+   * \note Plays MCTS with tree reuse against MCTS without it, and reports
+   * the playouts behind each decision of both agents
+   * \param numTrials   The number of games played by each side
+   * \param verbose     Print the result of every game
+   */
+  static void mctsReuseTrials(size_t numTrials, bool verbose = false);
+
+  /**
+   * \brief Measures how often MCTS proves the outcome of late positions
+   * \param numTrials   The number of positions to search
+   * \param verbose     Print the result of every search
+   */
+  static void mctsSolverTrials(size_t numTrials, bool verbose = false);
+
+  /**
+   * \brief Compares MCTS over a graph of positions with MCTS over a tree
+   * \note Reports the playouts and node memory of each search from the same
+   * openings, including a graph with a small node budget, then plays the
+   * graph against the tree
+   * \param numTrials   The number of games played by each side
+   * \param verbose     Print the result of every game
+   */
+  static void mctsGraphTrials(size_t numTrials, bool verbose = false);
+
+  /**
+   * \brief Measures how many playouts MCTS needs with and without RAVE
+   * \note Reports how often the move of each playout budget, with single
+   * and with batched rollouts, agrees with a much longer search, then plays
+   * RAVE against plain UCT at a short time limit
+   * \param numTrials   The number of games played by each side
+   * \param verbose     Print the result of every game
+   */
+  static void mctsRaveTrials(size_t numTrials, bool verbose = false);
+
+  /**
+   * \brief Measures the throughput of batched SIMD rollouts
+   * \note Checks that every backend plays and records the same finished
+   * games as the scalar backend, reports games/s for each backend and batch
+   * size, then plays MCTS with batched rollouts against MCTS with single
+   * rollouts
+   * \param numTrials   The number of games played by each side
+   * \param verbose     Print the result of every game
+   */
+  static void batchRolloutTrials(size_t numTrials, bool verbose = false);
+
+  /**
+   * \brief Measures how long the solver takes on positions graded by
+   * difficulty
+   * \note The positions are taken from random games.  Fewer pieces on the
+   * board make a position harder to solve.  Then checks the scores of random
+   * positions against a plain alpha-beta search to the end of the game, from
+   * the first moves with Connect 3 (make CONNECT=3) and near the end
+   * otherwise.
+   * \param numTrials   The number of positions of each grade
+   * \param verbose     Print the score and cost of every position
+   */
+  static void solverTrials(size_t numTrials, bool verbose = false);
+
+  /**
+   * \brief Measures lookups in an opening book and their effect on minimax
+   * \note Builds a book of the boards two moves after each of numTrials random
+   * boards, then checks and times lookups of those boards and their mirror
+   * images, and compares minimax searches from the random boards with and
+   * without the book.
+   * \param numTrials   The number of random boards
+   * \param depth       The depth of the minimax searches
+   * \param verbose     Print the results of every search
+   */
+  static void bookTrials(size_t numTrials, size_t depth, bool verbose = false);
+
+  /**
+   * \brief Compares book generation with one thread and with every core, and
+   * checks that an interrupted generation resumes to the same book
+   * \note Each book holds every board up to three moves after a random
+   * board.
+   * \param numTrials   The number of random boards
+   * \param verbose     Print the results for every book
+   */
+  static void bookGeneratorTrials(size_t numTrials, bool verbose = false);
+
+  /**
+   * \brief Compares the caches of the agents with and without symmetric
+   * (mirror-folded) keys
+   * \note Checks Board::getMirroredKey against mirrored boards and times it,
+   * then compares minimax searches and solves from random boards and graph
+   * MCTS searches from the empty board with each kind of key.
+   * \param numTrials   The number of random boards
+   * \param depth       The depth of the minimax searches
+   * \param verbose     Print the results of every search
+   */
+  static void symmetryTrials(size_t numTrials, size_t depth,
+                             bool verbose = false);
+
+  /**
+   * \brief Compares BoardHasher with the hash it replaced on the boards
+   * visited by minimax searches
+   * \note Checks the incremental hash of every board first.  Then fills an
+   * unordered_set with every board within depth moves of numTrials random
+   * boards using each hash, and reports the occupancy of its buckets, the
+   * boards whose full 64-bit hashes collide, and the time to look up every
+   * board.
+   * \param numTrials   The number of random boards
+   * \param depth       The depth of the searches
+   */
+  static void hashTrials(size_t numTrials, size_t depth);
+
+  /**
+   * \brief Checks boards of several sizes against a plain grid
+   * \note Plays random games on 7x6, 8x7, 9x7 and 10x10 boards, compares the
+   * successors, threats, wins and mirrored keys of every position with those
+   * found by scanning a grid, and times replaying the games.  Then plays a
+   * game between minimax agents on the 8x7 board and a game of Connect 5 on
+   * the 9x7 board.
+   * \param numTrials   The number of random games on each board
+   */
+  static void geometryTrials(size_t numTrials);
+
+  /**
+   * \brief Compares the win and threat detection of several values of N
+   * \note For Connect 3 to Connect 10 on 7x6 and 10x10 boards, checks every
+   * position of random games against a plain grid and against a win check
+   * with one shift per token, and times isWon, the check with one shift per
+   * token, and getThreatCount.
+   * \param numTrials   The number of random games for each N
+   */
+  static void connectTrials(size_t numTrials);
+
+  /**
+   * \brief Measures how much forced-move pruning shrinks minimax searches
+   * \note Checks Board::winningMoves, Board::opponentWinningMoves and
+   * Board::possibleNonLosingMoves against playing each move on the boards of
+   * random games, then searches random boards at every depth up to depth
+   * with and without pruning, asserting that pruning never changes the value
+   * of a search
+   * \param numTrials   The number of random boards to search
+   * \param depth       The deepest search
+   * \param verbose     Print the results of every search
+   */
+  static void forcedMoveTrials(size_t numTrials, size_t depth,
+                               bool verbose = false);
+
+  /**
+   * \brief Measures how much principal variation search shrinks minimax
+   * searches
+   * \note Searches random boards at every depth up to depth with every move
+   * searched with the full window and with principal variation search.  The
+   * searches without a table check that both find the same value, and the
+   * searches with a table are compared by nodes and time.
+   * \param numTrials   The number of random boards to search
+   * \param depth       The deepest search
+   * \param verbose     Print the results of every search
+   */
+  static void pvsTrials(size_t numTrials, size_t depth, bool verbose = false);
 };
 
 #endif  // TEST_HPP_
@@ -0,0 +1,121 @@
+/**
+ * \file transposition-table.cpp
+ * \copyright Matthew Calligaro
+ * \date December 2019
+ * \brief Implements the TranspositionTable class
+ */
+
+#include "transposition-table.hpp"
+#include <atomic>
+#include <memory>
+
+TranspositionTable::TranspositionTable(size_t bytes)
+    : bucketMask_{0}, numBuckets_{0}, age_{0} {
+  // Use the largest power of two number of buckets which fits in bytes
+  size_t maxBuckets = bytes / sizeof(Bucket);
+  if (maxBuckets) {
+    numBuckets_ = 1;
+    while (numBuckets_ * 2 <= maxBuckets) {
+      numBuckets_ *= 2;
+    }
+    bucketMask_ = numBuckets_ - 1;
+    buckets_.reset(new Bucket[numBuckets_]());
+  }
+}
+
+bool TranspositionTable::probe(uint64_t key, Entry &entry) const {
+  if (!numBuckets_) {
+    return false;
+  }
+
+  Slot *bucket = getBucket(key);
+  for (size_t i = 0; i < BUCKET_SIZE; ++i) {
+    uint64_t data = bucket[i].data.load(std::memory_order_relaxed);
+    uint64_t check = bucket[i].check.load(std::memory_order_relaxed);
+    if (data && (check ^ data) == key) {
+      entry = unpack(data);
+      return true;
+    }
+  }
+  return false;
+}
+
+void TranspositionTable::store(uint64_t key, int32_t value, size_t depth,
+                               Bound bound, size_t move) {
+  if (!numBuckets_) {
+    return;
+  }
+
+  // Prefer the slot already storing key, then an empty slot, then the slot
+  // with the lowest depth after penalizing entries from older searches
+  Slot *bucket = getBucket(key);
+  Slot *victim = bucket;
+  uint64_t victimData = 0;
+  int victimPriority = 1 << 16;
+  for (size_t i = 0; i < BUCKET_SIZE; ++i) {
+    uint64_t data = bucket[i].data.load(std::memory_order_relaxed);
+    uint64_t check = bucket[i].check.load(std::memory_order_relaxed);
+    if (!data || (check ^ data) == key) {
+      victim = bucket + i;
+      victimData = data;
+      break;
+    }
+
+    Entry entry = unpack(data);
+    int priority = entry.depth - 4 * static_cast<uint8_t>(age_ - entry.age);
+    if (priority < victimPriority) {
+      victim = bucket + i;
+      victimPriority = priority;
+    }
+  }
+
+  // Keep the previous best move if this search did not find one
+  if (move == NO_MOVE && victimData) {
+    move = unpack(victimData).move;
+  }
+
+  uint64_t data = pack(value, depth, bound, move, age_);
+  victim->check.store(key ^ data, std::memory_order_relaxed);
+  victim->data.store(data, std::memory_order_relaxed);
+}
+
+void TranspositionTable::newSearch() { ++age_; }
+
+void TranspositionTable::clear() {
+  for (size_t i = 0; i < numBuckets_; ++i) {
+    for (Slot &slot : buckets_[i].slots) {
+      slot.check.store(0, std::memory_order_relaxed);
+      slot.data.store(0, std::memory_order_relaxed);
+    }
+  }
+  age_ = 0;
+}
+
+size_t TranspositionTable::getCapacity() const {
+  return numBuckets_ * BUCKET_SIZE;
+}
+
+TranspositionTable::Slot *TranspositionTable::getBucket(uint64_t key) const {
+  // Fibonacci hashing spreads the structured board keys over the buckets
+  uint64_t hash = key * 0x9E3779B97F4A7C15UL;
+  return buckets_[(hash >> 32) & bucketMask_].slots;
+}
+
+uint64_t TranspositionTable::pack(int32_t value, size_t depth, Bound bound,
+                                  size_t move, uint8_t age) {
+  return static_cast<uint32_t>(value) |
+         (static_cast<uint64_t>(depth > 255 ? 255 : depth) << 32) |
+         (static_cast<uint64_t>(bound) << 40) |
+         (static_cast<uint64_t>(move & NO_MOVE) << 42) |
+         (static_cast<uint64_t>(age) << 48);
+}
+
+TranspositionTable::Entry TranspositionTable::unpack(uint64_t data) {
+  Entry entry;
+  entry.value = static_cast<int32_t>(static_cast<uint32_t>(data));
+  entry.depth = (data >> 32) & 0xFF;
+  entry.bound = static_cast<Bound>((data >> 40) & 3);
+  entry.move = (data >> 42) & NO_MOVE;
+  entry.age = (data >> 48) & 0xFF;
+  return entry;
+}
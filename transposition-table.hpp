@@ -0,0 +1,171 @@
+/**
+ * \file transposition-table.hpp
+ * \copyright Matthew Calligaro
+ * \date December 2019
+ * \brief Declares the TranspositionTable class
+ */
+
+#ifndef TRANSPOSITION_TABLE_HPP_
+#define TRANSPOSITION_TABLE_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+/**
+ * \class TranspositionTable
+ * \brief A fixed-size hash table storing the results of previous searches
+ * \note The table is open-addressed with buckets of BUCKET_SIZE entries which
+ * share a cache line.  When a bucket is full, the entry with the lowest depth
+ * (with entries from older searches counting as shallower) is replaced.
+ * The table can be shared by several searching threads without locks: each
+ * slot stores its key XORed with its data, so a slot torn by two threads
+ * writing at once no longer matches any key and is ignored.
+ */
+class TranspositionTable {
+ public:
+  /** \brief Describes how a stored value relates to the true minimax value */
+  enum Bound : uint8_t {
+    /** \brief The true value is at least the stored value */
+    LOWER = 1,
+    /** \brief The true value is at most the stored value */
+    UPPER = 2,
+    /** \brief The stored value is the true value */
+    EXACT = LOWER | UPPER
+  };
+
+  /**
+   * \struct Entry
+   * \brief The unpacked contents of a table entry
+   */
+  struct Entry {
+    /** \brief The (possibly bounded) minimax value of the board */
+    int32_t value;
+
+    /** \brief The depth of the search which produced value */
+    uint8_t depth;
+
+    /** \brief How value relates to the true minimax value */
+    Bound bound;
+
+    /** \brief The best move found by the search, or NO_MOVE */
+    uint8_t move;
+
+    /** \brief The search during which the entry was stored */
+    uint8_t age;
+  };
+
+  /** \brief The move stored when a search did not find a best move */
+  static const size_t NO_MOVE = 15;
+
+  /** \brief The number of entries in each bucket */
+  static const size_t BUCKET_SIZE = 4;
+
+  TranspositionTable() = delete;
+  TranspositionTable(const TranspositionTable &other) = delete;
+
+  /**
+   * \brief Creates an empty table which fits in a memory budget
+   * \param bytes   The maximum number of bytes used by the table
+   * \note The number of buckets is the largest power of two which fits in
+   * bytes.  A budget smaller than one bucket disables the table.
+   */
+  explicit TranspositionTable(size_t bytes);
+
+  ~TranspositionTable() = default;
+  TranspositionTable &operator=(const TranspositionTable &other) = delete;
+
+  /**
+   * \brief Looks up a board in the table
+   * \param key     The unique key of the board (see Board::getKey)
+   * \param entry   The stored entry for the board (output)
+   * \returns True if the board was found
+   */
+  bool probe(uint64_t key, Entry &entry) const;
+
+  /**
+   * \brief Stores the result of a search in the table
+   * \param key     The unique key of the board (see Board::getKey)
+   * \param value   The value returned by the search
+   * \param depth   The depth of the search
+   * \param bound   How value relates to the true minimax value
+   * \param move    The best move found by the search, or NO_MOVE
+   */
+  void store(uint64_t key, int32_t value, size_t depth, Bound bound,
+             size_t move);
+
+  /**
+   * \brief Marks the start of a new search so older entries are replaced first
+   */
+  void newSearch();
+
+  /**
+   * \brief Removes every entry from the table
+   */
+  void clear();
+
+  /**
+   * \brief Returns the number of entries the table can hold
+   * \returns The capacity of the table
+   */
+  size_t getCapacity() const;
+
+ private:
+  /**
+   * \struct Slot
+   * \brief A packed table entry
+   * \note data stores value in bits 0-31, depth in bits 32-39, bound in bits
+   * 40-41, move in bits 42-45, and age in bits 48-55.  A data of 0 marks an
+   * empty slot, since every stored entry has a non-zero bound.  check stores
+   * the key XOR data.
+   */
+  struct Slot {
+    std::atomic<uint64_t> check;
+    std::atomic<uint64_t> data;
+  };
+
+  /**
+   * \struct Bucket
+   * \brief The slots which may store a key, aligned to one cache line
+   */
+  struct alignas(64) Bucket {
+    Slot slots[BUCKET_SIZE];
+  };
+
+  static_assert(sizeof(Bucket) == 64, "A bucket must fill one cache line");
+
+  /** \brief The buckets of the table, stored contiguously */
+  std::unique_ptr<Bucket[]> buckets_;
+
+  /** \brief The number of buckets minus one (the buckets are a power of 2) */
+  size_t bucketMask_;
+
+  /** \brief The number of buckets in the table */
+  size_t numBuckets_;
+
+  /** \brief The age of the current search */
+  uint8_t age_;
+
+  /**
+   * \brief Finds the first slot of the bucket which may store a key
+   * \param key The unique key of the board
+   * \returns A pointer to the first slot of the bucket
+   */
+  Slot *getBucket(uint64_t key) const;
+
+  /**
+   * \brief Packs the contents of an entry into the data of a slot
+   * \returns The packed data
+   */
+  static uint64_t pack(int32_t value, size_t depth, Bound bound, size_t move,
+                       uint8_t age);
+
+  /**
+   * \brief Unpacks the data of a slot into an entry
+   * \param data    The packed data
+   * \returns The unpacked entry
+   */
+  static Entry unpack(uint64_t data);
+};
+
+#endif  // TRANSPOSITION_TABLE_HPP_
@@ -0,0 +1,117 @@
+/**
+ * \file work-stealing-pool.cpp
+ * \copyright Matthew Calligaro
+ * \date December 2019
+ * \brief Implements the WorkStealingPool class
+ */
+
+#include "work-stealing-pool.hpp"
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+thread_local WorkStealingPool *WorkStealingPool::currentPool_ = nullptr;
+thread_local size_t WorkStealingPool::currentIndex_ = 0;
+
+WorkStealingPool::TaskGroup::TaskGroup() : pending_{0} {}
+
+WorkStealingPool::WorkStealingPool(size_t numWorkers)
+    : numQueued_{0}, done_{false} {
+  for (size_t i = 0; i <= numWorkers; ++i) {
+    queues_.emplace_back(new Queue());
+  }
+  for (size_t i = 1; i <= numWorkers; ++i) {
+    workers_.emplace_back(&WorkStealingPool::workerLoop, this, i);
+  }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+  {
+    std::lock_guard<std::mutex> lock(sleepMutex_);
+    done_ = true;
+  }
+  wake_.notify_all();
+  for (std::thread &worker : workers_) {
+    worker.join();
+  }
+}
+
+void WorkStealingPool::submit(TaskGroup &group, std::function<void()> task) {
+  group.pending_.fetch_add(1);
+  Queue &queue = *queues_[getIndex()];
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.push_back({std::move(task), &group});
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(sleepMutex_);
+    ++numQueued_;
+  }
+  wake_.notify_one();
+}
+
+void WorkStealingPool::wait(TaskGroup &group) {
+  size_t index = getIndex();
+  while (group.pending_.load()) {
+    if (!runOne(index)) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+size_t WorkStealingPool::getIndex() const {
+  return currentPool_ == this ? currentIndex_ : 0;
+}
+
+bool WorkStealingPool::runOne(size_t index) {
+  Task task;
+  bool found = false;
+
+  // Take the newest task from our own queue, or else steal the oldest task
+  // from the next queue which has one
+  for (size_t i = 0; i < queues_.size() && !found; ++i) {
+    Queue &queue = *queues_[(index + i) % queues_.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+      continue;
+    }
+
+    if (i == 0) {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+    } else {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+    }
+    found = true;
+  }
+
+  if (!found) {
+    return false;
+  }
+
+  --numQueued_;
+  task.function();
+  task.group->pending_.fetch_sub(1);
+  return true;
+}
+
+void WorkStealingPool::workerLoop(size_t index) {
+  currentPool_ = this;
+  currentIndex_ = index;
+
+  while (!done_) {
+    if (runOne(index)) {
+      continue;
+    }
+
+    // Sleep until a task is submitted or the pool is destroyed
+    std::unique_lock<std::mutex> lock(sleepMutex_);
+    wake_.wait_for(lock, std::chrono::milliseconds(1),
+                   [this]() { return numQueued_ > 0 || done_; });
+  }
+}
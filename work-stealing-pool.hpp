@@ -0,0 +1,143 @@
+/**
+ * \file work-stealing-pool.hpp
+ * \copyright Matthew Calligaro
+ * \date December 2019
+ * \brief Declares the WorkStealingPool class
+ */
+
+#ifndef WORK_STEALING_POOL_HPP_
+#define WORK_STEALING_POOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * \class WorkStealingPool
+ * \brief A thread pool in which idle threads steal tasks from busy threads
+ * \note Each thread has its own queue.  A thread runs the newest task of its
+ * own queue first and steals the oldest task of another queue when its own
+ * queue is empty.  The thread which creates the pool joins in while it waits
+ * for a group of tasks, so a pool with no workers runs every task on the
+ * waiting thread, newest first.
+ */
+class WorkStealingPool {
+ public:
+  /**
+   * \class TaskGroup
+   * \brief A set of tasks which can be waited on together
+   */
+  class TaskGroup {
+    friend class WorkStealingPool;
+
+   public:
+    TaskGroup();
+    TaskGroup(const TaskGroup &other) = delete;
+    ~TaskGroup() = default;
+    TaskGroup &operator=(const TaskGroup &other) = delete;
+
+   private:
+    /** \brief The number of tasks in the group which have not finished */
+    std::atomic<size_t> pending_;
+  };
+
+  WorkStealingPool() = delete;
+  WorkStealingPool(const WorkStealingPool &other) = delete;
+
+  /**
+   * \brief Creates a pool and starts its worker threads
+   * \param numWorkers  The number of threads to start in addition to the
+   * thread which creates the pool
+   */
+  explicit WorkStealingPool(size_t numWorkers);
+
+  /**
+   * \brief Stops and joins the worker threads
+   * \note Every task group must be waited on before the pool is destroyed
+   */
+  ~WorkStealingPool();
+
+  WorkStealingPool &operator=(const WorkStealingPool &other) = delete;
+
+  /**
+   * \brief Adds a task to the queue of the calling thread
+   * \param group   The group to which the task belongs
+   * \param task    The function to run
+   */
+  void submit(TaskGroup &group, std::function<void()> task);
+
+  /**
+   * \brief Runs queued tasks until every task in a group has finished
+   * \param group   The group to wait on
+   */
+  void wait(TaskGroup &group);
+
+ private:
+  /**
+   * \struct Task
+   * \brief A queued task and the group to notify when it finishes
+   */
+  struct Task {
+    std::function<void()> function;
+    TaskGroup *group;
+  };
+
+  /**
+   * \struct Queue
+   * \brief The tasks submitted by one thread
+   */
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  /** \brief The queue of each thread (queue 0 belongs to the creator) */
+  std::vector<std::unique_ptr<Queue>> queues_;
+
+  /** \brief The worker threads */
+  std::vector<std::thread> workers_;
+
+  /** \brief The number of tasks waiting in all queues */
+  std::atomic<size_t> numQueued_;
+
+  /** \brief Set when the pool is being destroyed */
+  std::atomic<bool> done_;
+
+  /** \brief Protects sleeping workers from missing a new task */
+  std::mutex sleepMutex_;
+
+  /** \brief Wakes sleeping workers when a task is submitted */
+  std::condition_variable wake_;
+
+  /** \brief The pool the calling thread works for (null for other threads) */
+  static thread_local WorkStealingPool *currentPool_;
+
+  /** \brief The index of the calling thread's queue in currentPool_ */
+  static thread_local size_t currentIndex_;
+
+  /**
+   * \brief Returns the index of the calling thread's queue
+   * \returns The queue index, or 0 if the thread is not a worker
+   */
+  size_t getIndex() const;
+
+  /**
+   * \brief Runs one queued task, preferring the calling thread's own queue
+   * \param index   The index of the calling thread's queue
+   * \returns True if a task was run
+   */
+  bool runOne(size_t index);
+
+  /**
+   * \brief The main loop of a worker thread
+   * \param index   The index of the worker's queue
+   */
+  void workerLoop(size_t index);
+};
+
+#endif  // WORK_STEALING_POOL_HPP_